@@ -0,0 +1,19 @@
+include(../pgmodeler.pro)
+
+CONFIG += console
+TEMPLATE = app
+TARGET = pgmodeler-bench
+
+LIBS += $$LIBDESTDIR/$$LIBUTILS \
+	$$LIBDESTDIR/$$LIBPARSERS \
+	$$LIBDESTDIR/$$LIBDBCONNECT \
+	$$LIBDESTDIR/$$LIBOBJRENDERER \
+	$$LIBDESTDIR/$$LIBPGMODELER \
+	$$LIBDESTDIR/$$LIBPGMODELERUI
+
+SOURCES += src/main.cpp \
+	   src/modelgenerator.cpp \
+	   src/benchmarkrunner.cpp
+
+HEADERS += src/modelgenerator.h \
+	   src/benchmarkrunner.h
@@ -0,0 +1,152 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "benchmarkrunner.h"
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QStringList>
+#include <QRegExp>
+
+BenchmarkRunner::BenchmarkRunner(unsigned iterations)
+{
+	setIterations(iterations);
+}
+
+void BenchmarkRunner::setIterations(unsigned iterations)
+{
+	this->iterations=(iterations > 0 ? iterations : 1);
+}
+
+void BenchmarkRunner::setProperty(const QString &name, const QString &value)
+{
+	properties[name]=value;
+}
+
+void BenchmarkRunner::runScenario(const QString &name, function<void(void)> scenario, function<void(void)> setup)
+{
+	QElapsedTimer timer;
+	Result result;
+	double time;
+	unsigned i;
+
+	result.scenario=name;
+	result.iterations=iterations;
+	result.min_time=result.max_time=result.total_time=0;
+
+	for(i=0; i < iterations; i++)
+	{
+		if(setup)
+			setup();
+
+		timer.start();
+		scenario();
+		time=timer.nsecsElapsed() / 1000000.0;
+
+		if(i==0 || time < result.min_time)
+			result.min_time=time;
+
+		if(time > result.max_time)
+			result.max_time=time;
+
+		result.total_time+=time;
+	}
+
+	result.avg_time=result.total_time / iterations;
+	results.push_back(result);
+}
+
+vector<BenchmarkRunner::Result> BenchmarkRunner::getResults(void)
+{
+	return(results);
+}
+
+QString BenchmarkRunner::getReport(unsigned format)
+{
+	if(format==FORMAT_CSV)
+		return(getCSVReport());
+	else
+		return(getJSONReport());
+}
+
+QString BenchmarkRunner::getJSONReport(void)
+{
+	QJsonObject root, props, res;
+	QJsonArray res_list;
+	map<QString, QString>::iterator itr;
+	vector<Result>::iterator itr_res;
+
+	for(itr=properties.begin(); itr!=properties.end(); itr++)
+		props.insert(itr->first, itr->second);
+
+	for(itr_res=results.begin(); itr_res!=results.end(); itr_res++)
+	{
+		res=QJsonObject();
+		res.insert("scenario", itr_res->scenario);
+		res.insert("iterations", static_cast<int>(itr_res->iterations));
+		res.insert("min-ms", itr_res->min_time);
+		res.insert("avg-ms", itr_res->avg_time);
+		res.insert("max-ms", itr_res->max_time);
+		res.insert("total-ms", itr_res->total_time);
+		res_list.append(res);
+	}
+
+	root.insert("properties", props);
+	root.insert("results", res_list);
+
+	return(QString::fromUtf8(QJsonDocument(root).toJson()));
+}
+
+QString BenchmarkRunner::getCSVReport(void)
+{
+	QStringList header, prop_values, line;
+	QString report;
+	map<QString, QString>::iterator itr;
+	vector<Result>::iterator itr_res;
+
+	header << "scenario" << "iterations" << "min-ms" << "avg-ms" << "max-ms" << "total-ms";
+
+	for(itr=properties.begin(); itr!=properties.end(); itr++)
+	{
+		header << itr->first;
+
+		//Values containing separators or quotes are quoted
+		if(itr->second.contains(QRegExp("[,\"\\n]")))
+			prop_values << QString("\"%1\"").arg(QString(itr->second).replace("\"", "\"\""));
+		else
+			prop_values << itr->second;
+	}
+
+	report=header.join(",") + "\n";
+
+	for(itr_res=results.begin(); itr_res!=results.end(); itr_res++)
+	{
+		line.clear();
+		line << itr_res->scenario
+				 << QString::number(itr_res->iterations)
+				 << QString::number(itr_res->min_time, 'f', 3)
+				 << QString::number(itr_res->avg_time, 'f', 3)
+				 << QString::number(itr_res->max_time, 'f', 3)
+				 << QString::number(itr_res->total_time, 'f', 3)
+				 << prop_values;
+		report+=line.join(",") + "\n";
+	}
+
+	return(report);
+}
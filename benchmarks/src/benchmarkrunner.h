@@ -0,0 +1,87 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup benchmarks
+\class BenchmarkRunner
+\brief Executes the timed scenarios of the benchmarks and generates the machine readable reports (JSON or CSV).
+ Each scenario is executed several times and the minimum, average and maximum times are stored. The optional setup
+ function of a scenario is executed before each iteration and is not considered on the measured time.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include <QString>
+#include <functional>
+#include <vector>
+#include <map>
+
+using namespace std;
+
+class BenchmarkRunner {
+	public:
+		//! \brief Formats of the report
+		static constexpr unsigned FORMAT_JSON=0,
+															FORMAT_CSV=1;
+
+		//! \brief Stores the times (in milliseconds) of a executed scenario
+		struct Result {
+			QString scenario;
+			unsigned iterations;
+			double min_time, avg_time, max_time, total_time;
+		};
+
+	private:
+		//! \brief Amount of times each scenario is executed
+		unsigned iterations;
+
+		//! \brief Results in the order the scenarios were executed
+		vector<Result> results;
+
+		//! \brief Properties of the execution (version, model settings, threads) written on the reports
+		map<QString, QString> properties;
+
+		//! \brief Returns the report in JSON format
+		QString getJSONReport(void);
+
+		//! \brief Returns the report in CSV format (one line per scenario, properties included as columns)
+		QString getCSVReport(void);
+
+	public:
+		BenchmarkRunner(unsigned iterations=3);
+
+		//! \brief Sets the amount of times each scenario is executed (at least one)
+		void setIterations(unsigned iterations);
+
+		//! \brief Sets a property of the execution written on the reports
+		void setProperty(const QString &name, const QString &value);
+
+		/*! \brief Executes the scenario the configured amount of times storing its result. The setup function
+		 (when specified) is executed before each iteration out of the measured time */
+		void runScenario(const QString &name, function<void(void)> scenario, function<void(void)> setup=nullptr);
+
+		//! \brief Returns the results of the executed scenarios
+		vector<Result> getResults(void);
+
+		//! \brief Returns the report of the executed scenarios in the specified format (see FORMAT_??? constants)
+		QString getReport(unsigned format);
+};
+
+#endif
@@ -0,0 +1,350 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QCoreApplication>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QFile>
+#include <QStringList>
+#include <QThread>
+#include "exception.h"
+#include "globalattributes.h"
+#include "modelvalidationhelper.h"
+#include "modelgenerator.h"
+#include "benchmarkrunner.h"
+
+//Option names constants
+static const QString SCHEMAS="--schemas",
+										 TABLES="--tables",
+										 COLUMNS="--columns",
+										 FUNCTIONS="--functions",
+										 ONE_TO_MANY="--one-to-many",
+										 MANY_TO_MANY="--many-to-many",
+										 ROLES="--roles",
+										 PERMISSIONS="--permissions",
+										 ITERATIONS="--iterations",
+										 THREADS="--threads",
+										 PGSQL_VER="--pgsql-ver",
+										 FORMAT="--format",
+										 OUTPUT="--output",
+										 SCENARIOS="--scenarios",
+										 HELP="--help";
+
+//Scenarios names constants
+static const QString LOAD_MODEL="load-model",
+										 VALIDATE_RELATIONSHIPS="validate-relationships",
+										 SQL_DEFINITION="sql-definition",
+										 XML_DEFINITION="xml-definition",
+										 OBJECT_REFERENCES="object-references",
+										 VALIDATE_MODEL="validate-model",
+										 THREADED_OUTPUT="threaded-output";
+
+void showMenu(QTextStream &out)
+{
+	out << endl;
+	out << "Usage: pgmodeler-bench [OPTIONS]" << endl;
+	out << "pgModeler " << GlobalAttributes::PGMODELER_VERSION << " benchmarks." << endl;
+	out << endl;
+	out << "Generates a synthetic model and measures the time spent by the main operations over it." << endl;
+	out << endl;
+	out << "Model options: " << endl;
+	out << "   " << SCHEMAS << "=[NUMBER]\t\t Amount of schemas (default: 5)." << endl;
+	out << "   " << TABLES << "=[NUMBER]\t\t Amount of tables per schema (default: 20)." << endl;
+	out << "   " << COLUMNS << "=[NUMBER]\t\t Amount of columns per table besides the primary key (default: 10)." << endl;
+	out << "   " << FUNCTIONS << "=[NUMBER]\t Amount of functions per schema (default: 10)." << endl;
+	out << "   " << ONE_TO_MANY << "=[NUMBER]\t Total amount of one-to-many relationships (default: 50)." << endl;
+	out << "   " << MANY_TO_MANY << "=[NUMBER]\t Total amount of many-to-many relationships (default: 10)." << endl;
+	out << "   " << ROLES << "=[NUMBER]\t\t Amount of roles (default: 5)." << endl;
+	out << "   " << PERMISSIONS << "=[NUMBER]\t Amount of table permissions (default: 50)." << endl;
+	out << endl;
+	out << "Execution options: " << endl;
+	out << "   " << ITERATIONS << "=[NUMBER]\t Times each scenario is executed (default: 3)." << endl;
+	out << "   " << THREADS << "=[NUMBER]\t\t Threads used to load the model and generate the code (0 uses all available processors)." << endl;
+	out << "   " << PGSQL_VER << "=[VERSION]\t Version of the generated SQL code (default: " << SchemaParser::PGSQL_VERSION_92 << ")." << endl;
+	out << "   " << SCENARIOS << "=[LIST]\t\t Comma separated list of the scenarios to be executed (default: all)." << endl;
+	out << "   \t\t\t\t Available: " << QStringList({ LOAD_MODEL, VALIDATE_RELATIONSHIPS, SQL_DEFINITION,
+																										 XML_DEFINITION, OBJECT_REFERENCES, VALIDATE_MODEL,
+																										 THREADED_OUTPUT }).join(", ") << endl;
+	out << "   \t\t\t\t The " << THREADED_OUTPUT << " scenario fails if the SQL or XML code generated with one thread" << endl;
+	out << "   \t\t\t\t differs from the one generated with " << THREADS << " threads (at least two)." << endl;
+	out << "   " << FORMAT << "=[json|csv]\t Format of the results (default: json)." << endl;
+	out << "   " << OUTPUT << "=[FILE]\t\t File that receives the results (default: standard output)." << endl;
+	out << "   " << HELP << "\t\t\t Show this help menu." << endl;
+	out << endl;
+}
+
+void parseOptions(const QStringList &args, map<QString, QString> &opts)
+{
+	QStringList valid_opts={ SCHEMAS, TABLES, COLUMNS, FUNCTIONS, ONE_TO_MANY, MANY_TO_MANY, ROLES, PERMISSIONS,
+													 ITERATIONS, THREADS, PGSQL_VER, FORMAT, OUTPUT, SCENARIOS, HELP },
+			num_opts={ SCHEMAS, TABLES, COLUMNS, FUNCTIONS, ONE_TO_MANY, MANY_TO_MANY, ROLES, PERMISSIONS, ITERATIONS, THREADS };
+	QString op, value;
+	int i, eq_pos;
+	bool conv_ok;
+
+	for(i=1; i < args.size(); i++)
+	{
+		op=args[i];
+		value.clear();
+		eq_pos=op.indexOf("=");
+
+		//The value can be attached to the option (--option=value) or be the next argument
+		if(eq_pos >= 0)
+		{
+			value=op.mid(eq_pos+1);
+			op=op.mid(0, eq_pos);
+		}
+		else if(op!=HELP && i < args.size()-1 && !args[i+1].startsWith("-"))
+			value=args[++i];
+
+		if(!valid_opts.contains(op))
+			throw Exception(QString("Unrecognized option '%1'.").arg(op), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		else if(op!=HELP && value.isEmpty())
+			throw Exception(QString("Value not specified for option '%1'.").arg(op), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		if(num_opts.contains(op))
+		{
+			value.toUInt(&conv_ok);
+			if(!conv_ok)
+				throw Exception(QString("Invalid number specified for option '%1'.").arg(op), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+
+		opts[op]=value;
+	}
+
+	if(opts.count(FORMAT) && opts[FORMAT]!="json" && opts[FORMAT]!="csv")
+		throw Exception(QString("Invalid format '%1'.").arg(opts[FORMAT]), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
+int main(int argc, char **argv)
+{
+	QCoreApplication app(argc, argv);
+	QTextStream out(stdout);
+
+	try
+	{
+		map<QString, QString> opts;
+		map<QString, unsigned> settings;
+		map<QString, unsigned>::iterator itr;
+		QStringList scenarios;
+		ModelGenerator generator;
+		BenchmarkRunner runner;
+		ModelValidationHelper validation_hlp;
+		QTemporaryDir tmp_dir;
+		QString model_file, report;
+		QFile output;
+		DatabaseModel *model=nullptr, *loaded_model=nullptr;
+		vector<BaseObject *> objects, refs, *obj_list=nullptr;
+		ObjectType types[]={ OBJ_ROLE, OBJ_SCHEMA, OBJ_FUNCTION, OBJ_TABLE };
+		unsigned i, threads=0, type_cnt=sizeof(types)/sizeof(ObjectType);
+		Table *table=nullptr;
+
+		parseOptions(app.arguments(), opts);
+
+		if(opts.count(HELP))
+		{
+			showMenu(out);
+			return(0);
+		}
+
+		if(opts.count(SCENARIOS))
+			scenarios=opts[SCENARIOS].split(",", QString::SkipEmptyParts);
+
+		if(opts.count(SCHEMAS)) generator.setSchemaCount(opts[SCHEMAS].toUInt());
+		if(opts.count(TABLES)) generator.setTableCount(opts[TABLES].toUInt());
+		if(opts.count(COLUMNS)) generator.setColumnCount(opts[COLUMNS].toUInt());
+		if(opts.count(FUNCTIONS)) generator.setFunctionCount(opts[FUNCTIONS].toUInt());
+		if(opts.count(ROLES)) generator.setRoleCount(opts[ROLES].toUInt());
+		if(opts.count(PERMISSIONS)) generator.setPermissionCount(opts[PERMISSIONS].toUInt());
+		if(opts.count(ITERATIONS)) runner.setIterations(opts[ITERATIONS].toUInt());
+
+		if(opts.count(ONE_TO_MANY) || opts.count(MANY_TO_MANY))
+		{
+			settings=generator.getSettings();
+			generator.setRelationshipCount(opts.count(ONE_TO_MANY) ? opts[ONE_TO_MANY].toUInt() : settings["one-to-many"],
+																		 opts.count(MANY_TO_MANY) ? opts[MANY_TO_MANY].toUInt() : settings["many-to-many"]);
+		}
+
+		SchemaParser::setPgSQLVersion(opts.count(PGSQL_VER) ? opts[PGSQL_VER] : SchemaParser::PGSQL_VERSION_92);
+
+		//Generating the model and saving it in order to be used by the loading scenarios
+		model=new DatabaseModel;
+
+		if(opts.count(THREADS))
+		{
+			threads=opts[THREADS].toUInt();
+			model->setCodeGenerationThreads(threads);
+			model->setLoadingThreads(threads);
+		}
+
+		generator.generateModel(model);
+		model_file=tmp_dir.path() + GlobalAttributes::DIR_SEPARATOR + "benchmark.dbm";
+		model->saveModel(model_file, SchemaParser::XML_DEFINITION);
+
+		runner.setProperty("version", GlobalAttributes::PGMODELER_VERSION);
+		runner.setProperty("pgsql-version", SchemaParser::getPgSQLVersion());
+		runner.setProperty("threads", opts.count(THREADS) ? opts[THREADS] : "default");
+		runner.setProperty("objects", QString::number(model->getObjectCount()));
+
+		settings=generator.getSettings();
+		for(itr=settings.begin(); itr!=settings.end(); itr++)
+			runner.setProperty(itr->first, QString::number(itr->second));
+
+		auto createLoadedModel=[&](){
+			delete(loaded_model);
+			loaded_model=new DatabaseModel;
+
+			if(opts.count(THREADS))
+			{
+				loaded_model->setCodeGenerationThreads(threads);
+				loaded_model->setLoadingThreads(threads);
+			}
+
+			loaded_model->createSystemObjects(false);
+		};
+
+		auto loadModel=[&](){
+			loaded_model->loadModel(model_file);
+		};
+
+		if(scenarios.isEmpty() || scenarios.contains(LOAD_MODEL))
+			runner.runScenario(LOAD_MODEL, loadModel, createLoadedModel);
+
+		delete(loaded_model);
+		loaded_model=nullptr;
+
+		if(scenarios.isEmpty() || scenarios.contains(VALIDATE_RELATIONSHIPS))
+		{
+			runner.runScenario(VALIDATE_RELATIONSHIPS,
+												 [&](){ model->validateRelationships(); },
+												 [&](){
+														 //Forces the revalidation of all the relationships
+														 obj_list=model->getObjectList(OBJ_RELATIONSHIP);
+														 for(i=0; i < obj_list->size(); i++)
+														 {
+															 if(dynamic_cast<Relationship *>(obj_list->at(i)))
+																 dynamic_cast<Relationship *>(obj_list->at(i))->forceInvalidate();
+														 }
+													 });
+		}
+
+		if(scenarios.isEmpty() || scenarios.contains(SQL_DEFINITION))
+			runner.runScenario(SQL_DEFINITION, [&](){ model->getCodeDefinition(SchemaParser::SQL_DEFINITION); });
+
+		if(scenarios.isEmpty() || scenarios.contains(XML_DEFINITION))
+			runner.runScenario(XML_DEFINITION, [&](){ model->getCodeDefinition(SchemaParser::XML_DEFINITION); });
+
+		if(scenarios.isEmpty() || scenarios.contains(THREADED_OUTPUT))
+		{
+			unsigned prev_threads=model->getCodeGenerationThreads(),
+					par_threads=(threads > 1 ? threads : static_cast<unsigned>(qMax(2, QThread::idealThreadCount())));
+
+			runner.runScenario(THREADED_OUTPUT,
+												 [&](){
+														 unsigned def_types[]={ SchemaParser::SQL_DEFINITION, SchemaParser::XML_DEFINITION };
+														 QString serial_code, parallel_code;
+														 QStringList serial_lines, parallel_lines;
+														 int ln=0;
+
+														 for(auto def_type : def_types)
+														 {
+															 model->setCodeGenerationThreads(1);
+															 serial_code=model->getCodeDefinition(def_type);
+															 model->setCodeGenerationThreads(par_threads);
+															 parallel_code=model->getCodeDefinition(def_type);
+
+															 if(serial_code!=parallel_code)
+															 {
+																 //Locating the first differing line in order to ease the investigation
+																 serial_lines=serial_code.split(QChar('\n'));
+																 parallel_lines=parallel_code.split(QChar('\n'));
+
+																 while(ln < serial_lines.size() && ln < parallel_lines.size() &&
+																			 serial_lines[ln]==parallel_lines[ln])
+																	 ln++;
+
+																 model->setCodeGenerationThreads(prev_threads);
+																 throw Exception(QString("The %1 code generated with %2 threads differs from the one generated with 1 thread at line %3.")
+																								 .arg(def_type==SchemaParser::SQL_DEFINITION ? "SQL" : "XML")
+																								 .arg(par_threads).arg(ln + 1),
+																								 ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															 }
+														 }
+													 });
+
+			model->setCodeGenerationThreads(prev_threads);
+		}
+
+		if(scenarios.isEmpty() || scenarios.contains(OBJECT_REFERENCES))
+		{
+			//Gathering the objects (including the tables' columns) which references are searched
+			for(i=0; i < type_cnt; i++)
+			{
+				obj_list=model->getObjectList(types[i]);
+				objects.insert(objects.end(), obj_list->begin(), obj_list->end());
+			}
+
+			obj_list=model->getObjectList(OBJ_TABLE);
+			for(auto obj : *obj_list)
+			{
+				table=dynamic_cast<Table *>(obj);
+				for(i=0; i < table->getColumnCount(); i++)
+					objects.push_back(table->getColumn(i));
+			}
+
+			runner.runScenario(OBJECT_REFERENCES,
+												 [&](){
+														 for(auto obj : objects)
+														 {
+															 refs.clear();
+															 model->getObjectReferences(obj, refs);
+														 }
+													 },
+												 [&](){ model->updateReferencesIndex(); });
+		}
+
+		if(scenarios.isEmpty() || scenarios.contains(VALIDATE_MODEL))
+			runner.runScenario(VALIDATE_MODEL, [&](){ validation_hlp.validateModel(model); });
+
+		delete(model);
+		report=runner.getReport(opts[FORMAT]=="csv" ? BenchmarkRunner::FORMAT_CSV : BenchmarkRunner::FORMAT_JSON);
+
+		if(opts.count(OUTPUT))
+		{
+			output.setFileName(opts[OUTPUT]);
+
+			if(!output.open(QFile::WriteOnly | QFile::Truncate))
+				throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTEN).arg(opts[OUTPUT]),
+												ERR_FILE_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			output.write(report.toUtf8());
+			output.close();
+		}
+		else
+			out << report;
+
+		return(0);
+	}
+	catch(Exception &e)
+	{
+		out << endl;
+		out << e.getExceptionsText();
+		out << "** pgmodeler-bench aborted due to critical error(s). **" << endl << endl;
+		return(e.getErrorType()==ERR_CUSTOM ? -1 : e.getErrorType());
+	}
+}
@@ -0,0 +1,217 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelgenerator.h"
+
+ModelGenerator::ModelGenerator(void)
+{
+	schema_cnt=5;
+	table_cnt=20;
+	column_cnt=10;
+	function_cnt=10;
+	rel_1n_cnt=50;
+	rel_nn_cnt=10;
+	role_cnt=5;
+	permission_cnt=50;
+}
+
+void ModelGenerator::setSchemaCount(unsigned count)
+{
+	schema_cnt=(count > 0 ? count : 1);
+}
+
+void ModelGenerator::setTableCount(unsigned count)
+{
+	table_cnt=count;
+}
+
+void ModelGenerator::setColumnCount(unsigned count)
+{
+	column_cnt=count;
+}
+
+void ModelGenerator::setFunctionCount(unsigned count)
+{
+	function_cnt=count;
+}
+
+void ModelGenerator::setRelationshipCount(unsigned rel_1n_cnt, unsigned rel_nn_cnt)
+{
+	this->rel_1n_cnt=rel_1n_cnt;
+	this->rel_nn_cnt=rel_nn_cnt;
+}
+
+void ModelGenerator::setRoleCount(unsigned count)
+{
+	role_cnt=count;
+}
+
+void ModelGenerator::setPermissionCount(unsigned count)
+{
+	permission_cnt=count;
+}
+
+map<QString, unsigned> ModelGenerator::getSettings(void)
+{
+	map<QString, unsigned> settings;
+
+	settings["schemas"]=schema_cnt;
+	settings["tables"]=table_cnt;
+	settings["columns"]=column_cnt;
+	settings["functions"]=function_cnt;
+	settings["one-to-many"]=rel_1n_cnt;
+	settings["many-to-many"]=rel_nn_cnt;
+	settings["roles"]=role_cnt;
+	settings["permissions"]=permission_cnt;
+
+	return(settings);
+}
+
+Table *ModelGenerator::createTable(DatabaseModel *model, Schema *schema, unsigned idx)
+{
+	static const QString types[]={ "integer", "varchar", "text", "numeric", "boolean", "timestamp", "date", "bigint" };
+	unsigned type_cnt=sizeof(types)/sizeof(QString), i;
+	Table *table=new Table;
+	Column *col=nullptr;
+	Constraint *pk=nullptr;
+
+	table->setName(QString("table_%1").arg(idx));
+	table->setSchema(schema);
+
+	col=new Column;
+	col->setName("id");
+	col->setType(PgSQLType("serial"));
+	col->setNotNull(true);
+	table->addColumn(col);
+
+	pk=new Constraint;
+	pk->setName(QString("table_%1_pk").arg(idx));
+	pk->setConstraintType(ConstraintType::primary_key);
+	pk->addColumn(col, Constraint::SOURCE_COLS);
+	table->addConstraint(pk);
+
+	for(i=0; i < column_cnt; i++)
+	{
+		col=new Column;
+		col->setName(QString("column_%1").arg(i));
+		col->setType(PgSQLType(types[(idx + i) % type_cnt]));
+		col->setNotNull(i % 3 == 0);
+		table->addColumn(col);
+	}
+
+	model->addTable(table);
+	return(table);
+}
+
+Function *ModelGenerator::createFunction(DatabaseModel *model, Schema *schema, unsigned idx)
+{
+	Function *func=new Function;
+	Parameter param;
+
+	func->setName(QString("function_%1").arg(idx));
+	func->setSchema(schema);
+	func->setLanguage(model->getObject(~LanguageType(LanguageType::sql), OBJ_LANGUAGE));
+	func->setReturnType(PgSQLType("integer"));
+
+	param.setName("value");
+	param.setType(PgSQLType("integer"));
+	func->addParameter(param);
+
+	func->setSourceCode(QString("SELECT $1 + %1;").arg(idx));
+	model->addFunction(func);
+	return(func);
+}
+
+void ModelGenerator::createRelationships(DatabaseModel *model, vector<Table *> &tables)
+{
+	unsigned count=tables.size(), dist=1, src=0, created=0, total=rel_1n_cnt + rel_nn_cnt;
+
+	/* The pairs are enumerated by the distance between the tables indexes: (0,1), (1,2) ... (0,2), (1,3) ...
+		 so the first relationships link neighbour tables and a table is referenced by several others as the amount grows */
+	while(created < total && dist < count)
+	{
+		model->addRelationship(new Relationship(created < rel_1n_cnt ? BaseRelationship::RELATIONSHIP_1N : BaseRelationship::RELATIONSHIP_NN,
+																						tables[src], tables[src + dist]));
+		created++;
+		src++;
+
+		if(src + dist >= count)
+		{
+			src=0;
+			dist++;
+		}
+	}
+}
+
+void ModelGenerator::generateModel(DatabaseModel *model)
+{
+	unsigned sch_idx, i, tab_idx=0, func_idx=0;
+	vector<Table *> tables;
+	vector<Role *> roles;
+	Schema *schema=nullptr;
+	Role *role=nullptr;
+	Permission *perm=nullptr;
+
+	if(!model)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	try
+	{
+		model->setName("benchmark");
+		model->createSystemObjects(true);
+
+		for(i=0; i < role_cnt; i++)
+		{
+			role=new Role;
+			role->setName(QString("role_%1").arg(i));
+			model->addRole(role);
+			roles.push_back(role);
+		}
+
+		for(sch_idx=0; sch_idx < schema_cnt; sch_idx++)
+		{
+			schema=new Schema;
+			schema->setName(QString("schema_%1").arg(sch_idx));
+			model->addSchema(schema);
+
+			for(i=0; i < table_cnt; i++)
+				tables.push_back(createTable(model, schema, tab_idx++));
+
+			for(i=0; i < function_cnt; i++)
+				createFunction(model, schema, func_idx++);
+		}
+
+		createRelationships(model, tables);
+
+		/* Each permission grants a different set of privileges on a table to one of the roles. The pair
+			 table/role is never repeated since the model doesn't accept duplicated permissions */
+		for(i=0; i < permission_cnt && i < tables.size() * roles.size(); i++)
+		{
+			perm=new Permission(tables[i % tables.size()]);
+			perm->addRole(roles[i / tables.size()]);
+			perm->setPrivilege(Permission::PRIV_SELECT, true, false);
+			perm->setPrivilege(Permission::PRIV_UPDATE, i % 2 == 0, false);
+			perm->setPrivilege(Permission::PRIV_INSERT, i % 3 == 0, i % 5 == 0);
+			model->addPermission(perm);
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
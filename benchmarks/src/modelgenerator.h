@@ -0,0 +1,75 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup benchmarks
+\class ModelGenerator
+\brief Creates synthetic database models used by the benchmarks. The generated model has the configured amount
+ of schemas, tables (with a serial primary key and several columns), one-to-many and many-to-many relationships,
+ functions, roles and permissions. The objects are created in a deterministic way so the same settings always
+ produce the same model, permitting to compare the results of different pgModeler versions.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef MODEL_GENERATOR_H
+#define MODEL_GENERATOR_H
+
+#include "databasemodel.h"
+
+class ModelGenerator {
+	private:
+		//! \brief Amount of schemas, tables per schema, columns per table (besides the primary key) and functions per schema
+		unsigned schema_cnt, table_cnt, column_cnt, function_cnt;
+
+		//! \brief Total amount of one-to-many and many-to-many relationships
+		unsigned rel_1n_cnt, rel_nn_cnt;
+
+		/*! \brief Total amount of roles and table permissions. The amount of permissions is limited to
+		 the amount of tables multiplied by the amount of roles */
+		unsigned role_cnt, permission_cnt;
+
+		//! \brief Creates a table with the specified index on the schema
+		Table *createTable(DatabaseModel *model, Schema *schema, unsigned idx);
+
+		//! \brief Creates a function with the specified index on the schema
+		Function *createFunction(DatabaseModel *model, Schema *schema, unsigned idx);
+
+		/*! \brief Creates the relationships linking the tables. The pairs of tables are chosen in a way that
+		 no pair is repeated and the tables are always linked from the smaller to the greater index, avoiding cycles */
+		void createRelationships(DatabaseModel *model, vector<Table *> &tables);
+
+	public:
+		ModelGenerator(void);
+
+		void setSchemaCount(unsigned count);
+		void setTableCount(unsigned count);
+		void setColumnCount(unsigned count);
+		void setFunctionCount(unsigned count);
+		void setRelationshipCount(unsigned rel_1n_cnt, unsigned rel_nn_cnt);
+		void setRoleCount(unsigned count);
+		void setPermissionCount(unsigned count);
+
+		/*! \brief Populates the passed model (which must be empty) with the synthetic objects.
+		 The system objects (languages) are created if needed */
+		void generateModel(DatabaseModel *model);
+
+		//! \brief Returns the settings of the generator as a map (used on the benchmark reports)
+		map<QString, unsigned> getSettings(void);
+};
+
+#endif
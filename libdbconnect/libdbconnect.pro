@@ -8,7 +8,9 @@ OBJECTS_DIR = obj
 LIBS += $$DESTDIR/$$LIBUTILS
 
 HEADERS += src/dbconnection.h \
-	   src/resultset.h
+	   src/resultset.h \
+	   src/connectionpool.h
 
 SOURCES += src/dbconnection.cpp \
-	   src/resultset.cpp
+	   src/resultset.cpp \
+	   src/connectionpool.cpp
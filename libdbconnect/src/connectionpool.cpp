@@ -0,0 +1,150 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "connectionpool.h"
+
+ConnectionPool ConnectionPool::pool;
+
+ConnectionPool::ConnectionPool(void)
+{
+	max_idle=DEFAULT_MAX_IDLE;
+}
+
+ConnectionPool::~ConnectionPool(void)
+{
+	clear();
+}
+
+bool ConnectionPool::isReusable(PGconn *conn)
+{
+	/* Consuming the pending input detects connections closed by the server while idle without a round trip.
+		 Broken connections are reset (which reconnects using the same parameters) before being discarded */
+	if(!PQconsumeInput(conn) || PQstatus(conn)!=CONNECTION_OK)
+		PQreset(conn);
+
+	return(PQstatus(conn)==CONNECTION_OK && PQtransactionStatus(conn)==PQTRANS_IDLE);
+}
+
+PGconn *ConnectionPool::acquire(const QString &conn_str)
+{
+	PGconn *conn=nullptr;
+
+	while(true)
+	{
+		pool.mutex.lock();
+
+		if(pool.idle_conns[conn_str].empty())
+			conn=nullptr;
+		else
+		{
+			conn=pool.idle_conns[conn_str].back();
+			pool.idle_conns[conn_str].pop_back();
+		}
+
+		pool.mutex.unlock();
+
+		if(!conn || isReusable(conn))
+			break;
+
+		PQfinish(conn);
+	}
+
+	//The connection is opened outside the lock since it may take a while
+	if(!conn)
+		conn=PQconnectdb(conn_str.toStdString().c_str());
+
+	return(conn);
+}
+
+void ConnectionPool::release(const QString &conn_str, PGconn *conn)
+{
+	PGresult *res=nullptr;
+	bool reuse=false;
+
+	if(!conn) return;
+
+	if(PQstatus(conn)==CONNECTION_OK && PQtransactionStatus(conn)==PQTRANS_IDLE && getMaxIdleConnections() > 0)
+	{
+		//Resets the session (settings, temporary objects, prepared statements) so the next user gets a clean one
+		res=PQexec(conn, "DISCARD ALL");
+		reuse=(PQresultStatus(res)==PGRES_COMMAND_OK);
+		PQclear(res);
+	}
+
+	if(reuse)
+	{
+		QMutexLocker locker(&pool.mutex);
+
+		if(pool.idle_conns[conn_str].size() < pool.max_idle)
+		{
+			pool.idle_conns[conn_str].push_back(conn);
+			return;
+		}
+	}
+
+	PQfinish(conn);
+}
+
+void ConnectionPool::clear(const QString &db_name)
+{
+	QMutexLocker locker(&pool.mutex);
+	map<QString, vector<PGconn *> >::iterator itr=pool.idle_conns.begin();
+	vector<PGconn *>::iterator itr_conn;
+
+	while(itr!=pool.idle_conns.end())
+	{
+		itr_conn=itr->second.begin();
+
+		while(itr_conn!=itr->second.end())
+		{
+			if(db_name.isEmpty() || db_name==QString(PQdb(*itr_conn)))
+			{
+				PQfinish(*itr_conn);
+				itr_conn=itr->second.erase(itr_conn);
+			}
+			else
+				itr_conn++;
+		}
+
+		itr++;
+	}
+}
+
+void ConnectionPool::setMaxIdleConnections(unsigned max_idle)
+{
+	QMutexLocker locker(&pool.mutex);
+	map<QString, vector<PGconn *> >::iterator itr;
+
+	pool.max_idle=max_idle;
+
+	//Closes the connections that exceed the new limit
+	for(itr=pool.idle_conns.begin(); itr!=pool.idle_conns.end(); itr++)
+	{
+		while(itr->second.size() > max_idle)
+		{
+			PQfinish(itr->second.back());
+			itr->second.pop_back();
+		}
+	}
+}
+
+unsigned ConnectionPool::getMaxIdleConnections(void)
+{
+	QMutexLocker locker(&pool.mutex);
+	return(pool.max_idle);
+}
@@ -0,0 +1,84 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libdbconnect
+\class ConnectionPool
+\brief Keeps the connections closed by DBConnection opened so they can be reused by the next connection made using
+ the same connection string, avoiding a new authentication (and SSL handshake) on each connection. The pooled
+ connections have their session state discarded when returned and are checked (and reset if needed) before
+ being reused. The amount of idle connections kept for each connection string is limited. All methods are thread safe.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef CONNECTION_POOL_H
+#define CONNECTION_POOL_H
+
+#include <libpq-fe.h>
+#include <QString>
+#include <QMutex>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+class ConnectionPool {
+	private:
+		//! \brief Idle connections of each connection string
+		map<QString, vector<PGconn *> > idle_conns;
+
+		//! \brief Mutex that controls the access to the idle connections
+		QMutex mutex;
+
+		//! \brief Maximum amount of idle connections kept for each connection string
+		unsigned max_idle;
+
+		//! \brief Pool shared by all connections. The idle connections are closed when the application exits
+		static ConnectionPool pool;
+
+		ConnectionPool(void);
+
+		//! \brief Returns if the connection can be reused, trying to reset it when it's broken
+		static bool isReusable(PGconn *conn);
+
+	public:
+		//! \brief Default maximum amount of idle connections kept for each connection string
+		static constexpr unsigned DEFAULT_MAX_IDLE=4;
+
+		~ConnectionPool(void);
+
+		/*! \brief Returns an opened connection for the connection string, reusing an idle one when possible.
+		 The returned connection must be checked with PQstatus() since the failed attempts are returned as well */
+		static PGconn *acquire(const QString &conn_str);
+
+		/*! \brief Returns the connection to the pool. The connection is closed if it's broken, inside a transaction
+		 or when the limit of idle connections for the connection string was reached */
+		static void release(const QString &conn_str, PGconn *conn);
+
+		/*! \brief Closes the idle connections to the specified database (all databases when the name is empty).
+		 This must be done before dropping a database since the idle connections prevent its removal */
+		static void clear(const QString &db_name="");
+
+		//! \brief Defines the maximum amount of idle connections kept for each connection string (0 disables the pool)
+		static void setMaxIdleConnections(unsigned max_idle);
+
+		//! \brief Returns the maximum amount of idle connections kept for each connection string
+		static unsigned getMaxIdleConnections(void);
+};
+
+#endif
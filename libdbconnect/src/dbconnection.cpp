@@ -58,10 +58,19 @@ DBConnection::DBConnection(const QString &server_fqdn, const QString &port, cons
 	connect();
 }
 
+DBConnection::DBConnection(const DBConnection &conn)
+{
+	//The copy shares only the parameters, the connection itself is opened by connect()
+	connection=nullptr;
+	connection_params=conn.connection_params;
+	connection_str=conn.connection_str;
+}
+
 DBConnection::~DBConnection(void)
 {
+	//The connection is kept opened on the pool to be reused
 	if(connection)
-		PQfinish(connection);
+		ConnectionPool::release(connection_str, connection);
 }
 
 void DBConnection::setConnectionParam(const QString &param, const QString &value)
@@ -102,7 +111,7 @@ void DBConnection::generateConnectionString(void)
 	}
 }
 
-void DBConnection::connect(void)
+void DBConnection::connect(bool use_pool)
 {
 	QString str_aux;
 
@@ -112,8 +121,15 @@ void DBConnection::connect(void)
 	if(connection_str=="")
 		throw Exception(ERR_CONNECTION_NOT_CONFIGURED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
-	//Try to connect to the database
-	connection=PQconnectdb(connection_str.toStdString().c_str());
+	//Connecting again releases the current connection
+	if(connection)
+		close();
+
+	//Try to connect to the database reusing an idle connection when possible
+	if(use_pool)
+		connection=ConnectionPool::acquire(connection_str);
+	else
+		connection=PQconnectdb(connection_str.toStdString().c_str());
 
 	/* If the connection descriptor has not been allocated or if the connection state
 		is CONNECTION_BAD it indicates that the connection was not successful */
@@ -122,6 +138,13 @@ void DBConnection::connect(void)
 		//Raise the error generated by the DBMS
 		str_aux=QString(Exception::getErrorMessage(ERR_CONNECTION_NOT_STABLISHED))
 						.arg(PQerrorMessage(connection));
+
+		if(connection)
+		{
+			PQfinish(connection);
+			connection=nullptr;
+		}
+
 		throw Exception(str_aux, ERR_CONNECTION_NOT_STABLISHED,
 										__PRETTY_FUNCTION__, __FILE__, __LINE__);
 	}
@@ -133,8 +156,8 @@ void DBConnection::close(void)
 	if(!connection)
 		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
-	//Finalizes the connection
-	PQfinish(connection);
+	//Returns the connection to the pool which closes it when it can't be reused
+	ConnectionPool::release(connection_str, connection);
 	connection=nullptr;
 }
 
@@ -227,10 +250,98 @@ void DBConnection::executeDDLCommand(const QString &sql)
 	//Raise an error in case the command sql execution is not sucessful
 	if(strlen(PQerrorMessage(connection)) > 0)
 	{
+		QString sql_state=PQresultErrorField(sql_res, PG_DIAG_SQLSTATE);
+
+		PQclear(sql_res);
 		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
 										.arg(PQerrorMessage(connection)),
-										ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
-										QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE)));
+										ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, sql_state);
+	}
+
+	PQclear(sql_res);
+}
+
+void DBConnection::executeDDLCommands(const vector<QString> &cmds, unsigned &exec_cnt)
+{
+	vector<QString>::const_iterator itr=cmds.begin(), itr_end=cmds.end();
+	QByteArray batch;
+	PGresult *sql_res=nullptr;
+	ExecStatusType status;
+	QString err_msg, sql_state;
+	bool failed=false, in_transaction=false;
+
+	exec_cnt=0;
+
+	//Raise an error in case the user try to close a not opened connection
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(cmds.empty())
+		return;
+
+	/* Each command is surrounded by a savepoint which is released when the command succeeds. The server
+		 returns a result for each statement, so the amount of released savepoints is the amount of commands
+		 executed before the first error (the statements after the error are skipped by the server). The extra
+		 semicolon ends a command that eventually doesn't have one (empty statements are ignored) */
+	//When a transaction is already opened the commands become part of it
+	in_transaction=(PQtransactionStatus(connection)==PQTRANS_INTRANS);
+
+	if(!in_transaction)
+		batch+="BEGIN;\n";
+
+	while(itr!=itr_end)
+	{
+		batch+="SAVEPOINT ddl_command;\n";
+		batch+=itr->toUtf8();
+		batch+="\n;RELEASE SAVEPOINT ddl_command;\n";
+		itr++;
+	}
+	if(!in_transaction)
+		batch+="COMMIT;";
+
+	if(!PQsendQuery(connection, batch.constData()))
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+										.arg(PQerrorMessage(connection)),
+										ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	while((sql_res=PQgetResult(connection)))
+	{
+		status=PQresultStatus(sql_res);
+
+		if(!failed && status==PGRES_FATAL_ERROR)
+		{
+			failed=true;
+			err_msg=PQresultErrorMessage(sql_res);
+			sql_state=PQresultErrorField(sql_res, PG_DIAG_SQLSTATE);
+		}
+		else if(!failed && strcmp(PQcmdStatus(sql_res), "RELEASE")==0)
+			exec_cnt++;
+
+		PQclear(sql_res);
+	}
+
+	if(failed)
+	{
+		//Undoes only the failed command keeping the previous ones
+		if(in_transaction)
+			PQclear(PQexec(connection, "ROLLBACK TO SAVEPOINT ddl_command; RELEASE SAVEPOINT ddl_command;"));
+		else
+		{
+			if(exec_cnt < cmds.size())
+				PQclear(PQexec(connection, "ROLLBACK TO SAVEPOINT ddl_command; COMMIT;"));
+			//If the error happened on commit the whole transaction was discarded by the server
+			else
+				exec_cnt=0;
+
+			//Guarantees that the connection isn't left inside an aborted transaction
+			if(PQtransactionStatus(connection)!=PQTRANS_IDLE)
+				PQclear(PQexec(connection, "ROLLBACK;"));
+		}
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(err_msg),
+										ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, sql_state);
 	}
 }
 
@@ -27,7 +27,9 @@
 #define DBCONNECTION_H
 
 #include "resultset.h"
+#include "connectionpool.h"
 #include <map>
+#include <vector>
 #include <QRegExp>
 
 class DBConnection {
@@ -70,19 +72,24 @@ class DBConnection {
 
 		DBConnection(void);
 		DBConnection(const QString &servidor, const QString &porta, const QString &usuario, const QString &passwd, const QString &db_name);
+
+		//! \brief Creates a not opened connection with the same parameters of the specified one
+		DBConnection(const DBConnection &conn);
 		~DBConnection(void);
 
 		/*! \brief Sets one connection parameter. This method can only be called before
 		 the connection to the database */
 		void setConnectionParam(const QString &param, const QString &value);
 
-		//! \brief Open the connection to the database
-		void connect(void);
+		/*! \brief Open the connection to the database. An idle connection opened with the same parameters
+		 is reused when available (see ConnectionPool). When 'use_pool' is false a new connection is always
+		 opened, which guarantees that the server is contacted and the user authenticated (e.g. to test the parameters) */
+		void connect(bool use_pool=true);
 
 		//! \brief Resets the database connection
 		void reset(void);
 
-		//! \brief Close the opened connection
+		//! \brief Close the opened connection (the connection is kept on the pool to be reused when possible)
 		void close(void);
 
 		//! \brief Returns the value of specified parameter name
@@ -109,6 +116,16 @@ class DBConnection {
 		 to be an data definition one  */
 		void executeDDLCommand(const QString &sql);
 
+		/*! \brief Executes several DDL commands (each one may contain more than one statement) in a single
+		 round trip to the server. The commands are executed inside a transaction and each one is isolated by
+		 a savepoint so, when a command fails, the commands before it are committed, only the failed one is undone
+		 and the error is raised exactly as in executeDDLCommand(). The amount of commands successfully executed
+		 is stored on 'exec_cnt', which means that the failed command is the one at position 'exec_cnt'.
+		 When the connection is already inside a transaction the commands are executed as part of it and nothing
+		 is committed, a failed command is undone keeping the transaction usable.
+		 Commands that can't be executed inside a transaction block must be executed by executeDDLCommand() */
+		void executeDDLCommands(const vector<QString> &cmds, unsigned &exec_cnt);
+
 		//! \brief Makes an copy between two connections
 		void operator = (DBConnection &conn);
 };
@@ -7,8 +7,18 @@ TARGET = parsers
 LIBS += $$DESTDIR/$$LIBUTILS
 
 HEADERS += src/schemaparser.h \
-	   src/xmlparser.h
+	   src/schematemplate.h \
+	   src/schemaparsercontext.h \
+	   src/xmlparser.h \
+	   src/xmlparsercontext.h \
+	   src/xmlfragment.h \
+	   src/xmlfragmenttask.h
 
 SOURCES += src/schemaparser.cpp \
-	   src/xmlparser.cpp
+	   src/schematemplate.cpp \
+	   src/schemaparsercontext.cpp \
+	   src/xmlparser.cpp \
+	   src/xmlparsercontext.cpp \
+	   src/xmlfragment.cpp \
+	   src/xmlfragmenttask.cpp
 
@@ -19,6 +19,9 @@
 /**
 \ingroup libparsers
 \brief ParserEsquema class definition used to create SQL definition for model objects from schemas files (stored on disk).
+ The static methods of this class operates over the parser context of the calling thread (see SchemaParserContext)
+ so each thread has its own buffer, PostgreSQL version and unknown attributes flag. The compiled templates are
+ shared by all threads.
 \note <strong>Creation date:</strong> 19/06/2008
 */
 
@@ -31,100 +34,32 @@
 #include <vector>
 #include <QDir>
 #include <QTextStream>
+#include <QFileInfo>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QThreadStorage>
 #include "xmlparser.h"
+#include "schematemplate.h"
+#include "schemaparsercontext.h"
+#include "profiler.h"
 
 class SchemaParser {
 	private:
-		/*! \brief Indicates that the parser should ignore unknown
-		 attributes avoiding raising exceptions */
-		static bool ignore_unk_atribs;
-
-		static const char CHR_COMMENT,			//! \brief Character that starts a comment
-											CHR_LINE_END,			//! \brief Character that indicates end of line
-											CHR_SPACE,        //! \brief Character that indicates spacing
-											CHR_TABULATION,   //! \brief Character that indicates tabulation
-											CHR_INI_ATTRIB,   //! \brief Character that indicates a reference to an attribute
-											CHR_MID_ATTRIB,   //! \brief Character that delimits on the left the attribute name
-											CHR_END_ATTRIB,   //! \brief Character that delimits on the right the attribute name
-											CHR_INI_CONDITIONAL,//! \brief Character that starts a conditional instruction
-											CHR_INI_METACHAR,   //! \brief Character that starts a metacharacter
-											CHR_INI_PURETEXT,   //! \brief Character that starts a puretext
-											CHR_END_PURETEXT;   //! \brief Character that ends a puretext
-
-		//! \brief Tokens related to conditional instructions
-		static const QString	TOKEN_IF,  // %if
-													TOKEN_THEN,// %then
-													TOKEN_ELSE,// %else
-													TOKEN_END, // %end
-													TOKEN_OR,  // %or
-													TOKEN_NOT, // %not
-													TOKEN_AND; // %and
-
-		//! \brief Tokens related to metacharacters
-		static const QString	TOKEN_META_SP,// $sp (space)
-													TOKEN_META_BR,// $br (line break)
-													TOKEN_META_TB,// $tb (tabulation)
-													TOKEN_META_OB,// $ob (open bracket '[')
-													TOKEN_META_CB;// $cb (close bracket ']')
-
-
-		//! \brief Get an attribute name from the buffer on the current position
-		static QString getAttribute(void);
-
-		//! \brief Get an conditional instruction from the buffer on the current position
-		static QString getConditional(void);
-
-		//! \brief Get an metacharacter from the buffer on the current position
-		static QString getMetaCharacter(void);
-
-		/*! \brief Returns the result (true|false) of conditional expression evaluation.
-		The expression is evaluated from the left to the right and not support Polish Notation, so
-		as the parser finds an attribute evaluates it and stores the result, when find another one
-		evaluates and compare with previous evaluation, and so on. Example:
-
-		Let's suppose a1 and a2 has values and a3 is empty, the following expression
-		results will be:
-
-				%if @{a1} %or @{a2} %and {a3} %then --> FALSE
-				%if @{a1} %or @{a2} %and %not {a3} %then --> TRUE
-				%if @{a1} %or %not @{a3} %then --> TRUE
-				%if @{a1} %and @{a3} %then --> FALSE
-		*/
-		static bool evaluateExpression(void);
-
-		/*! \brief Get an word from the buffer on the current position (word is any string that isn't
-		 a conditional instruction or comment) */
-		static QString getWord(void);
-
-		//! \brief Gets a pure text, ignoring elements of the language
-		static QString getPureText(void);
-
-		/*! \brief Returns whether a character is special i.e. indicators of attributes
-		 or conditional instructions */
-		static bool isSpecialCharacter(char chr);
-
 		/*! \brief Converts any chars (operators) < > " to the respective XML entities. This method is only
 		called when generating XML code and only tag attributes are treated.*/
 		static QString convertCharsToXMLEntities(QString buf);
 
-		//! \brief Filename that was loaded by the parser
-		static QString filename;
-
-		/*! \brief Vectorial representation of the loaded file. This is the buffer that is
-		 analyzed by de parser */
-		static vector<QString> buffer;
+		//! \brief Parser context of each thread that makes use of the static methods
+		static QThreadStorage<SchemaParserContext *> contexts;
 
-		static unsigned line, //! \brief Current line where the parser reading is
-										column, //! \brief Current column where the parser reading is
+		//! \brief Mutex that controls the access to the templates cache
+		static QMutex templates_mutex;
 
-										/*! \brief Comment line ammout extracted. This attribute is used to make the correct
-										 reference to the line on file that has syntax errors */
-										comment_count;
+		//! \brief Compiled templates cache shared by all threads. The key is the path to the schema file
+		static map<QString, QSharedPointer<SchemaTemplate> > templates;
 
-		static map<QString, QString> attributes;
-
-		//! \brief PostgreSQL version currently used by the parser
-		static QString pgsql_version;
+		//! \brief Timer that measures the code generation of all threads (see getCodeDefinition())
+		static Profiler::Entry *code_def_tm;
 
 	public:
 
@@ -137,26 +72,45 @@ class SchemaParser {
 		static constexpr unsigned SQL_DEFINITION=0,
 															XML_DEFINITION=1;
 
+		/*! \brief Converts the chars < > " to XML entities (see convertCharsToXMLEntities(QString)) keeping the
+		 comment state between calls (in_comment). This permits to convert a large XML code in pieces as long
+		 as each piece contains only complete lines */
+		static QString convertCharsToXMLEntities(QString buf, bool &in_comment);
+
+		//! \brief Returns the parser context of the calling thread (created on the first call)
+		static SchemaParserContext &getContext(void);
+
+		/*! \brief Returns the compiled template for the specified schema file. The file is loaded and compiled only
+		 in the first call or when its modification date or size changes, otherwise the cached template is returned.
+		 This method can be safely called from any thread */
+		static QSharedPointer<SchemaTemplate> getTemplate(const QString &filename);
+
+		//! \brief Removes all the compiled templates from the cache
+		static void clearTemplates(void);
+
 		/*! \brief Set the version of PostgreSQL to be adopted by the parser in obtaining
 		 the definition of the objects. This function should always be called at
 		 software startup or when the user wants to change the default version
-		 of the database */
+		 of the database. Threads that generate code must set the version on their own context */
 		static void setPgSQLVersion(const QString &pgsql_ver);
 
 		/*! \brief Returns the complete xml/sql definition for an database object represented by the
 		 map 'attributes'. For SQL definition is necessary to indicate the version of PostgreSQL
 		 in order to the to correct schema be loaded */
 		static QString getCodeDefinition(const QString &obj_name, map<QString, QString> &attribs, unsigned def_type);
+		static QString getCodeDefinition(const QString &obj_name, AttributesMap &attribs, unsigned def_type);
 
 		/*! \brief Generic method that loads a schema file and for a given map of attributes
 		 this method returns the data of the file analyzed and filled with the values ​​of the
 		 attributes map */
 		static QString getCodeDefinition(const QString &filename, map<QString, QString> &attribs);
+		static QString getCodeDefinition(const QString &filename, AttributesMap &attribs);
 
 		/*! \brief Generic method that interprets a pre-specified buffer (see loadBuffer()) and for a given map
 		 of attributes this method returns the data of the buffer analyzed and filled with the values ​​of the
 		 attributes map */
 		static QString getCodeDefinition(map<QString, QString> &attribs);
+		static QString getCodeDefinition(AttributesMap &attribs);
 
 		//! \brief Loads the buffer with a string
 		static void loadBuffer(const QString &buf);
@@ -176,6 +130,8 @@ class SchemaParser {
 
 		//! \brief Set if the parser must ignore unknown attributes avoiding expcetion throwing
 		static void setIgnoreUnkownAttributes(bool ignore);
+
+		friend class SchemaParserContext;
 };
 
 #endif
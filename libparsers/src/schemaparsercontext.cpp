@@ -0,0 +1,828 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "schemaparsercontext.h"
+#include "schemaparser.h"
+
+const char SchemaParserContext::CHR_COMMENT='#';
+const char SchemaParserContext::CHR_LINE_END='\n';
+const char SchemaParserContext::CHR_TABULATION='\t';
+const char SchemaParserContext::CHR_SPACE=' ';
+const char SchemaParserContext::CHR_INI_ATTRIB='@';
+const char SchemaParserContext::CHR_MID_ATTRIB='{';
+const char SchemaParserContext::CHR_END_ATTRIB='}';
+const char SchemaParserContext::CHR_INI_CONDITIONAL='%';
+const char SchemaParserContext::CHR_INI_METACHAR='$';
+const char SchemaParserContext::CHR_INI_PURETEXT='[';
+const char SchemaParserContext::CHR_END_PURETEXT=']';
+
+const QString SchemaParserContext::TOKEN_IF="if";
+const QString SchemaParserContext::TOKEN_THEN="then";
+const QString SchemaParserContext::TOKEN_ELSE="else";
+const QString SchemaParserContext::TOKEN_END="end";
+const QString SchemaParserContext::TOKEN_OR="or";
+const QString SchemaParserContext::TOKEN_AND="and";
+const QString SchemaParserContext::TOKEN_NOT="not";
+
+const QString SchemaParserContext::TOKEN_META_SP="sp";
+const QString SchemaParserContext::TOKEN_META_BR="br";
+const QString SchemaParserContext::TOKEN_META_TB="tb";
+const QString SchemaParserContext::TOKEN_META_OB="ob";
+const QString SchemaParserContext::TOKEN_META_CB="cb";
+
+SchemaParserContext::SchemaParserContext(void)
+{
+	ignore_unk_atribs=false;
+	line=column=comment_count=0;
+	pgsql_version=SchemaParser::PGSQL_VERSION_92;
+}
+
+void SchemaParserContext::setPgSQLVersion(const QString &pgsql_ver)
+{
+	if(!pgsql_ver.isEmpty() &&
+		 (pgsql_ver < SchemaParser::PGSQL_VERSION_90 || pgsql_ver > SchemaParser::PGSQL_VERSION_92))
+		throw Exception(Exception::getErrorMessage(ERR_INV_POSTGRESQL_VERSION)
+										.arg(pgsql_ver)
+										.arg(SchemaParser::PGSQL_VERSION_90 + ", " + SchemaParser::PGSQL_VERSION_91 + ", " + SchemaParser::PGSQL_VERSION_92),
+										ERR_INV_POSTGRESQL_VERSION,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(!pgsql_ver.isEmpty())
+		this->pgsql_version=pgsql_ver;
+	else
+		this->pgsql_version=SchemaParser::PGSQL_VERSION_92;
+}
+
+QString SchemaParserContext::getPgSQLVersion(void)
+{
+	return(pgsql_version);
+}
+
+void SchemaParserContext::restartParser(void)
+{
+	/* Clears the buffer and resets the counters for line,
+		column and amount of comments */
+	buffer.clear();
+	line=column=comment_count=0;
+}
+
+void SchemaParserContext::loadBuffer(const QString &buf)
+{
+	QString buf_aux=buf, lin;
+	QTextStream ts(&buf_aux);
+	int pos=0;
+
+	//Prepares the parser to do new reading
+	restartParser();
+
+	//While the input file doesn't reach the end
+	while(!ts.atEnd())
+	{
+		//Get one line from stream (until the last char before \n)
+		lin=ts.readLine();
+
+		/* Since the method getline discards the \n when the line was just a line break
+		its needed to treat it in order to not lost it */
+		if(lin=="") lin+=CHR_LINE_END;
+
+		//If the entire line is commented out increases the comment lines counter
+		if(lin[0]==CHR_COMMENT) comment_count++;
+
+		//Looking for the position of other comment characters for deletion
+		pos=lin.indexOf(CHR_COMMENT);
+
+		//Removes the characters from the found position
+		if(pos >= 0)
+			lin.remove(pos, lin.size());
+
+		if(lin!="")
+		{
+			//Add a line break in case the last character is not
+			if(lin[lin.size()-1]!=CHR_LINE_END)
+				lin+=CHR_LINE_END;
+
+			//Add the treated line in the buffer
+			buffer.push_back(lin);
+		}
+	}
+}
+
+void SchemaParserContext::loadFile(const QString &filename)
+{
+	if(filename!="")
+	{
+		QFile input;
+		QString buf;
+
+		//Open the file for reading
+		input.setFileName(filename);
+		input.open(QFile::ReadOnly);
+
+		if(!input.isOpen())
+			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(filename),
+											ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		buf=input.readAll();
+		input.close();
+
+		//Loads the parser buffer
+		loadBuffer(buf);
+		this->filename=filename;
+	}
+}
+
+QString SchemaParserContext::getAttribute(void)
+{
+	QString atrib, current_line, str_aux;
+	bool start_attrib, end_attrib, error=false;
+
+	//Get the current line from the buffer
+	current_line=buffer[line];
+
+	/* Only start extracting an attribute if it starts with a @
+		even if the current character is an attribute delimiter */
+	if(current_line[column]==CHR_INI_ATTRIB)
+	{
+		//Step to the next column in the line
+		column++;
+
+		/* The next character must be one { because this starts the delimitation
+		 of the attribute name. If not this indicates an error */
+		if(current_line[column]!=CHR_MID_ATTRIB)
+			error=true;
+		else
+		{
+			//Marks the flag indicating start of attribute
+			start_attrib=true;
+			//Unmarks the flag indicating end of attribute
+			end_attrib=false;
+			//Step to the next column that contains the first letter of the attribute name
+			column++;
+
+			/* Attempt to extract an attribute until a space, end of line
+			or attribute is encountered */
+			while(current_line[column]!=CHR_LINE_END &&
+						current_line[column]!=CHR_SPACE &&
+						current_line[column]!=CHR_TABULATION &&
+						!end_attrib && !error)
+			{
+				if(current_line[column]!=CHR_END_ATTRIB)
+					atrib+=current_line[column];
+				else if(current_line[column]==CHR_END_ATTRIB && atrib!="")
+					end_attrib=true;
+				else
+					error=true;
+				column++;
+			}
+
+			/* If the attribute has been started but not finished
+			ie absence of the } in its statement (ie. @{attr),
+			generates an error. */
+			if(start_attrib && !end_attrib) error=true;
+		}
+	}
+	else error=true;
+
+	if(error)
+	{
+		//Raise a syntax error
+		str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+						.arg(filename).arg((line + comment_count + 1)).arg((column+1));
+		throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(atrib);
+}
+
+QString SchemaParserContext::getWord(void)
+{
+	QString word, current_line;
+
+	//Gets the current line buffer
+	current_line=buffer[line];
+
+	/* Attempt to extract a word if the first character is not
+		a special character. */
+	if(!isSpecialCharacter(current_line[column].toLatin1()))
+	{
+		/* Extract the word while it is not end of line, space or
+		 special character */
+		while(current_line[column]!=CHR_LINE_END &&
+					!isSpecialCharacter(current_line[column].toLatin1()) &&
+					current_line[column]!=CHR_SPACE &&
+					current_line[column]!=CHR_TABULATION)
+		{
+			word+=current_line[column];
+			column++;
+		}
+	}
+
+	return(word);
+}
+
+QString SchemaParserContext::getPureText(void)
+{
+	QString text, current_line, str_aux;
+	bool error=false;
+
+	current_line=buffer[line];
+
+	//Attempt to extract a pure text if the first character is a [
+	if(current_line[column]==CHR_INI_PURETEXT)
+	{
+		//Moves to the next character that contains the beginning of the text
+		column++;
+
+		/* Extracts the text while the end of pure text (]), end of buffer or
+		 beginning of other pure text ([) is reached */
+		while(current_line[column]!=CHR_END_PURETEXT &&
+					line < buffer.size() &&
+					current_line[column]!=CHR_INI_PURETEXT)
+		{
+			text+=current_line[column];
+
+			/* Special case to end of line. Unlike other elements of
+			language, a pure text can be extracted until the end of the buffer,
+			thus, this method also controls the lines transitions */
+			if(current_line[column]==CHR_LINE_END)
+			{
+				//Step to the next line
+				line++;
+				column=0;
+				current_line=buffer[line];
+			}
+			else column++;
+		}
+
+		if(current_line[column]==CHR_END_PURETEXT)
+			column++;
+		else
+			error=true;
+	}
+	else error=true;
+
+	if(error)
+	{
+		str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+						.arg(filename).arg((line + comment_count + 1)).arg((column+1));
+
+		throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(text);
+}
+
+QString SchemaParserContext::getConditional(void)
+{
+	QString conditional, current_line, str_aux;
+	bool error=false;
+
+	current_line=buffer[line];
+
+	//Will initiate extraction if a % is found
+	if(current_line[column]==CHR_INI_CONDITIONAL)
+	{
+		/* Passa para o próximo caractere que é o início do
+		 do nome da palavra condicional */
+		column++;
+
+		/* Moves to the next character that is the beginning of
+		 the name of the conditional word */
+		while(current_line[column]!=CHR_LINE_END &&
+					current_line[column]!=CHR_SPACE &&
+					current_line[column]!=CHR_TABULATION)
+		{
+			conditional+=current_line[column];
+			column++;
+		}
+
+		//If no word was extracted an error is raised
+		if(conditional=="") error=true;
+	}
+	else error=true;
+
+	if(error)
+	{
+		str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+						.arg(filename).arg(line + comment_count + 1).arg(column+1);
+		throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(conditional);
+}
+
+QString SchemaParserContext::getMetaCharacter(void)
+{
+	QString meta, current_line, str_aux;
+	bool error=false;
+
+	current_line=buffer[line];
+
+	//Begins the extraction in case of a $ is found
+	if(current_line[column]==CHR_INI_METACHAR)
+	{
+		//Moves to the next character that is the beginning of the metacharacter
+		column++;
+
+		//Extracts the metacharacter until doesn't finds a space or end of line
+		while(current_line[column]!=CHR_LINE_END &&
+					current_line[column]!=CHR_SPACE &&
+					current_line[column]!=CHR_TABULATION)
+		{
+			meta+=current_line[column];
+			column++;
+		}
+
+		//If no metacharacter was extracted an error is raised
+		if(meta=="") error=true;
+	}
+	else error=true;
+
+	if(error)
+	{
+		str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+						.arg(filename).arg(line + comment_count + 1).arg(column+1);
+		throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(meta);
+}
+
+bool SchemaParserContext::isSpecialCharacter(char chr)
+{
+	return(chr==CHR_INI_ATTRIB || chr==CHR_MID_ATTRIB ||
+				 chr==CHR_END_ATTRIB || chr==CHR_INI_CONDITIONAL ||
+				 chr==CHR_INI_METACHAR || chr==CHR_INI_PURETEXT ||
+				 chr==CHR_END_PURETEXT);
+}
+
+void SchemaParserContext::compileExpression(vector<SchemaTemplate::ExpressionTerm> &expression, SchemaTemplate &tmpl)
+{
+	QString current_line, cond, attrib, prev_cond;
+	bool error=false, end_eval=false;
+	unsigned attrib_count=0, and_or_count=0;
+	SchemaTemplate::ExpressionTerm term;
+	unsigned slot=0;
+
+	try
+	{
+		current_line=buffer[line];
+
+		while(!end_eval && !error)
+		{
+			//Eliminates any black space
+			while(current_line[column]==CHR_SPACE ||
+						current_line[column]==CHR_TABULATION) column++;
+
+			switch(current_line[column].toLatin1())
+			{
+				//Extract the next conditional token
+				case CHR_INI_CONDITIONAL:
+					prev_cond=cond;
+					cond=getConditional();
+
+								//Error 1: %if @{a} %or %or %then
+					error=(cond==prev_cond ||
+								 //Error 2: %if @{a} %and %or %then
+								 (cond==TOKEN_AND && prev_cond==TOKEN_OR) ||
+								 //Error 3: %if @{a} %or %and %then
+								 (cond==TOKEN_OR && prev_cond==TOKEN_AND) ||
+								 //Error 4: %if %and @{a} %then
+								 (attrib_count==0 && (cond==TOKEN_AND || cond==TOKEN_OR)));
+
+					if(cond==TOKEN_THEN)
+					{
+						/* Returns the parser to the token %then because additional
+						operations is done whe this token is found */
+						column-=cond.length()+1;
+						end_eval=true;
+
+									//Error 1: %if @{a} %not %then
+						error=(prev_cond==TOKEN_NOT ||
+									//Error 2: %if %then
+									attrib_count==0 ||
+									//Error 3: %if @{a} %and %then
+									(and_or_count!=attrib_count-1));
+					}
+					else if(cond==TOKEN_OR || cond==TOKEN_AND)
+						and_or_count++;
+				break;
+
+				case CHR_INI_ATTRIB:
+					attrib=getAttribute();
+
+					/* Stores the reference to the attribute. The checking of unknown attributes
+						 is made only when the template is executed */
+					slot=tmpl.addAttributeRef(attrib, line + comment_count + 1, column + 1, true);
+
+					//Error 1: A conditional token other than %or %not %and if found on conditional expression
+					error=(!cond.isEmpty() && cond!=TOKEN_OR && cond!=TOKEN_AND && cond!=TOKEN_NOT) ||
+								//Error 2: A %not token if found after an attribute: %if @{a} %not %then
+								(attrib_count > 0 && cond==TOKEN_NOT && prev_cond.isEmpty()) ||
+								//Error 3: Two attributes not separated by any conditional token: %if @{a} @{b} %then
+								(attrib_count > 0 && cond.isEmpty());
+
+					//Increments the extracted attribute counter
+					attrib_count++;
+
+					if(!error)
+					{
+						term.slot=slot;
+
+						//Appliyng the NOT operator if found
+						term.negate=(cond==TOKEN_NOT);
+
+						//Storing the AND/OR operation if the token is found
+						if(cond==TOKEN_AND || prev_cond==TOKEN_AND)
+							term.oper=SchemaTemplate::OPER_AND;
+						else if(cond==TOKEN_OR || prev_cond==TOKEN_OR)
+							term.oper=SchemaTemplate::OPER_OR;
+						else
+							term.oper=SchemaTemplate::OPER_NONE;
+
+						expression.push_back(term);
+						cond.clear();
+						prev_cond.clear();
+					}
+				break;
+
+				default:
+					error=true;
+				break;
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),	__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	if(error)
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+										.arg(filename).arg((line + comment_count + 1)).arg((column+1)),
+										ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+template<class Attribs>
+QString SchemaParserContext::getObjectDefinition(const QString &obj_name, Attribs &attribs, unsigned def_type)
+{
+	try
+	{
+		if(obj_name!="")
+		{
+			QString filename;
+
+			if(def_type==SchemaParser::SQL_DEFINITION)
+			{
+				vector<QString> vers;
+
+				//Formats the filename
+				filename=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
+								 GlobalAttributes::SQL_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR + obj_name + GlobalAttributes::SCHEMA_EXT;
+
+				SchemaParser::getPgSQLVersions(vers);
+				while(!vers.empty())
+				{
+					//Setting the @{pgsql[VERSION]} attribute in other to know which version is being used
+					attribs[QString("pgsql" + vers.back()).remove(".")]=(vers.back()==pgsql_version ? pgsql_version : "");
+					vers.pop_back();
+				}
+
+				//Try to get the object definitin from the specified path
+				return(getFileDefinition(filename, attribs));
+			}
+			else
+			{
+				filename=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
+								 GlobalAttributes::XML_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR + obj_name +
+								 GlobalAttributes::SCHEMA_EXT;
+
+				return(SchemaParser::convertCharsToXMLEntities(getFileDefinition(filename, attribs)));
+			}
+		}
+		else return("");
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),	__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+}
+
+void SchemaParserContext::setIgnoreUnkownAttributes(bool ignore)
+{
+	ignore_unk_atribs=ignore;
+}
+
+void SchemaParserContext::compileBuffer(SchemaTemplate &tmpl)
+{
+	QString atrib, cond, prev_cond, word, meta, str_aux;
+	bool error=false;
+	char chr;
+	SchemaTemplate::Instruction instr, cond_instr;
+	vector<SchemaTemplate::Instruction> *block=nullptr;
+
+	/* Stack of the conditional instructions being compiled (the last one is the innermost 'if')
+		 and the flags indicating that the 'then' and 'else' tokens were found for each one */
+	vector<SchemaTemplate::Instruction> if_stack;
+	vector<bool> vet_tk_then, vet_tk_else;
+
+	tmpl.filename=filename;
+	tmpl.instructions.clear();
+	tmpl.attrib_refs.clear();
+	tmpl.slot_indexes.clear();
+	tmpl.slot_names.clear();
+	tmpl.slot_ids.clear();
+	tmpl.attrib_id_count=0;
+
+	while(line < buffer.size())
+	{
+		chr=buffer[line][column].toLatin1();
+
+		/* Gets the block that receives the instructions: the root of the template when the parser
+			 is not in 'if / else' or the 'if' or 'else' section of the innermost 'if' */
+		if(if_stack.empty())
+			block=&tmpl.instructions;
+		else if(vet_tk_then.back() && !vet_tk_else.back())
+			block=&if_stack.back().if_block;
+		else if(vet_tk_else.back())
+			block=&if_stack.back().else_block;
+		else
+			block=nullptr;
+
+		switch(chr)
+		{
+			/* Increments the number of rows causing the parser
+			to get the next line buffer for analysis */
+			case CHR_LINE_END:
+				line++;
+				column=0;
+			break;
+
+			case CHR_TABULATION:
+			case CHR_SPACE:
+				//The parser will ignore the spaces that are not within pure texts
+				while(buffer[line][column]==CHR_SPACE ||
+							buffer[line][column]==CHR_TABULATION) column++;
+			break;
+
+				//Metacharacter extraction
+			case CHR_INI_METACHAR:
+				meta=getMetaCharacter();
+
+				//Checks whether the extracted token is valid metacharacter
+				if(meta!=TOKEN_META_SP && meta!=TOKEN_META_TB &&
+					 meta!=TOKEN_META_BR && meta!=TOKEN_META_OB &&
+					 meta!=TOKEN_META_CB)
+				{
+					str_aux=QString(Exception::getErrorMessage(ERR_INV_METACHARACTER))
+									.arg(meta).arg(filename).arg(line + comment_count +1).arg(column+1);
+
+
+					throw Exception(str_aux,ERR_INV_METACHARACTER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				}
+				//Checks whether the metacharacter is part of the  'if' expression (this is an error)
+				else if(!if_stack.empty() && !vet_tk_then.back())
+				{
+					str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+									.arg(filename).arg(line + comment_count +1).arg(column+1);
+
+					throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				}
+				else
+				{
+					//Converting the metacharacter drawn to the character that represents this
+					if(meta==TOKEN_META_SP) chr=CHR_SPACE;
+					else if(meta==TOKEN_META_TB) chr=CHR_TABULATION;
+					else if(meta==TOKEN_META_OB) chr=CHR_INI_PURETEXT; //Currently this constant is used since it returns '[' (open bracket)
+					else if(meta==TOKEN_META_CB) chr=CHR_END_PURETEXT; //Currently this constant is used since it returns ']' (close bracket)
+					else chr=CHR_LINE_END;
+
+					//Metacharacters are stored as literal texts
+					instr=SchemaTemplate::Instruction();
+					instr.type=SchemaTemplate::INS_TEXT;
+					instr.value+=chr;
+
+					if(block)
+						SchemaTemplate::appendInstruction(*block, instr);
+				}
+			break;
+
+				//Attribute extraction
+			case CHR_INI_ATTRIB:
+			case CHR_MID_ATTRIB:
+			case CHR_END_ATTRIB:
+				atrib=getAttribute();
+
+				/* Stores the reference to the attribute. The checking of unknown attributes
+					 is made only when the template is executed */
+				instr=SchemaTemplate::Instruction();
+				instr.type=SchemaTemplate::INS_ATTRIBUTE;
+				instr.line=line + comment_count + 1;
+				instr.column=column + 1;
+				instr.slot=tmpl.addAttributeRef(atrib, instr.line, instr.column, false);
+
+				if(block)
+					SchemaTemplate::appendInstruction(*block, instr);
+			break;
+
+				//Conditional instruction extraction
+			case CHR_INI_CONDITIONAL:
+				prev_cond=cond;
+				cond=getConditional();
+
+				//Checks whether the extracted token is a valid conditional
+				if(cond!=TOKEN_IF && cond!=TOKEN_ELSE &&
+					 cond!=TOKEN_THEN && cond!=TOKEN_END &&
+					 cond!=TOKEN_OR && cond!=TOKEN_NOT &&
+					 cond!=TOKEN_AND)
+				{
+					str_aux=QString(Exception::getErrorMessage(ERR_INV_CONDITIONAL))
+									.arg(cond).arg(filename).arg(line + comment_count +1).arg(column+1);
+					throw Exception(str_aux,ERR_INV_CONDITIONAL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				}
+				else
+				{
+					//If the toke is an 'if'
+					if(cond==TOKEN_IF)
+					{
+						//Compiles the if expression and opens a new conditional block
+						instr=SchemaTemplate::Instruction();
+						instr.type=SchemaTemplate::INS_CONDITIONAL;
+						instr.line=line + comment_count + 1;
+						instr.column=column + 1;
+						compileExpression(instr.expression, tmpl);
+
+						if_stack.push_back(instr);
+						vet_tk_then.push_back(false);
+						vet_tk_else.push_back(false);
+					}
+					//If the parser is in 'if / else' and one 'then' token is found
+					else if(cond==TOKEN_THEN && !if_stack.empty())
+						vet_tk_then.back()=true;
+					//If the parser is in 'if / else' and a 'else' token is found
+					else if(cond==TOKEN_ELSE && !if_stack.empty())
+						vet_tk_else.back()=true;
+					//Case the parser is in 'if/else' and a 'end' token was found
+					else if(cond==TOKEN_END && !if_stack.empty())
+					{
+						//Closes the current 'if' moving it to the 'if' or 'else' section of the above 'if' (or to the root)
+						cond_instr=if_stack.back();
+						if_stack.pop_back();
+						vet_tk_then.pop_back();
+						vet_tk_else.pop_back();
+
+						if(if_stack.empty())
+							block=&tmpl.instructions;
+						else if(!vet_tk_else.back())
+							block=&if_stack.back().if_block;
+						else
+							block=&if_stack.back().else_block;
+
+						block->push_back(cond_instr);
+					}
+					else
+						error=true;
+
+					if(!error)
+					{
+						/* Verifying that the conditional words appear in a valid  order if not
+						 the parser generates an error. Correct order means IF before THEN,
+						 ELSE after IF and before END */
+						if((prev_cond==TOKEN_IF && cond!=TOKEN_THEN) ||
+							 (prev_cond==TOKEN_ELSE && cond!=TOKEN_IF && cond!=TOKEN_END) ||
+							 (prev_cond==TOKEN_THEN && cond==TOKEN_THEN))
+							error=true;
+					}
+
+					if(error)
+					{
+						str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+										.arg(filename).arg(line + comment_count +1).arg(column+1);
+						throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+					}
+				}
+			break;
+
+				//Extraction of pure text or simple words
+			default:
+				if(chr==CHR_INI_PURETEXT ||
+					 chr==CHR_END_PURETEXT)
+					word=getPureText();
+				else
+					word=getWord();
+
+				/* In case the word/text be inside 'if' expression, the parser returns an error
+				 because only an attribute must be on the 'if' expression  */
+				if(!if_stack.empty() && !vet_tk_then.back())
+				{
+					str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+									.arg(filename).arg(line + comment_count +1).arg(column+1);
+					throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				}
+				else if(block)
+				{
+					instr=SchemaTemplate::Instruction();
+					instr.type=SchemaTemplate::INS_TEXT;
+					instr.value=word;
+					SchemaTemplate::appendInstruction(*block, instr);
+				}
+			break;
+		}
+	}
+
+	/* If has more 'if' toknes than  'end' tokens, this indicates that some 'if' in code
+	was not closed thus the parser returns an error */
+	if(!if_stack.empty())
+	{
+		str_aux=QString(Exception::getErrorMessage(ERR_INVALID_SYNTAX))
+						.arg(filename).arg(line + comment_count +1).arg(column+1);
+		throw Exception(str_aux,ERR_INVALID_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+template<class Attribs>
+QString SchemaParserContext::getBufferDefinition(Attribs &attribs)
+{
+	QString object_def;
+
+	//In case the file was successfuly loaded
+	if(buffer.size() > 0)
+	{
+		SchemaTemplate tmpl;
+
+		compileBuffer(tmpl);
+		object_def=tmpl.execute(attribs, ignore_unk_atribs);
+	}
+
+	restartParser();
+	ignore_unk_atribs=false;
+	return(object_def);
+}
+
+template<class Attribs>
+QString SchemaParserContext::getFileDefinition(const QString &filename, Attribs &attribs)
+{
+	try
+	{
+		QString object_def;
+
+		//Without a file name the parser interprets the current buffer (see loadBuffer())
+		if(filename.isEmpty())
+			return(getBufferDefinition(attribs));
+
+		object_def=SchemaParser::getTemplate(filename)->execute(attribs, ignore_unk_atribs);
+		ignore_unk_atribs=false;
+
+		return(object_def);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+QString SchemaParserContext::getCodeDefinition(const QString &obj_name, map<QString, QString> &attribs, unsigned def_type)
+{
+	return(getObjectDefinition(obj_name, attribs, def_type));
+}
+
+QString SchemaParserContext::getCodeDefinition(const QString &obj_name, AttributesMap &attribs, unsigned def_type)
+{
+	return(getObjectDefinition(obj_name, attribs, def_type));
+}
+
+QString SchemaParserContext::getCodeDefinition(const QString &filename, map<QString, QString> &attribs)
+{
+	return(getFileDefinition(filename, attribs));
+}
+
+QString SchemaParserContext::getCodeDefinition(const QString &filename, AttributesMap &attribs)
+{
+	return(getFileDefinition(filename, attribs));
+}
+
+QString SchemaParserContext::getCodeDefinition(map<QString, QString> &attribs)
+{
+	return(getBufferDefinition(attribs));
+}
+
+QString SchemaParserContext::getCodeDefinition(AttributesMap &attribs)
+{
+	return(getBufferDefinition(attribs));
+}
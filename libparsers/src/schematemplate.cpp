@@ -0,0 +1,208 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "schematemplate.h"
+#include <algorithm>
+
+SchemaTemplate::SchemaTemplate(void)
+{
+	file_size=0;
+	attrib_id_count=0;
+}
+
+bool SchemaTemplate::isUpToDate(const QFileInfo &fi) const
+{
+	return(fi.exists() && fi.lastModified()==last_modified && fi.size()==file_size);
+}
+
+QString SchemaTemplate::getFilename(void) const
+{
+	return(filename);
+}
+
+void SchemaTemplate::appendInstruction(vector<Instruction> &block, const Instruction &instr)
+{
+	if(instr.type==INS_TEXT && !block.empty() && block.back().type==INS_TEXT)
+		block.back().value+=instr.value;
+	else
+		block.push_back(instr);
+}
+
+unsigned SchemaTemplate::addAttributeRef(const QString &attrib, unsigned line, unsigned column, bool in_expression)
+{
+	AttributeRef ref;
+	QHash<QString, unsigned>::iterator itr=slot_indexes.find(attrib);
+	unsigned slot;
+
+	//Creates a new slot only on the first reference to the attribute
+	if(itr==slot_indexes.end())
+	{
+		slot=slot_names.size();
+		slot_indexes[attrib]=slot;
+		slot_names.push_back(attrib);
+		slot_ids.push_back(AttributeIdTable::getId(attrib));
+		attrib_id_count=std::max(attrib_id_count, slot_ids.back() + 1);
+	}
+	else
+		slot=itr.value();
+
+	ref.slot=slot;
+	ref.line=line;
+	ref.column=column;
+	ref.in_expression=in_expression;
+	attrib_refs.push_back(ref);
+
+	return(slot);
+}
+
+bool SchemaTemplate::evaluateExpression(const vector<ExpressionTerm> &expression, const vector<QString *> &values) const
+{
+	vector<ExpressionTerm>::const_iterator itr=expression.begin(), itr_end=expression.end();
+	QString *value=nullptr;
+	bool expr_is_true=true, attrib_true;
+
+	/* The expression is evaluated from the left to the right exactly as the
+		 conditional expressions are interpreted by the SchemaParser */
+	while(itr!=itr_end)
+	{
+		value=values[itr->slot];
+		attrib_true=(value && !value->isEmpty());
+
+		//Appliyng the NOT operator if found
+		if(itr->negate)
+			attrib_true=!attrib_true;
+
+		if(itr->oper==OPER_AND)
+			expr_is_true=(expr_is_true && attrib_true);
+		else if(itr->oper==OPER_OR)
+			expr_is_true=(expr_is_true || attrib_true);
+		else
+			expr_is_true=attrib_true;
+
+		itr++;
+	}
+
+	return(expr_is_true);
+}
+
+void SchemaTemplate::executeInstructions(const vector<Instruction> &instrs, const vector<QString *> &values, QString &code_def) const
+{
+	vector<Instruction>::const_iterator itr=instrs.begin(), itr_end=instrs.end();
+	QString *value=nullptr;
+
+	while(itr!=itr_end)
+	{
+		if(itr->type==INS_TEXT)
+			code_def+=itr->value;
+		else if(itr->type==INS_ATTRIBUTE)
+		{
+			value=values[itr->slot];
+
+			//If the attribute has no value set raises an exception
+			if(!value || value->isEmpty())
+			{
+				throw Exception(QString(Exception::getErrorMessage(ERR_UNDEF_ATTRIB_VALUE))
+												.arg(slot_names[itr->slot]).arg(filename).arg(itr->line).arg(itr->column),
+												ERR_UNDEF_ATTRIB_VALUE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			code_def+=*value;
+		}
+		else if(evaluateExpression(itr->expression, values))
+			executeInstructions(itr->if_block, values, code_def);
+		else
+			executeInstructions(itr->else_block, values, code_def);
+
+		itr++;
+	}
+}
+
+void SchemaTemplate::checkAttributes(const vector<QString *> &values, bool ignore_unk_attribs, vector<unsigned> &unk_slots) const
+{
+	vector<AttributeRef>::const_iterator itr=attrib_refs.begin(), itr_end=attrib_refs.end();
+
+	/* Checks if all the attributes referenced by the template belongs to the passed list of attributes.
+		 This is done before the execution because the attributes inside conditional blocks not
+		 executed must be validated as well */
+	while(itr!=itr_end)
+	{
+		if(!values[itr->slot])
+		{
+			if(!ignore_unk_attribs)
+			{
+				throw Exception(QString(Exception::getErrorMessage(ERR_UNK_ATTRIBUTE))
+												.arg(slot_names[itr->slot]).arg(filename).arg(itr->line).arg(itr->column),
+												ERR_UNK_ATTRIBUTE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+			//Attributes out of conditional expressions are created with empty values
+			else if(!itr->in_expression)
+				unk_slots.push_back(itr->slot);
+		}
+		itr++;
+	}
+}
+
+QString SchemaTemplate::execute(map<QString, QString> &attribs, bool ignore_unk_attribs) const
+{
+	map<QString, QString>::iterator itr_attr;
+	vector<QString *> values(slot_names.size(), nullptr);
+	vector<unsigned> unk_slots;
+	unsigned slot;
+	QString code_def;
+
+	//Resolves the value of each distinct attribute only once (std::map keeps the values addresses)
+	for(slot=0; slot < slot_names.size(); slot++)
+	{
+		itr_attr=attribs.find(slot_names[slot]);
+
+		if(itr_attr!=attribs.end())
+			values[slot]=&itr_attr->second;
+	}
+
+	checkAttributes(values, ignore_unk_attribs, unk_slots);
+
+	for(slot=0; slot < unk_slots.size(); slot++)
+		values[unk_slots[slot]]=&attribs[slot_names[unk_slots[slot]]];
+
+	executeInstructions(instructions, values, code_def);
+	return(code_def);
+}
+
+QString SchemaTemplate::execute(AttributesMap &attribs, bool ignore_unk_attribs) const
+{
+	vector<QString *> values(slot_ids.size(), nullptr);
+	vector<unsigned> unk_slots;
+	unsigned slot;
+	QString code_def;
+
+	/* Grows the map to hold all the attributes referenced by the template so the creation
+		 of the unknown attributes doesn't move the values already resolved */
+	attribs.reserve(attrib_id_count);
+
+	//The values are obtained directly by the ids resolved while compiling the template
+	for(slot=0; slot < slot_ids.size(); slot++)
+		values[slot]=attribs.find(slot_ids[slot]);
+
+	checkAttributes(values, ignore_unk_attribs, unk_slots);
+
+	for(slot=0; slot < unk_slots.size(); slot++)
+		values[unk_slots[slot]]=&attribs[slot_ids[unk_slots[slot]]];
+
+	executeInstructions(instructions, values, code_def);
+	return(code_def);
+}
@@ -0,0 +1,150 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class SchemaTemplate
+\brief Stores the compiled form (instruction tree) of a schema file. The template is created once
+ by the SchemaParser and then executed as many times as needed against different attributes maps
+ avoiding the reading and the interpretation of the same file on each code generation.
+ Each distinct attribute referenced by the template receives a slot while compiling, so the instructions
+ refer to the attributes by the slot index. The slots also store the interned ids of the attributes (see AttributeIdTable)
+ so, when executed against an AttributesMap, the values are obtained by indexing the map without any string comparison.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef SCHEMA_TEMPLATE_H
+#define SCHEMA_TEMPLATE_H
+
+#include "exception.h"
+#include "attributesmap.h"
+#include <QHash>
+#include <map>
+#include <vector>
+#include <QDateTime>
+#include <QFileInfo>
+
+class SchemaTemplate {
+	public:
+		//! \brief Constants used to identify the instructions of the template
+		static constexpr unsigned INS_TEXT=0, //! \brief Literal text (words, pure texts and metacharacters)
+															INS_ATTRIBUTE=1, //! \brief Reference to an attribute value: @{attribute}
+															INS_CONDITIONAL=2; //! \brief Conditional block: %if [expr] %then [instr] %else [instr] %end
+
+		//! \brief Constants used to identify the operator that joins a term to the previous ones in a conditional expression
+		static constexpr unsigned OPER_NONE=0,
+															OPER_AND=1,
+															OPER_OR=2;
+
+		//! \brief Stores a single term of a conditional expression, e.g.: %and %not @{attribute}
+		struct ExpressionTerm {
+			unsigned slot, oper;
+			bool negate;
+		};
+
+		/*! \brief Stores a reference to an attribute done in any part of the template. This is used to check
+		 the presence of all attributes on the passed map before the execution of the template */
+		struct AttributeRef {
+			unsigned slot, line, column;
+			bool in_expression;
+		};
+
+		//! \brief Stores a node of the instruction tree
+		struct Instruction {
+			unsigned type, line, column;
+
+			//! \brief Stores the text (INS_TEXT)
+			QString value;
+
+			//! \brief Slot of the referenced attribute (INS_ATTRIBUTE)
+			unsigned slot;
+
+			//! \brief Conditional expression and the blocks executed when it's true (if_block) or false (else_block)
+			vector<ExpressionTerm> expression;
+			vector<Instruction> if_block, else_block;
+		};
+
+	private:
+		//! \brief Name of the file that originated the template (used in error messages)
+		QString filename;
+
+		//! \brief Modification date and size of the source file at the moment of the compilation
+		QDateTime last_modified;
+		qint64 file_size;
+
+		//! \brief Root instructions of the template
+		vector<Instruction> instructions;
+
+		//! \brief All the attributes references in the order they appear on the source file
+		vector<AttributeRef> attrib_refs;
+
+		//! \brief Names of the attributes stored in each slot
+		vector<QString> slot_names;
+
+		//! \brief Interned ids of the attributes stored in each slot
+		vector<unsigned> slot_ids;
+
+		//! \brief Greatest attribute id referenced by the template plus one
+		unsigned attrib_id_count;
+
+		//! \brief Slot of each attribute name (used only while compiling the template)
+		QHash<QString, unsigned> slot_indexes;
+
+		/*! \brief Returns the slot of the attribute creating it if needed and stores the reference
+		 to the attribute made on the specified position of the source file */
+		unsigned addAttributeRef(const QString &attrib, unsigned line, unsigned column, bool in_expression);
+
+		/*! \brief Returns the result (true|false) of the conditional expression against the attributes values
+		 (indexed by slot, a null value indicates an attribute not present on the map) */
+		bool evaluateExpression(const vector<ExpressionTerm> &expression, const vector<QString *> &values) const;
+
+		/*! \brief Checks if all the attributes referenced by the template have a value (indexed by slot). The slots of the
+		 unknown attributes that must be created with empty values are stored on 'unk_slots' when 'ignore_unk_attribs' is true,
+		 otherwise an error is raised */
+		void checkAttributes(const vector<QString *> &values, bool ignore_unk_attribs, vector<unsigned> &unk_slots) const;
+
+		//! \brief Executes recursively the instructions appending the generated code on 'code_def'
+		void executeInstructions(const vector<Instruction> &instrs, const vector<QString *> &values, QString &code_def) const;
+
+		/*! \brief Appends an instruction on the specified block. Consecutive literal texts are merged
+		 in a single instruction to reduce the size of the tree */
+		static void appendInstruction(vector<Instruction> &block, const Instruction &instr);
+
+	public:
+		SchemaTemplate(void);
+
+		/*! \brief Returns if the template still reflects the contents of the file represented
+		 by the passed file info (same modification date and size) */
+		bool isUpToDate(const QFileInfo &fi) const;
+
+		//! \brief Returns the file name used to compile the template
+		QString getFilename(void) const;
+
+		/*! \brief Executes the template returning the generated code. When 'ignore_unk_attribs' is true
+		 unknown attributes are created with empty values on the map instead of raising errors */
+		QString execute(map<QString, QString> &attribs, bool ignore_unk_attribs) const;
+
+		/*! \brief Executes the template against an attributes map indexed by ids. This is the form
+		 used by the model objects and avoids any search by name on the attributes */
+		QString execute(AttributesMap &attribs, bool ignore_unk_attribs) const;
+
+		friend class SchemaParser;
+		friend class SchemaParserContext;
+};
+
+#endif
@@ -0,0 +1,158 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "xmlfragment.h"
+#include "xmlparser.h"
+
+XMLFragment::XMLFragment(const QByteArray &code, int line, qint64 end_offset)
+{
+	this->code=code;
+	this->line=line;
+	this->end_offset=end_offset;
+	doc=nullptr;
+	elem=nullptr;
+	has_error=false;
+}
+
+XMLFragment::~XMLFragment(void)
+{
+	if(doc)
+		xmlFreeDoc(doc);
+}
+
+void XMLFragment::parse(const QByteArray &xml_decl, const QString &root_name, xmlDtd *dtd)
+{
+	QByteArray buffer, root=root_name.toUtf8();
+	xmlError *xml_error=nullptr;
+	QString msg, file;
+	int line_offset;
+
+	//The element is the only child of the wrapper so the navigation works as in the original document
+	buffer+=xml_decl;
+	buffer+="<" + root + ">";
+	buffer+=code;
+	buffer+="</" + root + ">";
+
+	//Discounts the lines of the XML declaration so the line numbers refer to the original file
+	line_offset=(line - 1) - xml_decl.count('\n');
+
+	xmlResetLastError();
+	doc=xmlReadMemory(buffer.constData(), buffer.size(), nullptr, nullptr, XMLParserContext::PARSER_OPTIONS);
+
+	if(doc && !xmlGetLastError())
+	{
+		elem=xmlDocGetRootElement(doc)->children;
+
+		while(elem && elem->type!=XML_ELEMENT_NODE)
+			elem=elem->next;
+
+		if(elem && (!dtd || XMLParser::validateElement(doc, elem, dtd)))
+		{
+			indexElement(elem, line_offset);
+
+			//The code isn't needed anymore since the element tree is available
+			code.clear();
+			return;
+		}
+	}
+
+	xml_error=xmlGetLastError();
+	has_error=true;
+
+	if(xml_error)
+	{
+		msg=xml_error->message;
+		file=xml_error->file;
+		if(!file.isEmpty()) file="("+file+")";
+		msg.replace("\n"," ");
+	}
+
+	error=Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+									.arg(xml_error ? xml_error->line + line_offset : line)
+									.arg(xml_error ? xml_error->int2 : 0).arg(msg).arg(file),
+									ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
+void XMLFragment::indexElement(xmlNode *node, int line_offset)
+{
+	map<QString, QString> &attribs=attributes[node];
+	xmlAttr *elem_attribs=node->properties;
+	xmlNode *child=node->children;
+	int node_line;
+
+	while(elem_attribs)
+	{
+		attribs[QString(reinterpret_cast<const char *>(elem_attribs->name))]=
+				QString(reinterpret_cast<char *>(elem_attribs->children->content));
+		elem_attribs=elem_attribs->next;
+	}
+
+	//libxml2 stores the line numbers using 16 bits
+	node_line=node->line + line_offset;
+	node->line=(node_line > 65535 ? 65535 : node_line);
+
+	while(child)
+	{
+		if(child->type==XML_ELEMENT_NODE)
+			indexElement(child, line_offset);
+		else
+		{
+			node_line=child->line + line_offset;
+			child->line=(node_line > 65535 ? 65535 : node_line);
+		}
+
+		child=child->next;
+	}
+}
+
+xmlNode *XMLFragment::getElement(void)
+{
+	return(elem);
+}
+
+xmlNode *XMLFragment::getRootElement(void)
+{
+	return(doc ? xmlDocGetRootElement(doc) : nullptr);
+}
+
+bool XMLFragment::getElementAttributes(const xmlNode *node, map<QString, QString> &attribs)
+{
+	QHash<const xmlNode *, map<QString, QString> >::const_iterator itr=attributes.constFind(node);
+
+	if(itr==attributes.constEnd())
+		return(false);
+
+	attribs=itr.value();
+	return(true);
+}
+
+int XMLFragment::getLine(void)
+{
+	return(line);
+}
+
+qint64 XMLFragment::getEndOffset(void)
+{
+	return(end_offset);
+}
+
+void XMLFragment::raiseError(void)
+{
+	if(has_error)
+		throw Exception(error.getErrorMessage(), error.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
+}
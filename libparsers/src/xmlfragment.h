@@ -0,0 +1,98 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class XMLFragment
+\brief Stores the code of a single top-level element read from a document stream (see XMLParser::openXMLStream())
+ and the element tree and attributes extracted from it. The fragments are parsed by several threads at the
+ same time (see XMLFragmentTask) and, after that, are only read by the thread that owns the stream.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef XML_FRAGMENT_H
+#define XML_FRAGMENT_H
+
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#include <QHash>
+#include <QByteArray>
+#include "exception.h"
+#include <map>
+
+class XMLFragment {
+	private:
+		//! \brief Code of the element (as read from the file)
+		QByteArray code;
+
+		//! \brief Line on the file where the element starts
+		int line;
+
+		//! \brief Position on the file right after the end of the element
+		qint64 end_offset;
+
+		//! \brief Document generated from the code. The element is wrapped by an element with the root name
+		xmlDoc *doc;
+
+		//! \brief Reference to the element on the document
+		xmlNode *elem;
+
+		//! \brief Attributes of each element on the fragment extracted during the parsing
+		QHash<const xmlNode *, map<QString, QString> > attributes;
+
+		//! \brief Indicates that the parsing failed. The error is stored and raised only when the element is used
+		bool has_error;
+
+		//! \brief Error raised while parsing the fragment
+		Exception error;
+
+		/*! \brief Stores the attributes of the element and its children and moves the line numbers of
+		 the nodes by the specified offset (so they refer to the lines on the file) */
+		void indexElement(xmlNode *node, int line_offset);
+
+	public:
+		XMLFragment(const QByteArray &code, int line, qint64 end_offset);
+		~XMLFragment(void);
+
+		/*! \brief Parses the code of the fragment wrapping it with the root element of the original document.
+		 The XML declaration must be the same as the original document in order to use the same encoding.
+		 When a DTD is specified the element is validated against it. This method doesn't raise errors,
+		 they are stored on the fragment (see raiseError()). It can be called from any thread */
+		void parse(const QByteArray &xml_decl, const QString &root_name, xmlDtd *dtd);
+
+		//! \brief Returns the element parsed from the fragment
+		xmlNode *getElement(void);
+
+		//! \brief Returns the root element (wrapper) of the document generated from the fragment
+		xmlNode *getRootElement(void);
+
+		/*! \brief Copies to the map the attributes of the specified element extracted during the parsing.
+		 Returns false if the element doesn't belong to the fragment */
+		bool getElementAttributes(const xmlNode *node, map<QString, QString> &attribs);
+
+		//! \brief Returns the line on the file where the element starts
+		int getLine(void);
+
+		//! \brief Returns the position on the file right after the end of the element
+		qint64 getEndOffset(void);
+
+		//! \brief Raises the error generated during the parsing, if any
+		void raiseError(void);
+};
+
+#endif
@@ -0,0 +1,45 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "xmlfragmenttask.h"
+
+XMLFragmentTask::XMLFragmentTask(vector<XMLFragment *> &fragments, QAtomicInt &next_frag,
+																 const QByteArray &xml_decl, const QString &root_name, xmlDtd *dtd)
+{
+	this->fragments=&fragments;
+	this->next_frag=&next_frag;
+	this->xml_decl=xml_decl;
+	this->root_name=root_name;
+	this->dtd=dtd;
+
+	//The task is destroyed by the parser context after all tasks finish
+	setAutoDelete(false);
+}
+
+void XMLFragmentTask::run(void)
+{
+	int idx, count=fragments->size();
+
+	while(true)
+	{
+		idx=next_frag->fetchAndAddOrdered(1);
+		if(idx >= count) break;
+
+		fragments->at(idx)->parse(xml_decl, root_name, dtd);
+	}
+}
@@ -0,0 +1,61 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class XMLFragmentTask
+\brief Implements a worker used by XMLParserContext to parse several fragments of a document stream at the
+ same time. Each task picks the next fragment not yet parsed from a shared list, so the fragments can be
+ consumed in the original order after all tasks finish.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef XML_FRAGMENT_TASK_H
+#define XML_FRAGMENT_TASK_H
+
+#include <QRunnable>
+#include <QAtomicInt>
+#include <vector>
+#include "xmlfragment.h"
+
+class XMLFragmentTask: public QRunnable {
+	private:
+		//! \brief Fragments to be parsed
+		vector<XMLFragment *> *fragments;
+
+		//! \brief Index of the next fragment to be parsed (shared between all tasks)
+		QAtomicInt *next_frag;
+
+		//! \brief XML declaration of the original document
+		QByteArray xml_decl;
+
+		//! \brief Name of the root element of the original document
+		QString root_name;
+
+		//! \brief DTD used to validate the fragments (null when no validation is needed)
+		xmlDtd *dtd;
+
+	public:
+		XMLFragmentTask(vector<XMLFragment *> &fragments, QAtomicInt &next_frag,
+										const QByteArray &xml_decl, const QString &root_name, xmlDtd *dtd);
+
+		//! \brief Parses the fragments until the list ends
+		void run(void);
+};
+
+#endif
@@ -18,14 +18,11 @@
 
 #include "xmlparser.h"
 
-QString XMLParser::xml_doc_filename="";
-QString XMLParser::xml_buffer="";
-QString XMLParser::dtd_decl="";
-QString XMLParser::xml_decl="";
-xmlNode *XMLParser::root_elem=nullptr;
-xmlNode *XMLParser::curr_elem=nullptr;
-xmlDoc *XMLParser::xml_doc=nullptr;
-stack<xmlNode*> XMLParser::elems_stack;
+QThreadStorage<vector<QSharedPointer<XMLParserContext> > *> XMLParser::contexts;
+QMutex XMLParser::dtds_mutex;
+map<QString, xmlDtd *> XMLParser::dtds;
+bool XMLParser::trusted_files=true;
+const QString XMLParser::CHECKSUM_MARK="<!-- pgmodeler-checksum: ";
 
 const QString XMLParser::CHAR_AMP="&amp;";
 const QString XMLParser::CHAR_LT="&lt;";
@@ -38,373 +35,350 @@ XMLParser::~XMLParser(void)
 	restartParser();
 }
 
-void XMLParser::removeDTD(void)
+XMLParserContext &XMLParser::getContext(void)
 {
-	int pos1=-1, pos2=-1, pos3=-1, len;
+	//Creates the first context of the calling thread on its first use
+	if(!contexts.hasLocalData())
+		contexts.setLocalData(new vector<QSharedPointer<XMLParserContext> >(1, QSharedPointer<XMLParserContext>(new XMLParserContext)));
 
-	if(!xml_buffer.isEmpty())
-	{
-		/* Removes the current DTD from document.
-		 If the user attempts to manipulate the structure of
-		 document damaging its integrity. */
-		pos1=xml_buffer.indexOf("<!DOCTYPE");
-		pos2=xml_buffer.indexOf("]>\n");
-		pos3=xml_buffer.indexOf("\">\n");
-		if(pos1 >=0 && (pos2 >=0 || pos3 >= 0))
-		{
-			len=((pos2 > pos3) ? (pos2-pos1)+3 :  (pos3-pos2)+3);
-			xml_buffer.replace(pos1,len,"");
-		}
-	}
+	return(*contexts.localData()->back());
 }
 
-void XMLParser::loadXMLFile(const QString &filename)
+void XMLParser::pushContext(void)
+{
+	getContext();
+	contexts.localData()->push_back(QSharedPointer<XMLParserContext>(new XMLParserContext));
+}
+
+void XMLParser::popContext(void)
 {
-	try
+	getContext();
+
+	//The context is destroyed together with its element tree and stream
+	if(contexts.localData()->size() > 1)
+		contexts.localData()->pop_back();
+}
+
+unsigned XMLParser::getContextCount(void)
+{
+	getContext();
+	return(contexts.localData()->size());
+}
+
+xmlDtd *XMLParser::getDTD(const QString &dtd_file)
+{
+	static Profiler::Entry *hits_cnt=Profiler::getCounter("xml-parser.dtd-cache-hits"),
+												 *parsed_cnt=Profiler::getCounter("xml-parser.dtds-parsed");
+	QString path=QFileInfo(dtd_file).absoluteFilePath();
+	QMutexLocker locker(&dtds_mutex);
+	map<QString, xmlDtd *>::iterator itr=dtds.find(path);
+	xmlValidCtxt *valid_ctxt=nullptr;
+	xmlNode *node=nullptr;
+	xmlDtd *dtd=nullptr;
+
+	if(itr==dtds.end())
 	{
-		QFile input;
-		QString buffer;
+		xmlResetLastError();
+
+		//Parses the DTD and the external entities referenced by it (other DTD files)
+		dtd=xmlParseDTD(nullptr, reinterpret_cast<const xmlChar *>(path.toUtf8().constData()));
 
-		if(filename!="")
+		if(!dtd)
 		{
-			//Opens a file stream using the file name
-			input.setFileName(filename);
-			input.open(QFile::ReadOnly);
+			xmlError *xml_error=xmlGetLastError();
+			QString msg=(xml_error ? QString(xml_error->message).replace("\n"," ") : "");
 
-			//Case the file opening was not sucessful
-			if(!input.isOpen())
-			{
-				throw Exception(QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename),
-												ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-			}
+			throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+											.arg(xml_error ? xml_error->line : 0).arg(xml_error ? xml_error->int2 : 0)
+											.arg(msg).arg("(" + path + ")"),
+											ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
 
-			buffer=input.readAll();
-			input.close();
+		/* The content models of the elements are built by libxml2 on their first validation. Building them
+			 here makes the validation a read-only operation over the DTD so it can be done by several threads */
+		valid_ctxt=xmlNewValidCtxt();
 
-			xml_doc_filename=filename;
-			loadXMLBuffer(buffer);
+		for(node=dtd->children; node; node=node->next)
+		{
+			if(node->type==XML_ELEMENT_DECL)
+				xmlValidBuildContentModel(valid_ctxt, reinterpret_cast<xmlElement *>(node));
 		}
+
+		xmlFreeValidCtxt(valid_ctxt);
+
+		dtds[path]=dtd;
+		parsed_cnt->increment();
+		return(dtd);
 	}
-	catch(Exception &e)
+
+	hits_cnt->increment();
+	return(itr->second);
+}
+
+void XMLParser::clearDTDs(void)
+{
+	QMutexLocker locker(&dtds_mutex);
+	map<QString, xmlDtd *>::iterator itr=dtds.begin();
+
+	while(itr!=dtds.end())
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		xmlFreeDtd(itr->second);
+		itr++;
 	}
+
+	dtds.clear();
 }
 
-void XMLParser::loadXMLBuffer(const QString &xml_buf)
+bool XMLParser::validateElement(xmlDoc *doc, xmlNode *elem, xmlDtd *dtd, bool attribs_only)
 {
-	try
-	{
-		int pos1=-1, pos2=-1, tam=0;
+	//The DTD isn't modified during the validation (see getDTD()) so this method can be called by any thread
+	xmlValidCtxt *valid_ctxt=nullptr;
+	xmlDtd *ext_subset=nullptr;
+	xmlAttr *attrib=nullptr;
+	int valid=1;
+
+	if(!doc || !dtd)
+		return(false);
 
-		if(xml_buf.isEmpty())
-			throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	valid_ctxt=xmlNewValidCtxt();
 
-		pos1=xml_buf.indexOf("<?xml");
-		pos2=xml_buf.indexOf("?>");
-		xml_buffer=xml_buf;
+	if(!elem)
+		valid=xmlValidateDtd(valid_ctxt, doc, dtd);
+	else
+	{
+		//The DTD is temporarily attached to the document so the declarations can be found
+		ext_subset=doc->extSubset;
+		doc->extSubset=dtd;
 
-		if(pos1 >= 0 && pos2 >= 0)
+		if(attribs_only)
 		{
-			tam=(pos2-pos1)+3;
-			xml_decl=xml_buffer.mid(pos1, tam);
-			xml_buffer.replace(pos1,tam,"");
+			attrib=elem->properties;
+
+			while(attrib && valid)
+			{
+				valid=xmlValidateOneAttribute(valid_ctxt, doc, elem, attrib,
+																			(attrib->children ? attrib->children->content : nullptr));
+				attrib=attrib->next;
+			}
 		}
 		else
-			xml_decl="<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+			valid=xmlValidateElement(valid_ctxt, doc, elem);
 
-		removeDTD();
-		readBuffer();
-	}
-	catch(Exception &e)
-	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		doc->extSubset=ext_subset;
 	}
+
+	xmlFreeValidCtxt(valid_ctxt);
+	return(valid==1);
 }
 
-void XMLParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
+void XMLParser::setTrustedFilesEnabled(bool value)
 {
-	QString fmt_dtd_file;
-
-	if(dtd_file.isEmpty())
-		throw Exception(ERR_ASG_EMPTY_DTD_FILE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	trusted_files=value;
+}
 
-	if(dtd_name.isEmpty())
-		throw Exception(ERR_ASG_EMPTY_DTD_NAME,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+bool XMLParser::isTrustedFilesEnabled(void)
+{
+	return(trusted_files);
+}
 
-	#ifndef Q_OS_WIN
-		fmt_dtd_file="file://";
-	#else
-		fmt_dtd_file="file:///";
-	#endif
+bool XMLParser::isTrustedFile(const QString &filename)
+{
+	bool trusted=false;
 
-	//Formats the dtd file path in order to replace spaces by %20 (url format)
-	fmt_dtd_file+=QFileInfo(dtd_file).absoluteFilePath();
-	dtd_decl="<!DOCTYPE " + dtd_name + " SYSTEM " + "\"" +  fmt_dtd_file.replace(QString(" "),QString("%20")) + "\">\n";
+	getFileHash(filename, &trusted);
+	return(trusted);
 }
 
-void XMLParser::readBuffer(void)
+void XMLParser::appendChecksum(QFile &file)
 {
-	QByteArray buffer;
-	QString msg, file;
-	xmlError *xml_error=nullptr;
-	int parser_opt;
+	QCryptographicHash hash(QCryptographicHash::Sha1);
 
-	if(!xml_buffer.isEmpty())
-	{
-		//Inserts the XML declaration
-		buffer+=xml_decl;
+	file.flush();
+	file.seek(0);
 
-		//Configures the parser, initially, to not validate the document against the dtd
-		parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT );
+	while(!file.atEnd())
+		hash.addData(file.read(65536));
 
-		//If the dtd declarions is setup
-		if(!dtd_decl.isEmpty())
-		{
-			//Inserts the default software DTD declarion into XML buffer
-			buffer+=dtd_decl;
+	file.write(QString(CHECKSUM_MARK + hash.result().toHex() + " -->\n").toUtf8());
+}
 
-			//Now configures the parser to validate the buffer against the DTD
-			parser_opt=(parser_opt | XML_PARSE_DTDLOAD | XML_PARSE_DTDVALID);
-		}
+QByteArray XMLParser::getFileHash(const QString &filename, bool *trusted)
+{
+	QFile input(filename);
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+	QByteArray tail, buffer, checksum, result;
+	qint64 size=0, tail_size=0, data_size=0;
+	int pos=-1;
 
-		buffer+=xml_buffer;
+	if(trusted)
+		(*trusted)=false;
 
-		//Create an xml document from the buffer
-		xml_doc=xmlReadMemory(buffer.data(), buffer.size(),	nullptr, nullptr, parser_opt);
+	input.open(QFile::ReadOnly);
 
-		//In case the document criation fails, gets the last xml parser error
-		xml_error=xmlGetLastError();
+	if(!input.isOpen())
+		return(QByteArray());
 
-		//If some error is set
-		if(xml_error)
-		{
-			//Formats the error
-			msg=xml_error->message;
-			file=xml_error->file;
-			if(!file.isEmpty()) file="("+file+")";
-			msg.replace("\n"," ");
+	//The checksum comment is searched only on the end of the file
+	size=input.size();
+	tail_size=qMin<qint64>(size, 256);
+	input.seek(size - tail_size);
+	tail=input.read(tail_size);
+	pos=tail.lastIndexOf(CHECKSUM_MARK.toUtf8());
 
-			//Restarts the parser
-			if(xml_doc) restartParser();
+	//Nothing but the checksum comment can exist after the data
+	if(pos >= 0)
+	{
+		checksum=tail.mid(pos + CHECKSUM_MARK.size()).trimmed();
 
-			//Raise an exception with the error massege from the parser xml
-			throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
-											.arg(xml_error->line).arg(xml_error->int2).arg(msg).arg(file),
-											ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		if(checksum.endsWith("-->"))
+		{
+			checksum.chop(3);
+			checksum=checksum.trimmed();
 		}
+		else
+			pos=-1;
+	}
+
+	//The hash is calculated over the data that precedes the checksum comment (or the whole file when it doesn't exist)
+	data_size=(pos >= 0 ? size - tail_size + pos : size);
+	input.seek(0);
 
-		//Gets the referênce to the root element on the document
-		root_elem=curr_elem=xmlDocGetRootElement(xml_doc);
+	while(data_size > 0)
+	{
+		buffer=input.read(qMin<qint64>(data_size, 65536));
+		if(buffer.isEmpty()) break;
 
-		//Cleanup the allocated parser variables
-		if(xml_doc) xmlCleanupParser();
+		hash.addData(buffer);
+		data_size-=buffer.size();
 	}
+
+	if(data_size > 0)
+		return(QByteArray());
+
+	result=hash.result();
+
+	if(trusted)
+		(*trusted)=(pos >= 0 && result.toHex()==checksum);
+
+	return(result);
 }
 
-void XMLParser::savePosition(void)
+void XMLParser::loadXMLFile(const QString &filename)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	getContext().loadXMLFile(filename);
+}
 
-	elems_stack.push(curr_elem);
+void XMLParser::loadXMLBuffer(const QString &xml_buf)
+{
+	getContext().loadXMLBuffer(xml_buf);
 }
 
-void XMLParser::restorePosition(void)
+void XMLParser::openXMLStream(const QString &filename, unsigned threads)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	getContext().openXMLStream(filename, threads);
+}
 
-	if(elems_stack.empty())
-		curr_elem=root_elem;
-	else
-	{
-		curr_elem=elems_stack.top();
-		elems_stack.pop();
-	}
+bool XMLParser::readNextStreamElement(void)
+{
+	return(getContext().readNextStreamElement());
 }
 
-void XMLParser::restorePosition(const xmlNode *elem)
+int XMLParser::getStreamProgress(void)
 {
-	if(!elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-	else if(elem->doc!=xml_doc)
-		throw Exception(ERR_OPR_INEXIST_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	return(getContext().getStreamProgress());
+}
 
-	restartNavigation();
-	curr_elem=const_cast<xmlNode *>(elem);
+void XMLParser::closeXMLStream(void)
+{
+	getContext().closeXMLStream();
 }
 
-void XMLParser::restartNavigation(void)
+void XMLParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	getContext().setDTDFile(dtd_file, dtd_name);
+}
 
-	curr_elem=root_elem;
+void XMLParser::savePosition(void)
+{
+	getContext().savePosition();
+}
 
-	while(!elems_stack.empty())
-		elems_stack.pop();
+void XMLParser::restorePosition(void)
+{
+	getContext().restorePosition();
 }
 
-void XMLParser::restartParser(void)
+void XMLParser::restorePosition(const xmlNode *elem)
 {
-	root_elem=curr_elem=nullptr;
-	if(xml_doc)
-	{
-		xmlFreeDoc(xml_doc);
-		xml_doc=nullptr;
-	}
-	dtd_decl=xml_buffer=xml_decl="";
+	getContext().restorePosition(elem);
+}
 
-	while(!elems_stack.empty())
-		elems_stack.pop();
+void XMLParser::restartNavigation(void)
+{
+	getContext().restartNavigation();
+}
 
-	xmlResetLastError();
-	xml_doc_filename="";
+void XMLParser::restartParser(void)
+{
+	getContext().restartParser();
 }
 
 bool XMLParser::accessElement(unsigned elem_type)
 {
-	bool has_elem;
-	xmlNode *elems[4];
-
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	elems[ROOT_ELEMENT]=curr_elem->parent;
-	elems[CHILD_ELEMENT]=curr_elem->children;
-	elems[NEXT_ELEMENT]=curr_elem->next;
-	elems[PREVIOUS_ELEMENT]=curr_elem->prev;
-
-	/* Checks whether the current element has the element that
-		is to  be accessed. The flag 'has_elem' is also used
-		on the method return to indicate if the element has been
-		accessed or not. */
-	has_elem=hasElement(elem_type);
-
-	if(has_elem)
-		curr_elem=elems[elem_type];
-
-	return(has_elem);
+	return(getContext().accessElement(elem_type));
 }
 
-bool XMLParser::hasElement(unsigned tipo_elem)
+bool XMLParser::hasElement(unsigned elem_type)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	if(tipo_elem==ROOT_ELEMENT)
-		/* Returns the verification if the current element has a parent.
-		 The element must be different from the root, because the root element
-		 is not connected to a parent */
-		return(curr_elem!=root_elem && curr_elem->parent!=nullptr);
-	else if(tipo_elem==CHILD_ELEMENT)
-		//Returns the verification if the current element has children
-		return(curr_elem->children!=nullptr);
-	else if(tipo_elem==NEXT_ELEMENT)
-		return(curr_elem->next!=nullptr);
-	else
-		/* The second comparison in the expression is made for the root element
-		 because libxml2 places the previous element as the root itself */
-		return(curr_elem->prev!=nullptr && curr_elem->prev!=root_elem);
+	return(getContext().hasElement(elem_type));
 }
 
 bool XMLParser::hasAttributes(void)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	return(curr_elem->properties!=nullptr);
+	return(getContext().hasAttributes());
 }
 
 QString XMLParser::getElementContent(void)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	/* If the current element has  <![CDATA[]]> node returns the content of the CDATA instead
-	of return the content of the element itself */
-	if(curr_elem->next && curr_elem->next->type == XML_CDATA_SECTION_NODE)
-		return(QString(reinterpret_cast<char *>(curr_elem->next->content)));
-	else
-		//Return the content of the element when is not a CDATA node
-		return(QString(reinterpret_cast<char *>(curr_elem->content)));
+	return(getContext().getElementContent());
 }
 
 QString XMLParser::getElementName(void)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	return(QString(reinterpret_cast<const char *>(curr_elem->name)));
+	return(getContext().getElementName());
 }
 
 xmlElementType XMLParser::getElementType(void)
 {
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	return(curr_elem->type);
+	return(getContext().getElementType());
 }
 
 const xmlNode *XMLParser::getCurrentElement(void)
 {
-	return(curr_elem);
+	return(getContext().getCurrentElement());
 }
 
 void XMLParser::getElementAttributes(map<QString, QString> &attributes)
 {
-	xmlAttr *elem_attribs=nullptr;
-	QString attrib, value;
-
-	if(!root_elem)
-		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	//Always clears the passed attributes maps
-	attributes.clear();
-
-	//Gets the references to the element properties
-	elem_attribs=curr_elem->properties;
-
-	while(elem_attribs)
-	{
-		//Gets the attribute name
-		attrib=QString(reinterpret_cast<const char *>(elem_attribs->name));
-		//Gets the attribute value
-		value=QString(reinterpret_cast<char *>(elem_attribs->children->content));
-
-		/* Assigns to the attribute map in the index specified by the
-		 attribute name the obtained value */
-		attributes[attrib]=value;
-
-		//Step to the next element attribute
-		elem_attribs=elem_attribs->next;
-	}
+	getContext().getElementAttributes(attributes);
 }
 
 QString XMLParser::getLoadedFilename(void)
 {
-	return(xml_doc_filename);
+	return(getContext().getLoadedFilename());
 }
 
 QString XMLParser::getXMLBuffer(void)
 {
-	return(xml_buffer);
+	return(getContext().getXMLBuffer());
 }
 
 int XMLParser::getCurrentBufferLine(void)
 {
-	if(curr_elem)
-		return(curr_elem->line);
-	else
-		return(0);
+	return(getContext().getCurrentBufferLine());
 }
 
 int XMLParser::getBufferLineCount(void)
 {
-	if(xml_doc)
-		return(xml_doc->last->line);
-	else
-		return(0);
+	return(getContext().getBufferLineCount());
 }
-
@@ -19,59 +19,45 @@
 /**
 \ingroup libparsers
 \class XMLParser
-\brief This class implements basic operations of a xml analyzer encapsulating some functions implemented by libxml2 library
+\brief This class implements basic operations of a xml analyzer encapsulating some functions implemented by libxml2 library.
+ The static methods of this class operates over the current parser context of the calling thread (see XMLParserContext).
 \note <strong>Creation date:</strong> 02/04/2008
 */
 
 #ifndef XML_PARSER_H
 #define XML_PARSER_H
 
-#include <libxml/parser.h>
-#include <libxml/tree.h>
+#include "xmlparsercontext.h"
 #include "schemaparser.h"
 #include "exception.h"
 #include <map>
 #include <stack>
+#include <vector>
 #include <iostream>
+#include <QThreadStorage>
+#include <QSharedPointer>
+#include <QMutex>
+#include <QCryptographicHash>
 using namespace std;
 
 class XMLParser {
 	private:
-		/*! \brief Stores the name of the file that generated the xml buffer when
-		 loadXMLFile() method is called */
-		static QString xml_doc_filename;
-
-		//! \brief Stores the xml document (element tree) generated after the buffer reading
-		static xmlDoc *xml_doc;
-
-		//! \brief Stores the reference to the root element of the element tree
-		static xmlNode	*root_elem,
-										//! \brief Stores the current element that parser is analyzing
-										*curr_elem;
-
-		/*! \brief Stores the elements that marks the position in the tree before do
-		 a subsequent operation. To configure this element it is necessary
-		 call the method savePosition() and to return the navigation to the saved
-		 position is necessary call restorePosition() */
-		static stack<xmlNode *> elems_stack;
-
-		//! \brief Stores the document DTD declaration
-		static QString	dtd_decl,
-										//! \brief Stores XML document to be analyzed
-										xml_buffer,
-										/*! \brief Stores the declaration <?xml?>. If this isn't exists it will be
-										 a default declaration. */
-										xml_decl;
-
-		/*! \brief Remove the original DTD from the document. This is done to evit that
-		 the user insert some external dtd in the model file that is not valid for pgModeler */
-		static void removeDTD(void);
-
-		/*! \brief Makes the interpretation of XML inside the buffer validating it according to
-		 DTD defined configured (by the parser) to the buffer. Initializes
-		 the necessary attributes to make possible the navigation through the element tree
-		 generated from the XML document read. */
-		static void readBuffer(void);
+		/*! \brief Stack of parser contexts of each thread that makes use of the static methods. The methods
+		 operates over the context on the top of the stack */
+		static QThreadStorage<vector<QSharedPointer<XMLParserContext> > *> contexts;
+
+		//! \brief Mutex that controls the access to the DTDs cache and the validations made against the cached DTDs
+		static QMutex dtds_mutex;
+
+		/*! \brief DTDs parsed on the first use and shared by all contexts of all threads. The key is the
+		 absolute path to the DTD file */
+		static map<QString, xmlDtd *> dtds;
+
+		//! \brief Indicates that files with a valid checksum are read without DTD validation (see isTrustedFile())
+		static bool trusted_files;
+
+		//! \brief Comment that marks the checksum appended to the files written by pgModeler (see appendChecksum())
+		static const QString CHECKSUM_MARK;
 
 	public:
 		//! \brief Constants used to referência the elements on the element tree
@@ -89,12 +75,79 @@ class XMLParser {
 		XMLParser(void);
 		~XMLParser(void);
 
+		//! \brief Returns the current parser context of the calling thread (created on the first call)
+		static XMLParserContext &getContext(void);
+
+		/*! \brief Creates a new empty context over the current one. Subsequent calls operates over the new
+		 context until popContext() is called, so a buffer can be read without destroying the document
+		 (or the stream) being read on the previous context */
+		static void pushContext(void);
+
+		/*! \brief Destroys the current context returning to the previous one. The first context
+		 of the thread is never destroyed */
+		static void popContext(void);
+
+		//! \brief Returns the amount of contexts of the calling thread
+		static unsigned getContextCount(void);
+
+		/*! \brief Returns the DTD parsed from the specified file. The file is parsed only in the first call
+		 for each path, the subsequent calls return the cached DTD. This method can be safely called from any thread */
+		static xmlDtd *getDTD(const QString &dtd_file);
+
+		//! \brief Removes all the parsed DTDs from the cache. This must not be called while a context makes use of them
+		static void clearDTDs(void);
+
+		/*! \brief Validates the subtree of the element against the cached DTD. When no element is specified
+		 the whole document is validated. If 'attribs_only' is true only the attributes of the element are
+		 validated (used for elements which children aren't completely read yet). Returns false when
+		 the validation fails, in that case the error is available through xmlGetLastError() */
+		static bool validateElement(xmlDoc *doc, xmlNode *elem, xmlDtd *dtd, bool attribs_only=false);
+
+		/*! \brief Configures if files with a valid checksum (written by pgModeler) are read without DTD validation.
+		 This fast path is enabled by default */
+		static void setTrustedFilesEnabled(bool value);
+
+		//! \brief Returns if the files with a valid checksum are read without DTD validation
+		static bool isTrustedFilesEnabled(void);
+
+		/*! \brief Returns if the file ends with a checksum comment (see appendChecksum()) which matches
+		 the contents that precede it, meaning that the file was written by pgModeler and not modified since */
+		static bool isTrustedFile(const QString &filename);
+
+		/*! \brief Appends to the file a comment containing the checksum of its entire contents. The file must
+		 be opened for reading and writing */
+		static void appendChecksum(QFile &file);
+
+		/*! \brief Returns the SHA-1 hash of the contents of the file that precede its checksum comment, or of the
+		 entire contents when there is no such comment (empty if the file can't be read). The file is read only once
+		 and when 'trusted' is informed it stores if the hash matches the checksum comment (see isTrustedFile()) */
+		static QByteArray getFileHash(const QString &filename, bool *trusted=nullptr);
+
 		//! \brief Loads the XML buffer from a file
 		static void loadXMLFile(const QString &filename);
 
 		//! \brief Loads the XML buffer from a string
 		static void loadXMLBuffer(const QString &xml_buf);
 
+		/*! \brief Opens a file to be read one top-level element at a time instead of loading the entire document
+		 on memory. When this method returns the current element is the root one (only its attributes are
+		 available). The elements under the root are read through readNextStreamElement(). The DTD must be
+		 configured before calling this method (see setDTDFile()). When 'threads' is greater than 1 the elements
+		 are extracted from the file in batches and parsed (and validated) by that amount of threads while the
+		 calling thread consumes them in the same order they appear on the file */
+		static void openXMLStream(const QString &filename, unsigned threads=1);
+
+		/*! \brief Reads the next top-level element (child of the root) of the stream moving the navigation to it.
+		 The complete subtree of the element is available for the navigation methods while the previously read
+		 element is discarded. Returns false when there are no more elements to be read */
+		static bool readNextStreamElement(void);
+
+		//! \brief Returns the percentage of the streamed document already read
+		static int getStreamProgress(void);
+
+		//! \brief Closes the stream freeing all the elements read from it
+		static void closeXMLStream(void);
+
 		//! \brief Informs the DTD file used to make element validations
 		static void setDTDFile(const QString &dtd_file, const QString &dtd_name);
 
@@ -152,7 +205,7 @@ class XMLParser {
 		static void restartNavigation(void);
 
 		/*! \brief Reset all the parser attributes, deallocating the element tree. The user have to
-		 reload the file to analyze it again */
+		 reload the file to analyze it again. An open stream is kept untouched (see closeXMLStream()) */
 		static void restartParser(void);
 };
 
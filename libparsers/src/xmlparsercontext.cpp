@@ -0,0 +1,1031 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "xmlparsercontext.h"
+#include "xmlparser.h"
+#include "xmlfragmenttask.h"
+#include <algorithm>
+
+XMLParserContext::XMLParserContext(void)
+{
+	xml_doc=nullptr;
+	root_elem=curr_elem=stream_root=stream_elem=nullptr;
+	xml_reader=nullptr;
+	stream_file=nullptr;
+	stream_header_pos=0;
+	stream_size=0;
+	stream_validate=false;
+	stream_threads=1;
+	stream_pool=nullptr;
+	stream_doc=nullptr;
+	stream_buffer_pos=stream_line=0;
+	stream_buffer_offset=0;
+	stream_ended=false;
+	next_fragment=0;
+	curr_fragment=nullptr;
+	dtd=nullptr;
+}
+
+XMLParserContext::~XMLParserContext(void)
+{
+	closeXMLStream();
+	restartParser();
+}
+
+void XMLParserContext::removeDTD(void)
+{
+	int pos1=-1, pos2=-1, pos3=-1, len;
+
+	if(!xml_buffer.isEmpty())
+	{
+		/* Removes the current DTD from document.
+		 If the user attempts to manipulate the structure of
+		 document damaging its integrity. */
+		pos1=xml_buffer.indexOf("<!DOCTYPE");
+		pos2=xml_buffer.indexOf("]>\n");
+		pos3=xml_buffer.indexOf("\">\n");
+		if(pos1 >=0 && (pos2 >=0 || pos3 >= 0))
+		{
+			len=((pos2 > pos3) ? (pos2-pos1)+3 :  (pos3-pos2)+3);
+			xml_buffer.replace(pos1,len,"");
+		}
+	}
+}
+
+void XMLParserContext::loadXMLFile(const QString &filename)
+{
+	try
+	{
+		QFile input;
+		QString buffer;
+
+		if(filename!="")
+		{
+			//Opens a file stream using the file name
+			input.setFileName(filename);
+			input.open(QFile::ReadOnly);
+
+			//Case the file opening was not sucessful
+			if(!input.isOpen())
+			{
+				throw Exception(QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename),
+												ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			buffer=input.readAll();
+			input.close();
+
+			xml_doc_filename=filename;
+
+			//Files written by pgModeler itself (with a valid checksum) may skip the DTD validation
+			loadXMLBuffer(buffer, !(dtd && XMLParser::isTrustedFilesEnabled() && XMLParser::isTrustedFile(filename)));
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void XMLParserContext::loadXMLBuffer(const QString &xml_buf)
+{
+	try
+	{
+		loadXMLBuffer(xml_buf, true);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void XMLParserContext::loadXMLBuffer(const QString &xml_buf, bool validate)
+{
+	try
+	{
+		int pos1=-1, pos2=-1, tam=0;
+
+		if(xml_buf.isEmpty())
+			throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		pos1=xml_buf.indexOf("<?xml");
+		pos2=xml_buf.indexOf("?>");
+		xml_buffer=xml_buf;
+
+		if(pos1 >= 0 && pos2 >= 0)
+		{
+			tam=(pos2-pos1)+3;
+			xml_decl=xml_buffer.mid(pos1, tam);
+			xml_buffer.replace(pos1,tam,"");
+		}
+		else
+			xml_decl="<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+
+		removeDTD();
+		readBuffer(validate);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void XMLParserContext::setDTDFile(const QString &dtd_file, const QString &dtd_name)
+{
+	if(dtd_file.isEmpty())
+		throw Exception(ERR_ASG_EMPTY_DTD_FILE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(dtd_name.isEmpty())
+		throw Exception(ERR_ASG_EMPTY_DTD_NAME,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	//The DTD is parsed only on its first use, the subsequent calls reuse the cached one
+	this->dtd=XMLParser::getDTD(dtd_file);
+	this->dtd_name=dtd_name;
+}
+
+void XMLParserContext::readBuffer(bool validate)
+{
+	static Profiler::Entry *read_tm=Profiler::getTimer("xml-parser.read-buffer");
+	Profiler::Timer read_timer(read_tm);
+	QByteArray buffer;
+
+	if(!xml_buffer.isEmpty())
+	{
+		//Inserts the XML declaration
+		buffer+=xml_decl;
+		buffer+=xml_buffer;
+
+		/* Create an xml document from the buffer. The DTD isn't loaded by the parser since
+			 the document is validated against the cached DTD after being read */
+		xml_doc=xmlReadMemory(buffer.data(), buffer.size(),	nullptr, nullptr, PARSER_OPTIONS);
+
+		//Gets the referênce to the root element on the document
+		if(!xmlGetLastError())
+			root_elem=curr_elem=xmlDocGetRootElement(xml_doc);
+
+		try
+		{
+			//Validates the whole document against the DTD if it is configured
+			if(root_elem && dtd && validate)
+			{
+				validateRootName();
+
+				if(!XMLParser::validateElement(xml_doc, nullptr, dtd))
+					raiseXMLError();
+			}
+			//In case the document criation fails, gets the last xml parser error
+			else if(xmlGetLastError())
+				raiseXMLError();
+		}
+		catch(Exception &e)
+		{
+			//Restarts the parser
+			if(xml_doc) restartParser();
+			throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
+
+		/* Cleanup the allocated parser variables. This is not done while other contexts are in use
+		 because their documents and text readers still make use of the parser variables */
+		if(xml_doc && XMLParser::getContextCount()==1 && !xml_reader) xmlCleanupParser();
+	}
+}
+
+void XMLParserContext::raiseXMLError(void)
+{
+	xmlError *xml_error=xmlGetLastError();
+	QString msg, file;
+	int line=0, column=0;
+
+	//If some error is set
+	if(xml_error)
+	{
+		//Formats the error
+		msg=xml_error->message;
+		file=xml_error->file;
+		if(!file.isEmpty()) file="("+file+")";
+		msg.replace("\n"," ");
+		line=xml_error->line;
+		column=xml_error->int2;
+	}
+	//Errors without details (e.g. failures while reading the stream) are reported using the reader position
+	else if(xml_reader)
+	{
+		line=xmlTextReaderGetParserLineNumber(xml_reader);
+		column=xmlTextReaderGetParserColumnNumber(xml_reader);
+	}
+
+	//Raise an exception with the error massege from the parser xml
+	throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+									.arg(line).arg(column).arg(msg).arg(file),
+									ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
+void XMLParserContext::validateRootName(void)
+{
+	QString root_name=reinterpret_cast<const char *>(root_elem->name);
+
+	if(root_name!=dtd_name)
+		throw Exception(Exception::getErrorMessage(ERR_INV_XML_ROOT_ELEMENT).arg(root_name).arg(dtd_name),
+										ERR_INV_XML_ROOT_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
+void XMLParserContext::readStreamProlog(void)
+{
+	QByteArray prolog, end_tag;
+	int pos=0, start=0, end=0, subset=0;
+	bool is_decl, is_dtd;
+
+	xml_decl="";
+	prolog=stream_file->read(STREAM_CHUNK_SIZE);
+
+	/* Scans the markups before the root element (XML declaration, processing instructions,
+		 comments and DTD) reading more data from the file when a markup is not complete */
+	while(true)
+	{
+		start=prolog.indexOf('<', pos);
+
+		if(start >= 0 && (prolog.size() - start >= 9 || stream_file->atEnd()))
+		{
+			is_decl=(prolog.mid(start, 5)=="<?xml" && prolog.size() > start + 5 && QChar(prolog.at(start + 5)).isSpace());
+			is_dtd=(prolog.mid(start, 9)=="<!DOCTYPE");
+
+			if(prolog.mid(start, 2)=="<?")
+				end_tag="?>";
+			else if(prolog.mid(start, 4)=="<!--")
+				end_tag="-->";
+			else if(is_dtd)
+			{
+				//DTDs with internal subset ends with ]>
+				end=prolog.indexOf('>', start);
+				subset=prolog.indexOf('[', start);
+				end_tag=(subset >= 0 && (end < 0 || subset < end) ? "]>" : ">");
+			}
+			//Any other markup is the start of the root element
+			else
+				break;
+
+			end=prolog.indexOf(end_tag, start);
+
+			if(end >= 0)
+			{
+				end+=end_tag.size();
+
+				if(is_decl)
+					xml_decl=prolog.mid(start, end - start);
+
+				/* The declaration is reinserted on the header while the original DTD is discarded.
+					 The line breaks of the DTD are kept so the line numbers still refer to the file */
+				if(is_decl)
+				{
+					prolog.remove(start, end - start);
+					pos=start;
+				}
+				else if(is_dtd)
+				{
+					prolog.replace(start, end - start, QByteArray(prolog.mid(start, end - start).count('\n'), '\n'));
+					pos=start;
+				}
+				else
+					pos=end;
+
+				continue;
+			}
+		}
+		else if(start < 0)
+			pos=prolog.size();
+
+		if(stream_file->atEnd())
+			break;
+
+		prolog+=stream_file->read(STREAM_CHUNK_SIZE);
+	}
+
+	if(xml_decl.isEmpty())
+		xml_decl="<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+
+	stream_buffer=prolog;
+	stream_buffer_pos=0;
+	stream_buffer_offset=stream_file->pos() - prolog.size();
+}
+
+bool XMLParserContext::readStreamChunk(void)
+{
+	if(stream_file->atEnd())
+		return(false);
+
+	stream_buffer+=stream_file->read(STREAM_CHUNK_SIZE * 16);
+	return(true);
+}
+
+int XMLParserContext::findMarkupEnd(int start, unsigned &markup_type)
+{
+	const char *data=stream_buffer.constData();
+	int size=stream_buffer.size(), pos=0, end=-1;
+	const char *end_tag=nullptr;
+	char quote=0;
+
+	//Waits for enough data to identify the markup
+	if(size - start < 9 && !stream_file->atEnd())
+		return(-1);
+
+	markup_type=MARKUP_OTHER;
+
+	if(qstrncmp(data + start, "<!--", 4)==0)
+		end_tag="-->";
+	else if(qstrncmp(data + start, "<![CDATA[", 9)==0)
+		end_tag="]]>";
+	else if(qstrncmp(data + start, "<?", 2)==0)
+		end_tag="?>";
+	else if(qstrncmp(data + start, "<!", 2)==0)
+		end_tag=">";
+	else if(qstrncmp(data + start, "</", 2)==0)
+	{
+		markup_type=MARKUP_END_TAG;
+		end_tag=">";
+	}
+
+	if(end_tag)
+	{
+		end=stream_buffer.indexOf(end_tag, start + 2);
+		return(end >= 0 ? end + qstrlen(end_tag) : -1);
+	}
+
+	//Start tags ends on the first > which isn't part of an attribute value
+	for(pos=start + 1; pos < size && end < 0; pos++)
+	{
+		if(quote)
+		{
+			if(data[pos]==quote)
+				quote=0;
+		}
+		else if(data[pos]=='"' || data[pos]=='\'')
+			quote=data[pos];
+		else if(data[pos]=='>')
+			end=pos + 1;
+	}
+
+	if(end > 0)
+		markup_type=(data[end - 2]=='/' ? MARKUP_EMPTY_TAG : MARKUP_START_TAG);
+
+	return(end);
+}
+
+void XMLParserContext::readStreamRoot(void)
+{
+	QByteArray root_code;
+	unsigned markup_type=MARKUP_OTHER;
+	int start=-1, end=-1, pos=0;
+
+	//Skips the comments and processing instructions that remained on the prolog
+	do
+	{
+		start=stream_buffer.indexOf('<', pos);
+		end=(start >= 0 ? findMarkupEnd(start, markup_type) : -1);
+
+		if(end < 0)
+		{
+			if(!readStreamChunk())
+				throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+		else
+			pos=end;
+	}
+	while(end < 0 || (markup_type!=MARKUP_START_TAG && markup_type!=MARKUP_EMPTY_TAG));
+
+	//The start tag is parsed as an empty element since its contents are read as fragments
+	root_code=stream_buffer.mid(start, end - start);
+	if(markup_type==MARKUP_START_TAG)
+	{
+		root_code.chop(1);
+		root_code+="/>";
+	}
+
+	stream_line=1 + stream_buffer.left(end).count('\n');
+	stream_buffer_pos=end;
+	stream_ended=(markup_type==MARKUP_EMPTY_TAG);
+
+	root_code.prepend(xml_decl.toUtf8());
+	stream_doc=xmlReadMemory(root_code.constData(), root_code.size(), nullptr, nullptr, PARSER_OPTIONS);
+
+	if(!stream_doc || xmlGetLastError())
+		raiseXMLError();
+
+	stream_root=root_elem=curr_elem=xmlDocGetRootElement(stream_doc);
+	stream_root->line=stream_line;
+	stream_root_name=reinterpret_cast<const char *>(stream_root->name);
+}
+
+XMLFragment *XMLParserContext::readStreamFragment(void)
+{
+	const char *data=nullptr;
+	unsigned markup_type=MARKUP_OTHER;
+	int start=-1, end=-1, pos=0, frag_start=-1, depth=0, line=0;
+
+	//Discards the data already consumed
+	if(stream_buffer_pos >= STREAM_CHUNK_SIZE * 16)
+	{
+		stream_buffer.remove(0, stream_buffer_pos);
+		stream_buffer_offset+=stream_buffer_pos;
+		stream_buffer_pos=0;
+	}
+
+	pos=stream_buffer_pos;
+
+	while(true)
+	{
+		start=stream_buffer.indexOf('<', pos);
+		end=(start >= 0 ? findMarkupEnd(start, markup_type) : -1);
+
+		if(end < 0)
+		{
+			//Only the markups not yet complete are scanned again after reading more data
+			if(start < 0)
+				pos=stream_buffer.size();
+
+			if(!readStreamChunk())
+			{
+				//An incomplete element is delivered to the libxml2 which will report the error on the right line
+				if(frag_start >= 0)
+				{
+					end=stream_buffer.size();
+					break;
+				}
+
+				throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+												.arg(stream_line).arg(0).arg(QString("Premature end of data in tag %1").arg(stream_root_name))
+												.arg("(" + xml_doc_filename + ")"),
+												ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			continue;
+		}
+
+		pos=end;
+
+		if(depth==0)
+		{
+			if(markup_type==MARKUP_END_TAG)
+			{
+				stream_buffer_pos=end;
+				return(nullptr);
+			}
+			else if(markup_type==MARKUP_START_TAG || markup_type==MARKUP_EMPTY_TAG)
+			{
+				frag_start=start;
+				if(markup_type==MARKUP_EMPTY_TAG) break;
+				depth=1;
+			}
+		}
+		else if(markup_type==MARKUP_START_TAG)
+			depth++;
+		else if(markup_type==MARKUP_END_TAG && --depth==0)
+			break;
+	}
+
+	data=stream_buffer.constData();
+	line=stream_line + std::count(data + stream_buffer_pos, data + frag_start, '\n');
+	stream_line=line + std::count(data + frag_start, data + end, '\n');
+	stream_buffer_pos=end;
+
+	return(new XMLFragment(stream_buffer.mid(frag_start, end - frag_start), line, stream_buffer_offset + end));
+}
+
+void XMLParserContext::readStreamFragments(void)
+{
+	XMLFragment *fragment=nullptr;
+	vector<XMLFragmentTask *> tasks;
+	QAtomicInt next_frag(0);
+	QByteArray decl=xml_decl.toUtf8();
+	qint64 batch_start=stream_buffer_offset + stream_buffer_pos;
+	unsigned i;
+
+	clearStreamFragments();
+
+	//The batches are limited so the memory used doesn't grow with the file size
+	while(!stream_ended && fragments.size() < stream_threads * STREAM_BATCH_FRAGMENTS &&
+				(fragments.empty() || fragments.back()->getEndOffset() - batch_start < stream_threads * STREAM_BATCH_SIZE))
+	{
+		fragment=readStreamFragment();
+
+		if(fragment)
+			fragments.push_back(fragment);
+		else
+			stream_ended=true;
+	}
+
+	for(i=0; i < stream_threads && i < fragments.size(); i++)
+	{
+		tasks.push_back(new XMLFragmentTask(fragments, next_frag, decl, stream_root_name, (stream_validate ? dtd : nullptr)));
+		stream_pool->start(tasks.back());
+	}
+
+	stream_pool->waitForDone();
+
+	while(!tasks.empty())
+	{
+		delete(tasks.back());
+		tasks.pop_back();
+	}
+}
+
+void XMLParserContext::clearStreamFragments(void)
+{
+	while(!fragments.empty())
+	{
+		delete(fragments.back());
+		fragments.pop_back();
+	}
+
+	next_fragment=0;
+	curr_fragment=nullptr;
+}
+
+int XMLParserContext::readStreamData(void *context, char *buffer, int len)
+{
+	XMLParserContext *ctx=reinterpret_cast<XMLParserContext *>(context);
+	int size=0;
+
+	//Delivers the header before the remaining contents of the file
+	if(ctx->stream_header_pos < ctx->stream_header.size())
+	{
+		size=qMin(len, ctx->stream_header.size() - ctx->stream_header_pos);
+		memcpy(buffer, ctx->stream_header.constData() + ctx->stream_header_pos, size);
+		ctx->stream_header_pos+=size;
+	}
+	else
+		size=ctx->stream_file->read(buffer, len);
+
+	return(size);
+}
+
+void XMLParserContext::openXMLStream(const QString &filename, unsigned threads)
+{
+	static Profiler::Entry *trusted_cnt=Profiler::getCounter("xml-parser.trusted-files");
+	int ret=0;
+
+	closeXMLStream();
+
+	//Destroys the element tree of a previously loaded buffer
+	root_elem=curr_elem=nullptr;
+	if(xml_doc)
+	{
+		xmlFreeDoc(xml_doc);
+		xml_doc=nullptr;
+	}
+
+	while(!elems_stack.empty())
+		elems_stack.pop();
+
+	xmlResetLastError();
+
+	stream_file=new QFile(filename);
+	stream_file->open(QFile::ReadOnly);
+
+	if(!stream_file->isOpen())
+	{
+		closeXMLStream();
+		throw Exception(QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename),
+										ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	if(stream_file->size()==0)
+	{
+		closeXMLStream();
+		throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	readStreamProlog();
+
+	/* Each element read is validated against the cached DTD unless the file was written by pgModeler itself */
+	xml_doc_filename=filename;
+	stream_validate=(dtd && !(XMLParser::isTrustedFilesEnabled() && XMLParser::isTrustedFile(filename)));
+	stream_threads=(threads > 1 ? threads : 1);
+
+	if(dtd && !stream_validate)
+		trusted_cnt->increment();
+
+	try
+	{
+		/* With more than one thread the top-level elements are extracted from the file by a scanner and
+			 parsed in parallel by batches. The libxml2 must be initialized before being used by the workers */
+		if(stream_threads > 1)
+		{
+			xmlInitParser();
+			stream_pool=new QThreadPool;
+			stream_pool->setMaxThreadCount(stream_threads);
+			stream_size=stream_file->size();
+			readStreamRoot();
+
+			if(stream_validate)
+			{
+				validateRootName();
+
+				if(!XMLParser::validateElement(stream_doc, stream_root, dtd, true))
+					raiseXMLError();
+			}
+
+			return;
+		}
+
+		//The header delivered to the reader is the XML declaration followed by the prolog
+		stream_header.clear();
+		stream_header+=xml_decl;
+		stream_header+=stream_buffer;
+		stream_header_pos=0;
+		stream_size=stream_header.size() + (stream_file->size() - stream_file->pos());
+		stream_buffer.clear();
+
+		//Configures the reader in the same way the parser is configured on readBuffer()
+		xml_reader=xmlReaderForIO(readStreamData, nullptr, this, nullptr, nullptr, PARSER_OPTIONS);
+
+		if(!xml_reader)
+			raiseXMLError();
+
+		//Reads the document until the start of the root element
+		do
+		{
+			ret=xmlTextReaderRead(xml_reader);
+		}
+		while(ret==1 && xmlTextReaderNodeType(xml_reader)!=XML_READER_TYPE_ELEMENT);
+
+		if(ret!=1 || xmlGetLastError())
+			raiseXMLError();
+
+		//Only the root element and its attributes are available at this point
+		stream_root=root_elem=curr_elem=xmlTextReaderCurrentNode(xml_reader);
+		stream_elem=nullptr;
+
+		if(stream_validate)
+		{
+			validateRootName();
+
+			if(!XMLParser::validateElement(xmlTextReaderCurrentDoc(xml_reader), stream_root, dtd, true))
+				raiseXMLError();
+		}
+	}
+	catch(Exception &e)
+	{
+		closeXMLStream();
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+bool XMLParserContext::readNextStreamElement(void)
+{
+	int ret=0;
+
+	if(stream_doc)
+	{
+		while(!elems_stack.empty())
+			elems_stack.pop();
+
+		//Parses the next batch when all the fragments of the current one were read
+		if(next_fragment >= fragments.size())
+			readStreamFragments();
+
+		if(fragments.empty())
+		{
+			root_elem=curr_elem=stream_root;
+			return(false);
+		}
+
+		curr_fragment=fragments[next_fragment++];
+		curr_fragment->raiseError();
+
+		root_elem=curr_fragment->getRootElement();
+		curr_elem=stream_elem=curr_fragment->getElement();
+		return(true);
+	}
+
+	if(!xml_reader)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	/* Skips the subtree of the current element (which is freed by the reader) or, when no
+		 element was read yet, enters on the root element */
+	if(stream_elem)
+		ret=xmlTextReaderNext(xml_reader);
+	else if(!xmlTextReaderIsEmptyElement(xml_reader))
+		ret=xmlTextReaderRead(xml_reader);
+
+	//Ignores any node that is not an element (e.g. comments) until the end of the root element
+	while(ret==1 && xmlTextReaderDepth(xml_reader) > 0 &&
+				xmlTextReaderNodeType(xml_reader)!=XML_READER_TYPE_ELEMENT)
+		ret=xmlTextReaderRead(xml_reader);
+
+	if(ret < 0 || xmlGetLastError())
+		raiseXMLError();
+
+	while(!elems_stack.empty())
+		elems_stack.pop();
+
+	if(ret!=1 || xmlTextReaderDepth(xml_reader)==0)
+	{
+		stream_elem=nullptr;
+		root_elem=curr_elem=stream_root;
+		return(false);
+	}
+
+	//Reads the whole subtree of the element making it available to the navigation
+	stream_elem=xmlTextReaderExpand(xml_reader);
+
+	if(!stream_elem || xmlGetLastError() ||
+		 (stream_validate && !XMLParser::validateElement(xmlTextReaderCurrentDoc(xml_reader), stream_elem, dtd)))
+		raiseXMLError();
+
+	root_elem=stream_root;
+	curr_elem=stream_elem;
+	return(true);
+}
+
+int XMLParserContext::getStreamProgress(void)
+{
+	qint64 consumed;
+
+	if((!xml_reader && !stream_doc) || stream_size==0)
+		return(0);
+
+	if(stream_doc)
+		consumed=(curr_fragment ? curr_fragment->getEndOffset() : 0);
+	else
+		consumed=xmlTextReaderByteConsumed(xml_reader);
+
+	return(consumed >= stream_size ? 100 : (consumed * 100)/stream_size);
+}
+
+void XMLParserContext::closeXMLStream(void)
+{
+	//The elements of the stream are freed together with the reader or the fragments
+	if(stream_root && (root_elem==stream_root || curr_fragment))
+	{
+		root_elem=curr_elem=nullptr;
+
+		while(!elems_stack.empty())
+			elems_stack.pop();
+	}
+
+	if(xml_reader)
+	{
+		xmlFreeTextReader(xml_reader);
+		xml_reader=nullptr;
+	}
+
+	clearStreamFragments();
+
+	if(stream_pool)
+	{
+		stream_pool->waitForDone();
+		delete(stream_pool);
+		stream_pool=nullptr;
+	}
+
+	if(stream_doc)
+	{
+		xmlFreeDoc(stream_doc);
+		stream_doc=nullptr;
+	}
+
+	if(stream_file)
+	{
+		delete(stream_file);
+		stream_file=nullptr;
+	}
+
+	stream_buffer.clear();
+	stream_buffer_pos=stream_line=0;
+	stream_buffer_offset=0;
+	stream_ended=false;
+	stream_threads=1;
+	stream_root_name.clear();
+	stream_header.clear();
+	stream_header_pos=0;
+	stream_size=0;
+	stream_root=stream_elem=nullptr;
+	stream_validate=false;
+}
+
+void XMLParserContext::savePosition(void)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	elems_stack.push(curr_elem);
+}
+
+void XMLParserContext::restorePosition(void)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(elems_stack.empty())
+		curr_elem=root_elem;
+	else
+	{
+		curr_elem=elems_stack.top();
+		elems_stack.pop();
+	}
+}
+
+void XMLParserContext::restorePosition(const xmlNode *elem)
+{
+	if(!elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	else if(!root_elem || elem->doc!=root_elem->doc)
+		throw Exception(ERR_OPR_INEXIST_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	restartNavigation();
+	curr_elem=const_cast<xmlNode *>(elem);
+}
+
+void XMLParserContext::restartNavigation(void)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	curr_elem=root_elem;
+
+	while(!elems_stack.empty())
+		elems_stack.pop();
+}
+
+void XMLParserContext::restartParser(void)
+{
+	root_elem=curr_elem=nullptr;
+	if(xml_doc)
+	{
+		xmlFreeDoc(xml_doc);
+		xml_doc=nullptr;
+	}
+	xml_buffer=xml_decl=dtd_name="";
+	dtd=nullptr;
+
+	while(!elems_stack.empty())
+		elems_stack.pop();
+
+	xmlResetLastError();
+	xml_doc_filename="";
+}
+
+bool XMLParserContext::accessElement(unsigned elem_type)
+{
+	bool has_elem;
+	xmlNode *elems[4];
+
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	elems[XMLParser::ROOT_ELEMENT]=curr_elem->parent;
+	elems[XMLParser::CHILD_ELEMENT]=curr_elem->children;
+	elems[XMLParser::NEXT_ELEMENT]=curr_elem->next;
+	elems[XMLParser::PREVIOUS_ELEMENT]=curr_elem->prev;
+
+	/* Checks whether the current element has the element that
+		is to  be accessed. The flag 'has_elem' is also used
+		on the method return to indicate if the element has been
+		accessed or not. */
+	has_elem=hasElement(elem_type);
+
+	if(has_elem)
+		curr_elem=elems[elem_type];
+
+	return(has_elem);
+}
+
+bool XMLParserContext::hasElement(unsigned tipo_elem)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(tipo_elem==XMLParser::ROOT_ELEMENT)
+		/* Returns the verification if the current element has a parent.
+		 The element must be different from the root, because the root element
+		 is not connected to a parent */
+		return(curr_elem!=root_elem && curr_elem->parent!=nullptr);
+	else if(tipo_elem==XMLParser::CHILD_ELEMENT)
+		//Returns the verification if the current element has children
+		return(curr_elem->children!=nullptr);
+	else if(tipo_elem==XMLParser::NEXT_ELEMENT)
+		return(curr_elem->next!=nullptr);
+	else
+		/* The second comparison in the expression is made for the root element
+		 because libxml2 places the previous element as the root itself */
+		return(curr_elem->prev!=nullptr && curr_elem->prev!=root_elem);
+}
+
+bool XMLParserContext::hasAttributes(void)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	return(curr_elem->properties!=nullptr);
+}
+
+QString XMLParserContext::getElementContent(void)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	/* If the current element has  <![CDATA[]]> node returns the content of the CDATA instead
+	of return the content of the element itself */
+	if(curr_elem->next && curr_elem->next->type == XML_CDATA_SECTION_NODE)
+		return(QString(reinterpret_cast<char *>(curr_elem->next->content)));
+	else
+		//Return the content of the element when is not a CDATA node
+		return(QString(reinterpret_cast<char *>(curr_elem->content)));
+}
+
+QString XMLParserContext::getElementName(void)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	return(QString(reinterpret_cast<const char *>(curr_elem->name)));
+}
+
+xmlElementType XMLParserContext::getElementType(void)
+{
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	return(curr_elem->type);
+}
+
+const xmlNode *XMLParserContext::getCurrentElement(void)
+{
+	return(curr_elem);
+}
+
+void XMLParserContext::getElementAttributes(map<QString, QString> &attributes)
+{
+	xmlAttr *elem_attribs=nullptr;
+	QString attrib, value;
+
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	//The attributes of the elements read from fragments were already extracted by the parsing threads
+	if(curr_fragment && curr_fragment->getElementAttributes(curr_elem, attributes))
+		return;
+
+	//Always clears the passed attributes maps
+	attributes.clear();
+
+	//Gets the references to the element properties
+	elem_attribs=curr_elem->properties;
+
+	while(elem_attribs)
+	{
+		//Gets the attribute name
+		attrib=QString(reinterpret_cast<const char *>(elem_attribs->name));
+		//Gets the attribute value
+		value=QString(reinterpret_cast<char *>(elem_attribs->children->content));
+
+		/* Assigns to the attribute map in the index specified by the
+		 attribute name the obtained value */
+		attributes[attrib]=value;
+
+		//Step to the next element attribute
+		elem_attribs=elem_attribs->next;
+	}
+}
+
+QString XMLParserContext::getLoadedFilename(void)
+{
+	return(xml_doc_filename);
+}
+
+QString XMLParserContext::getXMLBuffer(void)
+{
+	return(xml_buffer);
+}
+
+int XMLParserContext::getCurrentBufferLine(void)
+{
+	if(curr_elem)
+		return(curr_elem->line);
+	else
+		return(0);
+}
+
+int XMLParserContext::getBufferLineCount(void)
+{
+	if(xml_doc && xml_doc->last)
+		return(xml_doc->last->line);
+	else
+		return(0);
+}
+
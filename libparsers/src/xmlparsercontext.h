@@ -0,0 +1,273 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class XMLParserContext
+\brief Holds the state of a xml parser (buffer, element tree, navigation stack and the document stream)
+ and implements the operations exposed by XMLParser. The static methods of XMLParser operates over the
+ current context of the calling thread, and new contexts can be pushed over it (see XMLParser::pushContext())
+ in order to read small buffers without destroying the document being read.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef XML_PARSER_CONTEXT_H
+#define XML_PARSER_CONTEXT_H
+
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#include <libxml/xmlreader.h>
+#include <QFile>
+#include <QThreadPool>
+#include "exception.h"
+#include "profiler.h"
+#include "xmlfragment.h"
+#include <map>
+#include <stack>
+#include <vector>
+
+class XMLParserContext {
+	private:
+		/*! \brief Stores the name of the file that generated the xml buffer when
+		 loadXMLFile() method is called */
+		QString xml_doc_filename;
+
+		//! \brief Stores the xml document (element tree) generated after the buffer reading
+		xmlDoc *xml_doc;
+
+		//! \brief Stores the reference to the root element of the element tree
+		xmlNode	*root_elem,
+						//! \brief Stores the current element that parser is analyzing
+						*curr_elem;
+
+		/*! \brief Stores the elements that marks the position in the tree before do
+		 a subsequent operation. To configure this element it is necessary
+		 call the method savePosition() and to return the navigation to the saved
+		 position is necessary call restorePosition() */
+		stack<xmlNode *> elems_stack;
+
+		//! \brief DTD used to validate the documents (owned by the XMLParser's DTD cache)
+		xmlDtd *dtd;
+
+		//! \brief Name of the DTD which must match the name of the root element
+		QString	dtd_name,
+						//! \brief Stores XML document to be analyzed
+						xml_buffer,
+						/*! \brief Stores the declaration <?xml?>. If this isn't exists it will be
+						 a default declaration. */
+						xml_decl;
+
+		//! \brief Size of the chunks read from the file while searching the root element of a streamed document
+		static constexpr int STREAM_CHUNK_SIZE=4096;
+
+		/*! \brief Maximum amount of fragments and bytes read by each thread at once when the stream
+		 is parsed in parallel (see readStreamFragments()) */
+		static constexpr unsigned STREAM_BATCH_FRAGMENTS=64,
+															STREAM_BATCH_SIZE=1048576;
+
+		//! \brief Types of the markups found by the fragment scanner (see findMarkupEnd())
+		static constexpr unsigned MARKUP_OTHER=0,
+															MARKUP_START_TAG=1,
+															MARKUP_EMPTY_TAG=2,
+															MARKUP_END_TAG=3;
+
+		//! \brief Text reader used to read a document one top-level element at a time (see openXMLStream())
+		xmlTextReader *xml_reader;
+
+		//! \brief File being read by the text reader
+		QFile *stream_file;
+
+		/*! \brief Stores the beginning of the streamed document (XML declaration and the prolog without
+		 the original DTD) which is delivered to the reader before the remaining file contents */
+		QByteArray stream_header;
+
+		//! \brief Amount of header bytes already delivered to the reader
+		int stream_header_pos;
+
+		//! \brief Total amount of bytes that will be delivered to the reader (used to calculate the progress)
+		qint64 stream_size;
+
+		//! \brief Stores the root element of the streamed document and the top-level element currently expanded
+		xmlNode	*stream_root,
+						*stream_elem;
+
+		//! \brief Indicates that the elements read from the stream must be validated against the DTD
+		bool stream_validate;
+
+		/*! \brief Amount of threads used to parse the stream. When greater than 1 the top-level elements are
+		 extracted from the file as fragments and parsed in parallel instead of using the text reader */
+		unsigned stream_threads;
+
+		//! \brief Thread pool used to parse the fragments
+		QThreadPool *stream_pool;
+
+		//! \brief Document that holds the root element of the stream when reading fragments
+		xmlDoc *stream_doc;
+
+		//! \brief Name of the root element of the stream used to wrap the fragments
+		QString stream_root_name;
+
+		//! \brief Data read from the file and not yet consumed by the fragment scanner
+		QByteArray stream_buffer;
+
+		//! \brief Position on the buffer where the scanner stopped
+		int stream_buffer_pos,
+				//! \brief Line on the file related to the scanner position
+				stream_line;
+
+		//! \brief Position on the file related to the first byte of the buffer
+		qint64 stream_buffer_offset;
+
+		//! \brief Indicates that the end of the root element was found by the scanner
+		bool stream_ended;
+
+		//! \brief Fragments of the current batch, the next one to be read and the one being read
+		vector<XMLFragment *> fragments;
+		unsigned next_fragment;
+		XMLFragment *curr_fragment;
+
+		/*! \brief Remove the original DTD from the document. This is done to evit that
+		 the user insert some external dtd in the model file that is not valid for pgModeler */
+		void removeDTD(void);
+
+		/*! \brief Makes the interpretation of XML inside the buffer validating it according to
+		 DTD defined configured (by the parser) to the buffer. Initializes
+		 the necessary attributes to make possible the navigation through the element tree
+		 generated from the XML document read. The validation is skipped when 'validate' is false */
+		void readBuffer(bool validate);
+
+		//! \brief Loads the XML buffer from a string validating it only if 'validate' is true
+		void loadXMLBuffer(const QString &xml_buf, bool validate);
+
+		//! \brief Raises an error if the name of the root element differs from the DTD name
+		void validateRootName(void);
+
+		//! \brief Raises an exception containing the last error generated by libxml2
+		void raiseXMLError(void);
+
+		/*! \brief Reads the file prolog until the start of the root element storing it on the stream buffer.
+		 The original XML declaration is kept while the original DTD is removed (see removeDTD()) */
+		void readStreamProlog(void);
+
+		//! \brief Appends the next chunk of the file to the stream buffer. Returns false at the end of file
+		bool readStreamChunk(void);
+
+		/*! \brief Returns the position right after the end of the markup started at the specified position of the
+		 stream buffer, or -1 if the markup isn't complete yet. The type of the markup is stored on 'markup_type' */
+		int findMarkupEnd(int start, unsigned &markup_type);
+
+		/*! \brief Parses the start tag of the root element (the first markup after the prolog) when
+		 the stream is read as fragments */
+		void readStreamRoot(void);
+
+		/*! \brief Extracts from the stream buffer the code of the next top-level element. Returns null
+		 when the end tag of the root element is reached */
+		XMLFragment *readStreamFragment(void);
+
+		/*! \brief Frees the current batch of fragments and extracts a new one parsing its fragments
+		 on the thread pool. The batch is empty when the end of the stream is reached */
+		void readStreamFragments(void);
+
+		//! \brief Frees the fragments of the current batch
+		void clearStreamFragments(void);
+
+		//! \brief Input callback used by the text reader to obtain the document contents of the context
+		static int readStreamData(void *context, char *buffer, int len);
+
+	public:
+		//! \brief Options used to parse the documents. The DTD isn't loaded by libxml2 (see XMLParser::getDTD())
+		static constexpr int PARSER_OPTIONS=(XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT);
+
+		XMLParserContext(void);
+		~XMLParserContext(void);
+
+		//! \brief Loads the XML buffer from a file
+		void loadXMLFile(const QString &filename);
+
+		//! \brief Loads the XML buffer from a string
+		void loadXMLBuffer(const QString &xml_buf);
+
+		//! \brief Opens a file to be read one top-level element at a time (see XMLParser::openXMLStream())
+		void openXMLStream(const QString &filename, unsigned threads=1);
+
+		//! \brief Reads the next top-level element of the stream (see XMLParser::readNextStreamElement())
+		bool readNextStreamElement(void);
+
+		//! \brief Returns the percentage of the streamed document already read
+		int getStreamProgress(void);
+
+		//! \brief Closes the stream freeing all the elements read from it
+		void closeXMLStream(void);
+
+		//! \brief Informs the DTD file used to make element validations
+		void setDTDFile(const QString &dtd_file, const QString &dtd_name);
+
+		//! \brief Saves to stack the current navigation position on the element tree
+		void savePosition(void);
+
+		//! \brief Restores the previous navigation position oh the element tree
+		void restorePosition(void);
+
+		//! \brief Restores the position of the navigation on a specific element on the document
+		void restorePosition(const xmlNode *elem);
+
+		//! \brief Moves one level in the element tree according to the type of element to be accessed
+		bool accessElement(unsigned elem_type);
+
+		//! \brief Returns if an element has a root, child, previous or next element
+		bool hasElement(unsigned elem_type);
+
+		//! \brief Retorns if an element has attributes
+		bool hasAttributes(void);
+
+		//! \brief Stores on a map the atrributes (names and values) of the current element
+		void getElementAttributes(map<QString, QString> &attributes);
+
+		//! \brief Returns the content text of the element
+		QString getElementContent(void);
+
+		//! \brief Returns the current element type
+		xmlElementType getElementType(void);
+
+		//! \brief Returns the constant reference to the current element on the tree
+		const xmlNode *getCurrentElement(void);
+
+		//! \brief Returns the current line number on the buffer that is being processed
+		int getCurrentBufferLine(void);
+
+		//! \brief Returns the total line amount of the buffer
+		int getBufferLineCount(void);
+
+		//! \brief Returns the tag name that defines the current element
+		QString getElementName(void);
+
+		//! \brief Returns the filename that generated XML buffer
+		QString getLoadedFilename(void);
+
+		//! \brief Returns the full parser buffer
+		QString getXMLBuffer(void);
+
+		//! \brief Reset all the elements resposible to the navigation through the element tree
+		void restartNavigation(void);
+
+		/*! \brief Reset all the parser attributes, deallocating the element tree. An open stream
+		 is kept untouched (see closeXMLStream()) */
+		void restartParser(void);
+};
+
+#endif
@@ -50,7 +50,10 @@ HEADERS += src/textbox.h \
 	   src/copyoptions.h \
 	   src/typeattribute.h \
     src/extension.h \
-    src/pgmodelerns.h
+    src/pgmodelerns.h \
+    src/codegenerationtask.h \
+    src/sqlstatement.h \
+    src/sqlstatementhandler.h
 
 
 SOURCES +=  src/textbox.cpp \
@@ -95,4 +98,6 @@ SOURCES +=  src/textbox.cpp \
 	    src/copyoptions.cpp \
 	    src/typeattribute.cpp \
     src/extension.cpp \
-    src/pgmodelerns.cpp
+    src/pgmodelerns.cpp \
+    src/codegenerationtask.cpp \
+    src/sqlstatement.cpp
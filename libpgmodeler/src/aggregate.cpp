@@ -23,13 +23,10 @@ Aggregate::Aggregate(void)
 	obj_type=OBJ_AGGREGATE;
 	functions[0]=functions[1]=nullptr;
 	sort_operator=nullptr;
-	attributes[ParsersAttributes::TYPES]="";
-	attributes[ParsersAttributes::TRANSITION_FUNC]="";
-	attributes[ParsersAttributes::STATE_TYPE]="";
-	attributes[ParsersAttributes::BASE_TYPE]="";
-	attributes[ParsersAttributes::FINAL_FUNC]="";
-	attributes[ParsersAttributes::INITIAL_COND]="";
-	attributes[ParsersAttributes::SORT_OP]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_TYPES, ParsersAttributes::ID_TRANSITION_FUNC, ParsersAttributes::ID_STATE_TYPE,
+			ParsersAttributes::ID_BASE_TYPE, ParsersAttributes::ID_FINAL_FUNC, ParsersAttributes::ID_INITIAL_COND,
+			ParsersAttributes::ID_SORT_OP };
+	declareAttributes(class_attribs);
 }
 
 void Aggregate::setFunction(unsigned func_idx, Function *func)
@@ -137,7 +134,7 @@ void Aggregate::setTypesAttribute(unsigned def_type)
 		an aggregate that accepts any possible data '*' e.g. function(*) */
 	if(str_types.isEmpty()) str_types="*";
 
-	attributes[ParsersAttributes::TYPES]=str_types;
+	attributes[ParsersAttributes::ID_TYPES]=str_types;
 }
 
 void Aggregate::addDataType(PgSQLType type)
@@ -224,47 +221,49 @@ PgSQLType Aggregate::getDataType(unsigned type_idx)
 
 QString Aggregate::getCodeDefinition(unsigned def_type)
 {
+	QMutexLocker locker(&code_gen_mutex);
+
 	setTypesAttribute(def_type);
 
 	if(functions[TRANSITION_FUNC])
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::TRANSITION_FUNC]=functions[TRANSITION_FUNC]->getSignature();
+			attributes[ParsersAttributes::ID_TRANSITION_FUNC]=functions[TRANSITION_FUNC]->getSignature();
 		else
 		{
 			functions[TRANSITION_FUNC]->setAttribute(ParsersAttributes::REF_TYPE,
 																							 ParsersAttributes::TRANSITION_FUNC);
-			attributes[ParsersAttributes::TRANSITION_FUNC]=functions[TRANSITION_FUNC]->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::ID_TRANSITION_FUNC]=functions[TRANSITION_FUNC]->getCodeDefinition(def_type,true);
 		}
 	}
 
 	if(functions[FINAL_FUNC])
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::FINAL_FUNC]=functions[FINAL_FUNC]->getSignature();
+			attributes[ParsersAttributes::ID_FINAL_FUNC]=functions[FINAL_FUNC]->getSignature();
 		else
 		{
 			functions[FINAL_FUNC]->setAttribute(ParsersAttributes::REF_TYPE,
 																					ParsersAttributes::FINAL_FUNC);
-			attributes[ParsersAttributes::FINAL_FUNC]=functions[FINAL_FUNC]->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::ID_FINAL_FUNC]=functions[FINAL_FUNC]->getCodeDefinition(def_type,true);
 		}
 	}
 
 	if(sort_operator)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::SORT_OP]=sort_operator->getName(true);
+			attributes[ParsersAttributes::ID_SORT_OP]=sort_operator->getName(true);
 		else
-			attributes[ParsersAttributes::SORT_OP]=sort_operator->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::ID_SORT_OP]=sort_operator->getCodeDefinition(def_type,true);
 	}
 
 	if(initial_condition!="")
-		attributes[ParsersAttributes::INITIAL_COND]=initial_condition;
+		attributes[ParsersAttributes::ID_INITIAL_COND]=initial_condition;
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
-		attributes[ParsersAttributes::STATE_TYPE]=*(state_type);
+		attributes[ParsersAttributes::ID_STATE_TYPE]=*(state_type);
 	else
-		attributes[ParsersAttributes::STATE_TYPE]=state_type.getCodeDefinition(def_type,ParsersAttributes::STATE_TYPE);
+		attributes[ParsersAttributes::ID_STATE_TYPE]=state_type.getCodeDefinition(def_type,ParsersAttributes::STATE_TYPE);
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
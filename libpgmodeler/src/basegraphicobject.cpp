@@ -21,9 +21,8 @@
 BaseGraphicObject::BaseGraphicObject(void)
 {
 	is_modified=true;
-	attributes[ParsersAttributes::X_POS]="";
-	attributes[ParsersAttributes::Y_POS]="";
-	attributes[ParsersAttributes::POSITION]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_X_POS, ParsersAttributes::ID_Y_POS, ParsersAttributes::ID_POSITION };
+	declareAttributes(class_attribs);
 	receiver_object=nullptr;
 }
 
@@ -58,9 +57,9 @@ bool BaseGraphicObject::isModified(void)
 
 void BaseGraphicObject::setPositionAttribute(void)
 {
-	attributes[ParsersAttributes::X_POS]=QString("%1").arg(position.x());
-	attributes[ParsersAttributes::Y_POS]=QString("%1").arg(position.y());
-	attributes[ParsersAttributes::POSITION]=SchemaParser::getCodeDefinition(ParsersAttributes::POSITION,
+	attributes[ParsersAttributes::ID_X_POS]=QString("%1").arg(position.x());
+	attributes[ParsersAttributes::ID_Y_POS]=QString("%1").arg(position.y());
+	attributes[ParsersAttributes::ID_POSITION]=SchemaParser::getCodeDefinition(ParsersAttributes::POSITION,
 																																					attributes, SchemaParser::XML_DEFINITION);
 }
 
@@ -18,6 +18,7 @@
 
 #include "baseobject.h"
 #include <QApplication>
+#include <algorithm>
 
 /* CAUTION: If both amount and order of the enumerations are modified
 	 then the order and amount of the elements of this vector
@@ -64,6 +65,8 @@ QString BaseObject::objs_sql[OBJECT_TYPE_COUNT]={
 //unsigned BaseObject::global_id=60000;
 unsigned BaseObject::global_id=30000;
 
+QMutex BaseObject::code_gen_mutex(QMutex::Recursive);
+
 BaseObject::BaseObject(void)
 {
 	object_id=BaseObject::global_id++;
@@ -74,14 +77,11 @@ BaseObject::BaseObject(void)
 	tablespace=nullptr;
 	database=nullptr;
 	collation=nullptr;
-	attributes[ParsersAttributes::NAME]="";
-	attributes[ParsersAttributes::COMMENT]="";
-	attributes[ParsersAttributes::OWNER]="";
-	attributes[ParsersAttributes::TABLESPACE]="";
-	attributes[ParsersAttributes::SCHEMA]="";
-	attributes[ParsersAttributes::COLLATION]="";
-	attributes[ParsersAttributes::PROTECTED]="";
-	attributes[ParsersAttributes::SQL_DISABLED]="";
+	//Attributes used by the schema files of all objects. Their values are defined only during the code generation
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_NAME, ParsersAttributes::ID_COMMENT, ParsersAttributes::ID_OWNER,
+			ParsersAttributes::ID_TABLESPACE, ParsersAttributes::ID_SCHEMA, ParsersAttributes::ID_COLLATION,
+			ParsersAttributes::ID_PROTECTED, ParsersAttributes::ID_SQL_DISABLED };
+	declareAttributes(class_attribs);
 	this->setName(QApplication::translate("BaseObject","new_object","", -1));
 }
 
@@ -307,6 +307,21 @@ BaseObject *BaseObject::getDatabase(void)
 	return(this->database);
 }
 
+void BaseObject::updateDatabaseIndex(void)
+{
+	if(database)
+		database->updateObjectIndex(this);
+}
+
+void BaseObject::updateDatabaseReferences(void)
+{
+	if(database)
+		database->updateObjectReferences(this);
+	//The database model is the owner of its own references
+	else if(obj_type==OBJ_DATABASE)
+		this->updateObjectReferences(this);
+}
+
 void BaseObject::setProtected(bool value)
 {
 	is_protected=(!system_obj ? value : true);
@@ -337,6 +352,7 @@ void BaseObject::setName(const QString &name)
 		{
 			aux_name.remove('\"');
 			this->obj_name=aux_name;
+			updateDatabaseIndex();
 		}
 	}
 }
@@ -416,6 +432,8 @@ void BaseObject::setSchema(BaseObject *schema)
 		throw Exception(ERR_ASG_INV_SCHEMA_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->schema=schema;
+	updateDatabaseIndex();
+	updateDatabaseReferences();
 }
 
 void BaseObject::setOwner(BaseObject *owner)
@@ -426,6 +444,7 @@ void BaseObject::setOwner(BaseObject *owner)
 		throw Exception(ERR_ASG_ROLE_OBJECT_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->owner=owner;
+	updateDatabaseReferences();
 }
 
 void BaseObject::setTablespace(BaseObject *tablespace)
@@ -436,6 +455,7 @@ void BaseObject::setTablespace(BaseObject *tablespace)
 		throw Exception(ERR_ASG_TABSPC_INV_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->tablespace=tablespace;
+	updateDatabaseReferences();
 }
 
 void BaseObject::setCollation(BaseObject *collation)
@@ -446,6 +466,7 @@ void BaseObject::setCollation(BaseObject *collation)
 		throw Exception(ERR_ASG_INV_COLLATION_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->collation=collation;
+	updateDatabaseReferences();
 }
 
 QString BaseObject::getName(bool format, bool prepend_schema)
@@ -558,6 +579,11 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
 	QString code_def;
 
+	/* Objects referenced in reduced form by many others (directly via BaseObject pointer)
+		 must have their code generated one thread at a time */
+	QMutexLocker locker((obj_type==OBJ_SCHEMA || obj_type==OBJ_ROLE ||
+											 obj_type==OBJ_TABLESPACE || obj_type==OBJ_COLLATION) ? &code_gen_mutex : nullptr);
+
 	if((def_type==SchemaParser::SQL_DEFINITION &&
 			obj_type!=BASE_OBJECT && obj_type!=BASE_RELATIONSHIP &&
 			obj_type!=BASE_TABLE && obj_type!=OBJ_TEXTBOX) ||
@@ -567,7 +593,8 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 	{
 		bool format;
 
-		attributes[ParsersAttributes::SQL_DISABLED]=(sql_disabled ? "1" : "");
+		defineDeclaredAttributes();
+		attributes[ParsersAttributes::ID_SQL_DISABLED]=(sql_disabled ? "1" : "");
 
 		//Formats the object's name in case the SQL definition is being generated
 		format=((def_type==SchemaParser::SQL_DEFINITION) ||
@@ -589,52 +616,52 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 			case OBJ_OPERATOR:
 			case OBJ_OPCLASS:
 			case OBJ_OPFAMILY:
-				attributes[ParsersAttributes::DIF_SQL]="1";
+				attributes[ParsersAttributes::ID_DIF_SQL]="1";
 				attributes[objs_schemas[obj_type]]="1";
 			break;
 
 			default:
-				attributes[ParsersAttributes::DIF_SQL]="";
+				attributes[ParsersAttributes::ID_DIF_SQL]="";
 			break;
 		}
 
-		if(attributes[ParsersAttributes::NAME].isEmpty())
-			attributes[ParsersAttributes::NAME]=this->getName(format);
+		if(attributes[ParsersAttributes::ID_NAME].isEmpty())
+			attributes[ParsersAttributes::ID_NAME]=this->getName(format);
 
-		attributes[ParsersAttributes::SQL_OBJECT]=objs_sql[this->obj_type];
+		attributes[ParsersAttributes::ID_SQL_OBJECT]=objs_sql[this->obj_type];
 
 		if(schema)
 		{
 			if(def_type==SchemaParser::XML_DEFINITION)
-				attributes[ParsersAttributes::SCHEMA]=schema->getCodeDefinition(def_type, true);
+				attributes[ParsersAttributes::ID_SCHEMA]=schema->getCodeDefinition(def_type, true);
 			else
-				attributes[ParsersAttributes::SCHEMA]=schema->getName(format);
+				attributes[ParsersAttributes::ID_SCHEMA]=schema->getName(format);
 		}
 
 		if(def_type==SchemaParser::XML_DEFINITION)
-			attributes[ParsersAttributes::PROTECTED]=(is_protected ? "1" : "");
+			attributes[ParsersAttributes::ID_PROTECTED]=(is_protected ? "1" : "");
 
 		if(tablespace)
 		{
 			if(def_type==SchemaParser::SQL_DEFINITION)
-				attributes[ParsersAttributes::TABLESPACE]=tablespace->getName(format);
+				attributes[ParsersAttributes::ID_TABLESPACE]=tablespace->getName(format);
 			else
-				attributes[ParsersAttributes::TABLESPACE]=tablespace->getCodeDefinition(def_type, true);
+				attributes[ParsersAttributes::ID_TABLESPACE]=tablespace->getCodeDefinition(def_type, true);
 		}
 
-		if(collation && attributes[ParsersAttributes::COLLATION].isEmpty())
+		if(collation && attributes[ParsersAttributes::ID_COLLATION].isEmpty())
 		{
 			if(def_type==SchemaParser::SQL_DEFINITION)
-				attributes[ParsersAttributes::COLLATION]=collation->getName(format);
+				attributes[ParsersAttributes::ID_COLLATION]=collation->getName(format);
 			else
-				attributes[ParsersAttributes::COLLATION]=collation->getCodeDefinition(def_type, true);
+				attributes[ParsersAttributes::ID_COLLATION]=collation->getCodeDefinition(def_type, true);
 		}
 
 		if(owner)
 		{
 			if(def_type==SchemaParser::SQL_DEFINITION)
 			{
-				attributes[ParsersAttributes::OWNER]=owner->getName(format);
+				attributes[ParsersAttributes::ID_OWNER]=owner->getName(format);
 
 				/** Only tablespaces and database do not have an ALTER OWNER SET
 				 because the rule says that PostgreSQL tablespaces and database should be created
@@ -645,17 +672,17 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 					 def_type==SchemaParser::XML_DEFINITION)
 				{
 					SchemaParser::setIgnoreUnkownAttributes(true);
-					attributes[ParsersAttributes::OWNER]=
+					attributes[ParsersAttributes::ID_OWNER]=
 							SchemaParser::getCodeDefinition(ParsersAttributes::OWNER, attributes, def_type);
 				}
 			}
 			else
-				attributes[ParsersAttributes::OWNER]=owner->getCodeDefinition(def_type, true);
+				attributes[ParsersAttributes::ID_OWNER]=owner->getCodeDefinition(def_type, true);
 		}
 
 		if(comment!="")
 		{
-			attributes[ParsersAttributes::COMMENT]=comment;
+			attributes[ParsersAttributes::ID_COMMENT]=comment;
 
 			if((def_type==SchemaParser::SQL_DEFINITION &&
 					obj_type!=OBJ_TABLESPACE &&
@@ -663,15 +690,15 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 				 def_type==SchemaParser::XML_DEFINITION)
 			{
 				SchemaParser::setIgnoreUnkownAttributes(true);
-				attributes[ParsersAttributes::COMMENT]=
+				attributes[ParsersAttributes::ID_COMMENT]=
 						SchemaParser::getCodeDefinition(ParsersAttributes::COMMENT, attributes, def_type);
 			}
 		}
 
 		if(reduced_form)
-			attributes[ParsersAttributes::REDUCED_FORM]="1";
+			attributes[ParsersAttributes::ID_REDUCED_FORM]="1";
 		else
-			attributes[ParsersAttributes::REDUCED_FORM]="";
+			attributes[ParsersAttributes::ID_REDUCED_FORM]="";
 
 		try
 		{
@@ -716,20 +743,30 @@ void BaseObject::setAttribute(const QString &attrib, const QString &value)
 	attributes[attrib]=value;
 }
 
-void BaseObject::clearAttributes(void)
+void BaseObject::declareAttributes(const vector<unsigned> &attribs)
 {
-	map<QString, QString>::iterator itr, itr_end;
+	if(std::find(declared_attribs.begin(), declared_attribs.end(), &attribs)==declared_attribs.end())
+		declared_attribs.push_back(&attribs);
+}
 
-	itr=attributes.begin();
-	itr_end=attributes.end();
+void BaseObject::defineDeclaredAttributes(void)
+{
+	vector<const vector<unsigned> *>::iterator itr;
+	vector<unsigned>::const_iterator itr_attr;
 
-	while(itr!=itr_end)
+	for(itr=declared_attribs.begin(); itr!=declared_attribs.end(); itr++)
 	{
-		itr->second="";
-		itr++;
+		//The insertion doesn't replace the values already assigned to the attributes
+		for(itr_attr=(*itr)->begin(); itr_attr!=(*itr)->end(); itr_attr++)
+			attributes.insert(*itr_attr, QString());
 	}
 }
 
+void BaseObject::clearAttributes(void)
+{
+	attributes.clear();
+}
+
 void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2)
 {
 	if(!obj1 || !obj2)
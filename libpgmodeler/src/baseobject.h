@@ -26,14 +26,17 @@
 #define BASE_OBJECT_H
 
 #include "parsersattributes.h"
+#include "attributesmap.h"
 #include "exception.h"
 #include "pgsqltypes.h"
 #include "schemaparser.h"
 #include "xmlparser.h"
 #include <map>
+#include <vector>
 #include <QRegExp>
 #include <QStringList>
 #include <QTextStream>
+#include <QMutex>
 
 using namespace ParsersAttributes;
 
@@ -148,9 +151,21 @@ class BaseObject {
 		ObjectType obj_type;
 
 		/*! \brief Stores the attributes and their values ​​shaped in strings to be used
-		 by SchemaParser on the object's code definition creation. The attribute
-		 name related to model objects are defined in ParsersAttributes namespace. */
-		map<QString, QString> attributes;
+		 by SchemaParser on the object's code definition creation. The attributes are indexed
+		 by the ids of the names defined in ParsersAttributes namespace (e.g. ParsersAttributes::ID_NAME).
+		 This map is transient: it's filled only while the code definition is being generated
+		 and released afterwards (see clearAttributes()), so the objects don't keep it between generations */
+		AttributesMap attributes;
+
+		/*! \brief Lists of attributes declared by each class of the object's hierarchy (see declareAttributes()).
+		 The lists are shared by all the instances of the same class */
+		vector<const vector<unsigned> *> declared_attribs;
+
+		/*! \brief Mutex used to serialize the code generation of objects that are shared between other objects
+		 (schemas, roles, tablespaces, collations, functions, languages, types, operators and related) because their
+		 attributes map is filled when generating the reduced form referenced by other objects. This is only needed when
+		 the model's code is being generated by several threads (see DatabaseModel::setCodeGenerationThreads()) */
+		static QMutex code_gen_mutex;
 
 		/*! \brief This method calls the getCodeDefinition(unsigned, bool) method with the 'reduced_form' defined as 'false',
 		 This is the real implementation of the virtual method getCodeDefinition(unsigned). */
@@ -162,6 +177,25 @@ class BaseObject {
 							 if the user calls getDatabase() in further operations may result in crash */
 		void setDatabase(BaseObject *db);
 
+		/*! \brief Informs the database that owns the object that its name, schema or signature changed so the
+		 objects index used to search by name can be updated (see DatabaseModel::updateObjectIndex()).
+		 Objects not owned by a database ignore this call. This method is reimplemented by TableObject
+		 in order to update the index of the parent table as well */
+		virtual void updateDatabaseIndex(void);
+
+		/*! \brief Updates the search key of the object on the index of objects by name. This method does nothing
+		 here and is reimplemented by DatabaseModel */
+		virtual void updateObjectIndex(BaseObject *){}
+
+		/*! \brief Informs the database that owns the object that the objects referenced by it changed so the
+		 references index can be updated (see DatabaseModel::updateObjectReferences()). This method is reimplemented
+		 by TableObject in order to reach the database through the parent table */
+		virtual void updateDatabaseReferences(void);
+
+		/*! \brief Updates the objects referenced by the object on the references index. This method does nothing
+		 here and is reimplemented by DatabaseModel */
+		virtual void updateObjectReferences(BaseObject *){}
+
 	public:
 		//! \brief Maximum number of characters that an object name on PostgreSQL can have
 		static const int OBJECT_NAME_MAX_LENGTH=63;
@@ -178,6 +212,14 @@ class BaseObject {
 		 another class but does not have permission. */
 		void setAttribute(const QString &attrib, const QString &value);
 
+		/*! \brief Declares attributes that must always exist on the attributes map when the object's code is generated,
+		 even if no value is assigned to them. This method must be called by the constructors passing a static list of ids (ParsersAttributes::ID_*), since only
+		 the reference to the list is stored. The attributes are inserted with empty values only during the code generation */
+		void declareAttributes(const vector<unsigned> &attribs);
+
+		//! \brief Inserts on the attributes map (with empty values) the declared attributes not yet defined
+		void defineDeclaredAttributes(void);
+
 		/*! \brief Returns whether the object name is in conformity with the PostgreSQL object naming rule.
 		 (e.g. 63 bytes long and chars in set [a-zA-z0-9_] */
 		static bool isValidName(const QString &name);
@@ -286,7 +328,7 @@ class BaseObject {
 		//! \brief Assigns an object to other copiyng all the attributes correctly
 		void operator = (BaseObject &obj);
 
-		//! \brief Clears all the attributes used by the SchemaParser
+		//! \brief Releases all the attributes used by the SchemaParser
 		void clearAttributes(void);
 
 		/*! \brief Forcing the class to be virtual. This means that derivated classes may
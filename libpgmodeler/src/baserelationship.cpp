@@ -71,40 +71,18 @@ void BaseRelationship::configureRelationship(void)
 {
 	obj_type=BASE_RELATIONSHIP;
 
-	attributes[ParsersAttributes::TYPE]="";
-	attributes[ParsersAttributes::SRC_REQUIRED]="";
-	attributes[ParsersAttributes::DST_REQUIRED]="";
-	attributes[ParsersAttributes::SRC_TABLE]="";
-	attributes[ParsersAttributes::DST_TABLE]="";
-	attributes[ParsersAttributes::POINTS]="";
-	attributes[ParsersAttributes::COLUMNS]="";
-	attributes[ParsersAttributes::CONSTRAINTS]="";
-	attributes[ParsersAttributes::ELEMENTS]="";
-	attributes[ParsersAttributes::IDENTIFIER]="";
-	attributes[ParsersAttributes::REDUCED_FORM]="";
-	attributes[ParsersAttributes::DEFERRABLE]="";
-	attributes[ParsersAttributes::DEFER_TYPE]="";
-	attributes[ParsersAttributes::TABLE_NAME]="";
-	attributes[ParsersAttributes::SPECIAL_PK_COLS]="";
-	attributes[ParsersAttributes::RELATIONSHIP_NN]="";
-	attributes[ParsersAttributes::RELATIONSHIP_GEN]="";
-	attributes[ParsersAttributes::RELATIONSHIP_DEP]="";
-	attributes[ParsersAttributes::RELATIONSHIP_1N]="";
-	attributes[ParsersAttributes::RELATIONSHIP_11]="";
-	attributes[ParsersAttributes::CONSTRAINTS]="";
-	attributes[ParsersAttributes::TABLE]="";
-	attributes[ParsersAttributes::ANCESTOR_TABLE]="";
-	attributes[ParsersAttributes::COPY_OPTIONS]="";
-	attributes[ParsersAttributes::COPY_MODE]="";
-	attributes[ParsersAttributes::SRC_COL_PATTERN]="";
-	attributes[ParsersAttributes::DST_COL_PATTERN]="";
-	attributes[ParsersAttributes::PK_PATTERN]="";
-	attributes[ParsersAttributes::UQ_PATTERN]="";
-	attributes[ParsersAttributes::SRC_FK_PATTERN]="";
-	attributes[ParsersAttributes::DST_FK_PATTERN]="";
-	attributes[ParsersAttributes::COL_INDEXES]="";
-	attributes[ParsersAttributes::CONSTR_INDEXES]="";
-	attributes[ParsersAttributes::ATTRIB_INDEXES]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_TYPE, ParsersAttributes::ID_SRC_REQUIRED, ParsersAttributes::ID_DST_REQUIRED,
+			ParsersAttributes::ID_SRC_TABLE, ParsersAttributes::ID_DST_TABLE, ParsersAttributes::ID_POINTS,
+			ParsersAttributes::ID_COLUMNS, ParsersAttributes::ID_CONSTRAINTS, ParsersAttributes::ID_ELEMENTS,
+			ParsersAttributes::ID_IDENTIFIER, ParsersAttributes::ID_REDUCED_FORM, ParsersAttributes::ID_DEFERRABLE,
+			ParsersAttributes::ID_DEFER_TYPE, ParsersAttributes::ID_TABLE_NAME, ParsersAttributes::ID_SPECIAL_PK_COLS,
+			ParsersAttributes::ID_RELATIONSHIP_NN, ParsersAttributes::ID_RELATIONSHIP_GEN, ParsersAttributes::ID_RELATIONSHIP_DEP,
+			ParsersAttributes::ID_RELATIONSHIP_1N, ParsersAttributes::ID_RELATIONSHIP_11, ParsersAttributes::ID_TABLE,
+			ParsersAttributes::ID_ANCESTOR_TABLE, ParsersAttributes::ID_COPY_OPTIONS, ParsersAttributes::ID_COPY_MODE,
+			ParsersAttributes::ID_SRC_COL_PATTERN, ParsersAttributes::ID_DST_COL_PATTERN, ParsersAttributes::ID_PK_PATTERN,
+			ParsersAttributes::ID_UQ_PATTERN, ParsersAttributes::ID_SRC_FK_PATTERN, ParsersAttributes::ID_DST_FK_PATTERN,
+			ParsersAttributes::ID_COL_INDEXES, ParsersAttributes::ID_CONSTR_INDEXES, ParsersAttributes::ID_ATTRIB_INDEXES };
+	declareAttributes(class_attribs);
 
 	//Check if the relationship type is valid
 	if(rel_type <= RELATIONSHIP_FK)
@@ -308,51 +286,51 @@ void BaseRelationship::setRelationshipAttributes(void)
 
 	switch(rel_type)
 	{
-		case RELATIONSHIP_11: attributes[ParsersAttributes::TYPE]=ParsersAttributes::RELATIONSHIP_11; break;
-		case RELATIONSHIP_1N: attributes[ParsersAttributes::TYPE]=ParsersAttributes::RELATIONSHIP_1N; break;
-		case RELATIONSHIP_NN: attributes[ParsersAttributes::TYPE]=ParsersAttributes::RELATIONSHIP_NN; break;
-		case RELATIONSHIP_GEN: attributes[ParsersAttributes::TYPE]=ParsersAttributes::RELATIONSHIP_GEN; break;
-		case RELATIONSHIP_FK: attributes[ParsersAttributes::TYPE]=ParsersAttributes::RELATIONSHIP_FK; break;
+		case RELATIONSHIP_11: attributes[ParsersAttributes::ID_TYPE]=ParsersAttributes::RELATIONSHIP_11; break;
+		case RELATIONSHIP_1N: attributes[ParsersAttributes::ID_TYPE]=ParsersAttributes::RELATIONSHIP_1N; break;
+		case RELATIONSHIP_NN: attributes[ParsersAttributes::ID_TYPE]=ParsersAttributes::RELATIONSHIP_NN; break;
+		case RELATIONSHIP_GEN: attributes[ParsersAttributes::ID_TYPE]=ParsersAttributes::RELATIONSHIP_GEN; break;
+		case RELATIONSHIP_FK: attributes[ParsersAttributes::ID_TYPE]=ParsersAttributes::RELATIONSHIP_FK; break;
 		default:
 			if(src_table->getObjectType()==OBJ_VIEW)
-				attributes[ParsersAttributes::TYPE]=ParsersAttributes::RELATION_TAB_VIEW;
+				attributes[ParsersAttributes::ID_TYPE]=ParsersAttributes::RELATION_TAB_VIEW;
 			else
-				attributes[ParsersAttributes::TYPE]=ParsersAttributes::RELATIONSHIP_DEP;
+				attributes[ParsersAttributes::ID_TYPE]=ParsersAttributes::RELATIONSHIP_DEP;
 		break;
 	}
 
-	attributes[ParsersAttributes::SRC_REQUIRED]=(src_mandatory ? "1" : "");
-	attributes[ParsersAttributes::DST_REQUIRED]=(dst_mandatory ? "1" : "");
+	attributes[ParsersAttributes::ID_SRC_REQUIRED]=(src_mandatory ? "1" : "");
+	attributes[ParsersAttributes::ID_DST_REQUIRED]=(dst_mandatory ? "1" : "");
 
 	if(src_table)
-		attributes[ParsersAttributes::SRC_TABLE]=src_table->getName(true);
+		attributes[ParsersAttributes::ID_SRC_TABLE]=src_table->getName(true);
 
 	if(dst_table)
-		attributes[ParsersAttributes::DST_TABLE]=dst_table->getName(true);
+		attributes[ParsersAttributes::ID_DST_TABLE]=dst_table->getName(true);
 
 
 	count=points.size();
 	for(i=0; i < count; i++)
 	{
-		attributes[ParsersAttributes::X_POS]=QString("%1").arg(points[i].x());
-		attributes[ParsersAttributes::Y_POS]=QString("%1").arg(points[i].y());
+		attributes[ParsersAttributes::ID_X_POS]=QString("%1").arg(points[i].x());
+		attributes[ParsersAttributes::ID_Y_POS]=QString("%1").arg(points[i].y());
 		str_aux+=SchemaParser::getCodeDefinition(ParsersAttributes::POSITION, attributes, SchemaParser::XML_DEFINITION);
 	}
-	attributes[ParsersAttributes::POINTS]=str_aux;
+	attributes[ParsersAttributes::ID_POINTS]=str_aux;
 
 	str_aux="";
 	for(i=0; i < 3; i++)
 	{
 		if(!std::isnan(lables_dist[i].x()))
 		{
-			attributes[ParsersAttributes::X_POS]=QString("%1").arg(lables_dist[i].x());
-			attributes[ParsersAttributes::Y_POS]=QString("%1").arg(lables_dist[i].y());
-			attributes[ParsersAttributes::POSITION]=SchemaParser::getCodeDefinition(ParsersAttributes::POSITION, attributes, SchemaParser::XML_DEFINITION);
-			attributes[ParsersAttributes::REF_TYPE]=label_attribs[i];
+			attributes[ParsersAttributes::ID_X_POS]=QString("%1").arg(lables_dist[i].x());
+			attributes[ParsersAttributes::ID_Y_POS]=QString("%1").arg(lables_dist[i].y());
+			attributes[ParsersAttributes::ID_POSITION]=SchemaParser::getCodeDefinition(ParsersAttributes::POSITION, attributes, SchemaParser::XML_DEFINITION);
+			attributes[ParsersAttributes::ID_REF_TYPE]=label_attribs[i];
 			str_aux+=SchemaParser::getCodeDefinition(ParsersAttributes::LABEL, attributes, SchemaParser::XML_DEFINITION);
 		}
 	}
-	attributes[ParsersAttributes::LABELS_POS]=str_aux;
+	attributes[ParsersAttributes::ID_LABELS_POS]=str_aux;
 }
 
 QString BaseRelationship::getCodeDefinition(unsigned def_type)
@@ -363,8 +341,8 @@ QString BaseRelationship::getCodeDefinition(unsigned def_type)
 	{
 		bool reduced_form;
 		setRelationshipAttributes();
-		reduced_form=(attributes[ParsersAttributes::POINTS].isEmpty() &&
-									attributes[ParsersAttributes::LABELS_POS].isEmpty());
+		reduced_form=(attributes[ParsersAttributes::ID_POINTS].isEmpty() &&
+									attributes[ParsersAttributes::ID_LABELS_POS].isEmpty());
 		return(BaseObject::getCodeDefinition(SchemaParser::XML_DEFINITION,reduced_form));
 	}
 }
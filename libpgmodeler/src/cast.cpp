@@ -24,11 +24,9 @@ Cast::Cast(void)
 	cast_function=nullptr;
 	cast_type=IMPLICIT;
 	is_in_out=false;
-	attributes[ParsersAttributes::SOURCE_TYPE]="";
-	attributes[ParsersAttributes::DEST_TYPE]="";
-	attributes[ParsersAttributes::SIGNATURE]="";
-	attributes[ParsersAttributes::CAST_TYPE]="";
-	attributes[ParsersAttributes::IO_CAST]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_SOURCE_TYPE, ParsersAttributes::ID_DEST_TYPE, ParsersAttributes::ID_SIGNATURE,
+			ParsersAttributes::ID_CAST_TYPE, ParsersAttributes::ID_IO_CAST };
+	declareAttributes(class_attribs);
 }
 
 void Cast::setDataType(unsigned type_idx, PgSQLType type)
@@ -52,6 +50,7 @@ void Cast::setDataType(unsigned type_idx, PgSQLType type)
 
 	//Configures the cast name (in form of signature: cast(src_type, dst_type) )
 	this->obj_name=QString("cast(%1,%2)").arg(~types[SRC_TYPE]).arg(~types[DST_TYPE]);
+	updateDatabaseIndex();
 }
 
 void Cast::setCastType(unsigned cast_type)
@@ -149,32 +148,32 @@ QString Cast::getCodeDefinition(unsigned def_type)
 {
 	if(def_type==SchemaParser::SQL_DEFINITION)
 	{
-		attributes[ParsersAttributes::SOURCE_TYPE]=(*types[SRC_TYPE]);
-		attributes[ParsersAttributes::DEST_TYPE]=(*types[DST_TYPE]);
+		attributes[ParsersAttributes::ID_SOURCE_TYPE]=(*types[SRC_TYPE]);
+		attributes[ParsersAttributes::ID_DEST_TYPE]=(*types[DST_TYPE]);
 	}
 	else
 	{
-		attributes[ParsersAttributes::SOURCE_TYPE]=types[SRC_TYPE].getCodeDefinition(def_type);
-		attributes[ParsersAttributes::DEST_TYPE]=types[DST_TYPE].getCodeDefinition(def_type);
+		attributes[ParsersAttributes::ID_SOURCE_TYPE]=types[SRC_TYPE].getCodeDefinition(def_type);
+		attributes[ParsersAttributes::ID_DEST_TYPE]=types[DST_TYPE].getCodeDefinition(def_type);
 	}
 
 	if(cast_function)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::SIGNATURE]=cast_function->getSignature();
+			attributes[ParsersAttributes::ID_SIGNATURE]=cast_function->getSignature();
 		else
-			attributes[ParsersAttributes::SIGNATURE]=cast_function->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::ID_SIGNATURE]=cast_function->getCodeDefinition(def_type, true);
 	}
 
 	if(cast_type==ASSIGNMENT)
-		attributes[ParsersAttributes::CAST_TYPE]=ParsersAttributes::ASSIGNMENT;
+		attributes[ParsersAttributes::ID_CAST_TYPE]=ParsersAttributes::ASSIGNMENT;
 	else
-		attributes[ParsersAttributes::CAST_TYPE]=ParsersAttributes::IMPLICIT;
+		attributes[ParsersAttributes::ID_CAST_TYPE]=ParsersAttributes::IMPLICIT;
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
-		attributes[ParsersAttributes::CAST_TYPE]=attributes[ParsersAttributes::CAST_TYPE].toUpper();
+		attributes[ParsersAttributes::ID_CAST_TYPE]=attributes[ParsersAttributes::ID_CAST_TYPE].toUpper();
 
-	attributes[ParsersAttributes::IO_CAST]=(is_in_out ? "1" : "");
+	attributes[ParsersAttributes::ID_IO_CAST]=(is_in_out ? "1" : "");
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
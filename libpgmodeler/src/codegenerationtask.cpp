@@ -0,0 +1,76 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "codegenerationtask.h"
+#include "databasemodel.h"
+
+CodeGenerationTask::CodeGenerationTask(DatabaseModel *model, vector<BaseObject *> &objects, vector<QString> &definitions,
+																			 QAtomicInt &next_obj, QAtomicInt &aborted, unsigned def_type)
+{
+	this->model=model;
+	this->objects=&objects;
+	this->definitions=&definitions;
+	this->next_obj=&next_obj;
+	this->aborted=&aborted;
+	this->def_type=def_type;
+	this->error_idx=-1;
+
+	//The worker thread must use the same PostgreSQL version as the thread that created the task
+	pgsql_ver=SchemaParser::getPgSQLVersion();
+
+	//The task is destroyed by the model after checking the errors
+	setAutoDelete(false);
+}
+
+void CodeGenerationTask::run(void)
+{
+	int idx, count=objects->size();
+	BaseObject *object=nullptr;
+
+	SchemaParser::setPgSQLVersion(pgsql_ver);
+
+	while(aborted->load()==0)
+	{
+		idx=next_obj->fetchAndAddOrdered(1);
+		if(idx >= count) break;
+
+		object=objects->at(idx);
+		if(!object) continue;
+
+		try
+		{
+			(*definitions)[idx]=model->getObjectCodeDefinition(object, def_type);
+		}
+		catch(Exception &e)
+		{
+			error_idx=idx;
+			error=e;
+			aborted->store(1);
+		}
+	}
+}
+
+int CodeGenerationTask::getErrorIndex(void)
+{
+	return(error_idx);
+}
+
+Exception CodeGenerationTask::getError(void)
+{
+	return(error);
+}
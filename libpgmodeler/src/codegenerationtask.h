@@ -0,0 +1,83 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class CodeGenerationTask
+\brief Implements a worker used by DatabaseModel to generate the code definition of several objects
+ at the same time. Each task picks the next object not yet generated from a shared list and stores the
+ generated code on the same position of the definitions list, so the results can be concatenated
+ in the original order after all tasks finish.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef CODE_GENERATION_TASK_H
+#define CODE_GENERATION_TASK_H
+
+#include <QRunnable>
+#include <QAtomicInt>
+#include <vector>
+#include "baseobject.h"
+
+class DatabaseModel;
+
+class CodeGenerationTask: public QRunnable {
+	private:
+		//! \brief Model that owns the objects
+		DatabaseModel *model;
+
+		/*! \brief Objects to be generated. Null positions are ignored since they are
+		 generated by the model itself in the calling thread */
+		vector<BaseObject *> *objects;
+
+		//! \brief Generated definitions (one for each object)
+		vector<QString> *definitions;
+
+		//! \brief Index of the next object to be generated (shared between all tasks)
+		QAtomicInt *next_obj;
+
+		//! \brief Flag shared between all tasks indicating that one of them failed and the others must stop
+		QAtomicInt *aborted;
+
+		//! \brief Code definition type (SQL or XML)
+		unsigned def_type;
+
+		//! \brief PostgreSQL version used by the thread that created the task
+		QString pgsql_ver;
+
+		//! \brief Position of the object that raised an error (-1 when no error occurred)
+		int error_idx;
+
+		//! \brief Error raised when generating the code of the object at 'error_idx'
+		Exception error;
+
+	public:
+		CodeGenerationTask(DatabaseModel *model, vector<BaseObject *> &objects, vector<QString> &definitions,
+											 QAtomicInt &next_obj, QAtomicInt &aborted, unsigned def_type);
+
+		//! \brief Generates the objects' code until the list ends or another task fails
+		void run(void);
+
+		//! \brief Returns the position of the object that raised an error (-1 when no error occurred)
+		int getErrorIndex(void);
+
+		//! \brief Returns the error raised by the task
+		Exception getError(void);
+};
+
+#endif
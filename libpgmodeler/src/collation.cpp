@@ -23,10 +23,9 @@ Collation::Collation(void)
 	obj_type=OBJ_COLLATION;
 	encoding=BaseType::null;
 
-	attributes[ParsersAttributes::_LC_CTYPE_]="";
-	attributes[ParsersAttributes::_LC_COLLATE_]="";
-	attributes[ParsersAttributes::LOCALE]="";
-	attributes[ParsersAttributes::ENCODING]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID__LC_CTYPE_, ParsersAttributes::ID__LC_COLLATE_, ParsersAttributes::ID_LOCALE,
+			ParsersAttributes::ID_ENCODING };
+	declareAttributes(class_attribs);
 }
 
 void Collation::setLocale(const QString &locale)
@@ -100,13 +99,15 @@ QString Collation::getCodeDefinition(unsigned def_type)
 
 QString Collation::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
+	QMutexLocker locker(&code_gen_mutex);
+
 	if(!locale.isEmpty())
-		attributes[ParsersAttributes::LOCALE]=locale;
+		attributes[ParsersAttributes::ID_LOCALE]=locale;
 	else if(collation)
-		attributes[ParsersAttributes::COLLATION]=collation->getName(true);
+		attributes[ParsersAttributes::ID_COLLATION]=collation->getName(true);
 	else
 	{
-		QString lc_attribs[2]={ ParsersAttributes::_LC_CTYPE_, ParsersAttributes::_LC_COLLATE_ };
+		unsigned lc_attribs[2]={ ParsersAttributes::ID__LC_CTYPE_, ParsersAttributes::ID__LC_COLLATE_ };
 		int lc_ids[2]={ LC_CTYPE, LC_COLLATE };
 
 		if(localization[0].isEmpty() && localization[1].isEmpty())
@@ -122,6 +123,6 @@ QString Collation::getCodeDefinition(unsigned def_type, bool reduced_form)
 		}
 	}
 
-	attributes[ParsersAttributes::ENCODING]=~encoding;
+	attributes[ParsersAttributes::ID_ENCODING]=~encoding;
 	return(BaseObject::getCodeDefinition(def_type, reduced_form));
 }
@@ -22,10 +22,9 @@ Column::Column(void)
 {
 	obj_type=OBJ_COLUMN;
 	not_null=false;
-	attributes[ParsersAttributes::TYPE]="";
-	attributes[ParsersAttributes::DEFAULT_VALUE]="";
-	attributes[ParsersAttributes::NOT_nullptr]="";
-	attributes[ParsersAttributes::TABLE]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_TYPE, ParsersAttributes::ID_DEFAULT_VALUE, ParsersAttributes::ID_NOT_nullptr,
+			ParsersAttributes::ID_TABLE };
+	declareAttributes(class_attribs);
 }
 
 void Column::setName(const QString &name)
@@ -43,6 +42,9 @@ void Column::setName(const QString &name)
 		/* Case no error is raised stored the old name on the
 		 respective column attribute */
 		this->old_name=prev_name;
+
+		//Updates the parent table's index of columns by old name
+		updateDatabaseIndex();
 	}
 	catch(Exception &e)
 	{
@@ -103,11 +105,11 @@ QString Column::getOldName(bool format)
 QString Column::getCodeDefinition(unsigned def_type)
 {
 	if(this->parent_table)
-		attributes[ParsersAttributes::TABLE]=this->parent_table->getName(true);
+		attributes[ParsersAttributes::ID_TABLE]=this->parent_table->getName(true);
 
-	attributes[ParsersAttributes::TYPE]=type.getCodeDefinition(def_type);
-	attributes[ParsersAttributes::DEFAULT_VALUE]=default_value;
-	attributes[ParsersAttributes::NOT_nullptr]=(!not_null ? "" : "1");
+	attributes[ParsersAttributes::ID_TYPE]=type.getCodeDefinition(def_type);
+	attributes[ParsersAttributes::ID_DEFAULT_VALUE]=default_value;
+	attributes[ParsersAttributes::ID_NOT_nullptr]=(!not_null ? "" : "1");
 	return(BaseObject::__getCodeDefinition(def_type));
 }
 
@@ -26,26 +26,14 @@ Constraint::Constraint(void)
 	no_inherit=false;
 	fill_factor=100;
 
-	attributes[ParsersAttributes::PK_CONSTR]="";
-	attributes[ParsersAttributes::FK_CONSTR]="";
-	attributes[ParsersAttributes::CK_CONSTR]="";
-	attributes[ParsersAttributes::UQ_CONSTR]="";
-	attributes[ParsersAttributes::EX_CONSTR]="";
-	attributes[ParsersAttributes::REF_TABLE]="";
-	attributes[ParsersAttributes::SRC_COLUMNS]="";
-	attributes[ParsersAttributes::DST_COLUMNS]="";
-	attributes[ParsersAttributes::DEL_ACTION]="";
-	attributes[ParsersAttributes::UPD_ACTION]="";
-	attributes[ParsersAttributes::EXPRESSION]="";
-	attributes[ParsersAttributes::TYPE]="";
-	attributes[ParsersAttributes::COMPARISON_TYPE]="";
-	attributes[ParsersAttributes::DEFER_TYPE]="";
-	attributes[ParsersAttributes::DEFERRABLE]="";
-	attributes[ParsersAttributes::TABLE]="";
-	attributes[ParsersAttributes::DECL_IN_TABLE]="";
-	attributes[ParsersAttributes::FACTOR]="";
-	attributes[ParsersAttributes::NO_INHERIT]="";
-	attributes[ParsersAttributes::ELEMENTS]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_PK_CONSTR, ParsersAttributes::ID_FK_CONSTR, ParsersAttributes::ID_CK_CONSTR,
+			ParsersAttributes::ID_UQ_CONSTR, ParsersAttributes::ID_EX_CONSTR, ParsersAttributes::ID_REF_TABLE,
+			ParsersAttributes::ID_SRC_COLUMNS, ParsersAttributes::ID_DST_COLUMNS, ParsersAttributes::ID_DEL_ACTION,
+			ParsersAttributes::ID_UPD_ACTION, ParsersAttributes::ID_EXPRESSION, ParsersAttributes::ID_TYPE,
+			ParsersAttributes::ID_COMPARISON_TYPE, ParsersAttributes::ID_DEFER_TYPE, ParsersAttributes::ID_DEFERRABLE,
+			ParsersAttributes::ID_TABLE, ParsersAttributes::ID_DECL_IN_TABLE, ParsersAttributes::ID_FACTOR,
+			ParsersAttributes::ID_NO_INHERIT, ParsersAttributes::ID_ELEMENTS };
+	declareAttributes(class_attribs);
 }
 
 Constraint::~Constraint(void)
@@ -151,6 +139,10 @@ void Constraint::addColumn(Column *column, unsigned col_type)
 				ref_columns.push_back(column);
 			else
 				columns.push_back(column);
+
+			/* The columns can be added to a constraint already on the model (e.g. the ones merged
+				 by relationships to the primary key of the receiver table) */
+			updateDatabaseReferences();
 		}
 	}
 }
@@ -321,6 +313,7 @@ void Constraint::removeColumns(void)
 {
 	columns.clear();
 	ref_columns.clear();
+	updateDatabaseReferences();
 }
 
 void Constraint::removeColumn(const QString &name, unsigned col_type)
@@ -347,6 +340,7 @@ void Constraint::removeColumn(const QString &name, unsigned col_type)
 		{
 			//Remove its iterator from the list
 			cols->erase(itr);
+			updateDatabaseReferences();
 			break;
 		}
 		else itr++;
@@ -560,7 +554,7 @@ void Constraint::setExcludeElementsAttribute(unsigned def_type)
 		if(i < (count-1) && def_type==SchemaParser::SQL_DEFINITION) str_elem+=",";
 	}
 
-	attributes[ParsersAttributes::ELEMENTS]=str_elem;
+	attributes[ParsersAttributes::ID_ELEMENTS]=str_elem;
 }
 
 QString Constraint::getCodeDefinition(unsigned def_type)
@@ -572,11 +566,11 @@ QString Constraint::getCodeDefinition(unsigned def_type, bool inc_addedbyrel)
 {
 	QString attrib;
 
-	attributes[ParsersAttributes::PK_CONSTR]="";
-	attributes[ParsersAttributes::FK_CONSTR]="";
-	attributes[ParsersAttributes::CK_CONSTR]="";
-	attributes[ParsersAttributes::UQ_CONSTR]="";
-	attributes[ParsersAttributes::EX_CONSTR]="";
+	attributes[ParsersAttributes::ID_PK_CONSTR]="";
+	attributes[ParsersAttributes::ID_FK_CONSTR]="";
+	attributes[ParsersAttributes::ID_CK_CONSTR]="";
+	attributes[ParsersAttributes::ID_UQ_CONSTR]="";
+	attributes[ParsersAttributes::ID_EX_CONSTR]="";
 
 	switch(!constr_type)
 	{
@@ -598,10 +592,10 @@ QString Constraint::getCodeDefinition(unsigned def_type, bool inc_addedbyrel)
 	}
 	attributes[attrib]="1";
 
-	attributes[ParsersAttributes::TYPE]=attrib;
-	attributes[ParsersAttributes::UPD_ACTION]=(~upd_action);
-	attributes[ParsersAttributes::DEL_ACTION]=(~del_action);
-	attributes[ParsersAttributes::EXPRESSION]=check_expr;
+	attributes[ParsersAttributes::ID_TYPE]=attrib;
+	attributes[ParsersAttributes::ID_UPD_ACTION]=(~upd_action);
+	attributes[ParsersAttributes::ID_DEL_ACTION]=(~del_action);
+	attributes[ParsersAttributes::ID_EXPRESSION]=check_expr;
 
 	if(constr_type!=ConstraintType::check)
 	{
@@ -619,24 +613,24 @@ QString Constraint::getCodeDefinition(unsigned def_type, bool inc_addedbyrel)
 			setColumnsAttribute(REFERENCED_COLS, def_type, inc_addedbyrel);
 	}
 
-	attributes[ParsersAttributes::REF_TABLE]=(ref_table ? ref_table->getName(true) : "");
-	attributes[ParsersAttributes::DEFERRABLE]=(deferrable ? "1" : "");
-	attributes[ParsersAttributes::NO_INHERIT]=(no_inherit ? "1" : "");
-	attributes[ParsersAttributes::COMPARISON_TYPE]=(~match_type);
-	attributes[ParsersAttributes::DEFER_TYPE]=(~deferral_type);
+	attributes[ParsersAttributes::ID_REF_TABLE]=(ref_table ? ref_table->getName(true) : "");
+	attributes[ParsersAttributes::ID_DEFERRABLE]=(deferrable ? "1" : "");
+	attributes[ParsersAttributes::ID_NO_INHERIT]=(no_inherit ? "1" : "");
+	attributes[ParsersAttributes::ID_COMPARISON_TYPE]=(~match_type);
+	attributes[ParsersAttributes::ID_DEFER_TYPE]=(~deferral_type);
 
 	if(this->parent_table)
-		attributes[ParsersAttributes::TABLE]=this->parent_table->getName(true);
+		attributes[ParsersAttributes::ID_TABLE]=this->parent_table->getName(true);
 
 	/* Case the constraint doesn't referece some column added by relationship it will be declared
 		inside the parent table construction by the use of 'decl-in-table' schema attribute. */
 	if(!isReferRelationshipAddedColumn() || constr_type==ConstraintType::primary_key)
-		attributes[ParsersAttributes::DECL_IN_TABLE]="1";
+		attributes[ParsersAttributes::ID_DECL_IN_TABLE]="1";
 
 	if(constr_type==ConstraintType::primary_key || constr_type==ConstraintType::unique)
-		attributes[ParsersAttributes::FACTOR]=QString("%1").arg(fill_factor);
+		attributes[ParsersAttributes::ID_FACTOR]=QString("%1").arg(fill_factor);
 	else
-		attributes[ParsersAttributes::FACTOR]="";
+		attributes[ParsersAttributes::ID_FACTOR]="";
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
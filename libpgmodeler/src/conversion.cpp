@@ -23,10 +23,9 @@ Conversion::Conversion(void)
 	obj_type=OBJ_CONVERSION;
 	conversion_func=nullptr;
 	is_default=false;
-	attributes[ParsersAttributes::DEFAULT]="";
-	attributes[ParsersAttributes::SRC_ENCODING]="";
-	attributes[ParsersAttributes::DST_ENCODING]="";
-	attributes[ParsersAttributes::FUNCTION]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_DEFAULT, ParsersAttributes::ID_SRC_ENCODING, ParsersAttributes::ID_DST_ENCODING,
+			ParsersAttributes::ID_FUNCTION };
+	declareAttributes(class_attribs);
 }
 
 void Conversion::setEncoding(unsigned encoding_idx, EncodingType encoding_type)
@@ -110,16 +109,16 @@ bool Conversion::isDefault(void)
 
 QString Conversion::getCodeDefinition(unsigned def_type)
 {
-	attributes[ParsersAttributes::DEFAULT]=(is_default ? "1" : "");
-	attributes[ParsersAttributes::SRC_ENCODING]=(~encodings[SRC_ENCODING]);
-	attributes[ParsersAttributes::DST_ENCODING]=(~encodings[DST_ENCODING]);
+	attributes[ParsersAttributes::ID_DEFAULT]=(is_default ? "1" : "");
+	attributes[ParsersAttributes::ID_SRC_ENCODING]=(~encodings[SRC_ENCODING]);
+	attributes[ParsersAttributes::ID_DST_ENCODING]=(~encodings[DST_ENCODING]);
 
 	if(conversion_func)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::FUNCTION]=conversion_func->getName(true);
+			attributes[ParsersAttributes::ID_FUNCTION]=conversion_func->getName(true);
 		else
-			attributes[ParsersAttributes::FUNCTION]=conversion_func->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::ID_FUNCTION]=conversion_func->getCodeDefinition(def_type, true);
 	}
 
 	return(BaseObject::__getCodeDefinition(def_type));
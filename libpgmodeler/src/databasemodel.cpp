@@ -30,11 +30,12 @@ DatabaseModel::DatabaseModel(void)
 
 	conn_limit=-1;
 	loading_model=invalidated=false;
-	attributes[ParsersAttributes::ENCODING]="";
-	attributes[ParsersAttributes::TEMPLATE_DB]="";
-	attributes[ParsersAttributes::CONN_LIMIT]="";
-	attributes[ParsersAttributes::_LC_COLLATE_]="";
-	attributes[ParsersAttributes::_LC_CTYPE_]="";
+	invalid_refs_index=true;
+	code_gen_threads=1;
+	load_threads=1;
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_ENCODING, ParsersAttributes::ID_TEMPLATE_DB, ParsersAttributes::ID_CONN_LIMIT,
+			ParsersAttributes::ID__LC_COLLATE_, ParsersAttributes::ID__LC_CTYPE_ };
+	declareAttributes(class_attribs);
 }
 
 DatabaseModel::~DatabaseModel(void)
@@ -83,6 +84,22 @@ void DatabaseModel::setAuthor(const QString &author)
 	this->author=author;
 }
 
+void DatabaseModel::setCodeGenerationThreads(unsigned thread_cnt)
+{
+	if(thread_cnt==0)
+		code_gen_threads=QThread::idealThreadCount();
+	else
+		code_gen_threads=thread_cnt;
+}
+
+void DatabaseModel::setLoadingThreads(unsigned thread_cnt)
+{
+	if(thread_cnt==0)
+		load_threads=QThread::idealThreadCount();
+	else
+		load_threads=thread_cnt;
+}
+
 vector<BaseObject *> *DatabaseModel::getObjectList(ObjectType obj_type)
 {
 	if(obj_type==OBJ_TEXTBOX)
@@ -391,7 +408,22 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	obj_list=getObjectList(object->getObjectType());
 
 	if(obj_idx < 0 || obj_idx >= static_cast<int>(obj_list->size()))
+	{
 		obj_list->push_back(object);
+
+		//Objects appended on the list are inserted directly on the index (when it's valid)
+		if(obj_indexes.count(obj_type) && !invalid_indexes[obj_type])
+		{
+			QString key=getObjectIndexKey(object);
+
+			if(!obj_indexes[obj_type].contains(key))
+				obj_indexes[obj_type][key]=obj_list->size()-1;
+			else
+				dup_index_keys[obj_type].insert(key);
+
+			obj_index_keys[object]=key;
+		}
+	}
 	else
 	{
 		if(obj_idx >=0 && idx < 0)
@@ -403,10 +435,16 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 			obj_list->insert((obj_list->begin() + idx), object);
 		else
 			obj_list->push_back(object);
+
+		//Inserting the object in the middle of the list changes the position of the subsequent ones
+		invalidateObjectIndex(obj_type);
 	}
 
 	object->setDatabase(this);
 
+	if(!invalid_refs_index)
+		addObjectReferences(object, true);
+
 	if(!signalsBlocked())
 		emit s_objectAdded(object);
 }
@@ -478,6 +516,13 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx)
 			{
 				removePermissions(object);
 				obj_list->erase(obj_list->begin() + obj_idx);
+
+				//Removing the object changes the position of the subsequent ones
+				invalidateObjectIndex(obj_type);
+				obj_index_keys.remove(object);
+
+				if(!invalid_refs_index)
+					removeObjectReferences(object, true, true);
 			}
 		}
 
@@ -511,62 +556,133 @@ vector<BaseObject *> DatabaseModel::getObjects(ObjectType obj_type, BaseObject *
 	return(sel_list);
 }
 
-BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
+QString DatabaseModel::getObjectIndexKey(BaseObject *object)
 {
-	BaseObject *object=nullptr;
-	vector<BaseObject *> *obj_list=nullptr;
-	vector<BaseObject *>::iterator itr, itr_end;
-	bool found=false, formatted=false;
-	QString aux_name, aux_name1;
+	/* Special case for functions/operators: to check duplicity the signature must be
+		 compared and not only the name */
+	if(object->getObjectType()==OBJ_FUNCTION)
+		return(dynamic_cast<Function *>(object)->getSignature());
+	else if(object->getObjectType()==OBJ_OPERATOR)
+		return(dynamic_cast<Operator *>(object)->getSignature());
+	else
+		return(object->getName(true));
+}
 
-	obj_list=getObjectList(obj_type);
+void DatabaseModel::createObjectIndex(ObjectType obj_type)
+{
+	vector<BaseObject *> *obj_list=getObjectList(obj_type);
+	QHash<QString, int> &index=obj_indexes[obj_type];
+	QString key;
+	unsigned i, count;
 
-	if(!obj_list)
-		throw Exception(ERR_OBT_OBJ_INVALID_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-	else
+	index.clear();
+	dup_index_keys[obj_type].clear();
+	count=obj_list->size();
+
+	for(i=0; i < count; i++)
 	{
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
-		obj_idx=-1;
-		formatted=name.contains("\"") || name.contains(".");
-		aux_name1=name;
+		key=getObjectIndexKey(obj_list->at(i));
 
-		if(obj_type!=OBJ_FUNCTION && obj_type!=OBJ_OPERATOR)
-		{
-			if(!formatted)
-				aux_name1=BaseObject::formatName(aux_name1);
+		//In case of duplicated names the first object on the list is the one returned by the search
+		if(!index.contains(key))
+			index[key]=i;
+		else
+			dup_index_keys[obj_type].insert(key);
 
-			while(itr!=itr_end && !found)
-			{
-				aux_name=(*itr)->getName(true);
-				found=(aux_name==aux_name1);
-				if(!found) itr++;
-			}
+		obj_index_keys[obj_list->at(i)]=key;
+	}
+
+	invalid_indexes[obj_type]=false;
+}
+
+void DatabaseModel::invalidateObjectIndex(ObjectType obj_type)
+{
+	invalid_indexes[obj_type]=true;
+}
+
+void DatabaseModel::updateObjectIndex(BaseObject *object)
+{
+	ObjectType obj_type;
+
+	if(!object || !obj_index_keys.contains(object))
+		return;
+
+	obj_type=object->getObjectType();
+
+	//Renaming a schema changes the formatted name of all objects that belongs to it
+	if(obj_type==OBJ_SCHEMA)
+	{
+		map<ObjectType, QHash<QString, int> >::iterator itr=obj_indexes.begin();
+
+		while(itr!=obj_indexes.end())
+		{
+			invalidateObjectIndex(itr->first);
+			itr++;
 		}
-		else
+	}
+	else
+	{
+		//The operators signatures are formed by the name of the types (which can be tables, sequences, domains, etc)
+		if(obj_type==OBJ_TYPE || obj_type==OBJ_DOMAIN || obj_type==OBJ_TABLE ||
+			 obj_type==OBJ_VIEW || obj_type==OBJ_SEQUENCE || obj_type==OBJ_EXTENSION)
+			invalidateObjectIndex(OBJ_OPERATOR);
+
+		if(!invalid_indexes[obj_type])
 		{
-			QString signature;
+			QString prev_key=obj_index_keys[object], new_key=getObjectIndexKey(object);
 
-			while(itr!=itr_end && !found)
+			if(prev_key!=new_key)
 			{
-				/* Special case for functions/operators: to check duplicity the signature must be
-			 compared and not only the name */
-				if(obj_type==OBJ_FUNCTION)
-					signature=dynamic_cast<Function *>(*itr)->getSignature();
+				QHash<QString, int> &index=obj_indexes[obj_type];
+				vector<BaseObject *> *obj_list=getObjectList(obj_type);
+				int pos=index.value(prev_key, -1);
+
+				/* If the object isn't found on the index using its previous key, the previous key is still used by
+					 other objects or the new key is already used by another object the index is recreated in the next search */
+				if(pos < 0 || obj_list->at(pos)!=object ||
+					 dup_index_keys[obj_type].contains(prev_key) || index.contains(new_key))
+					invalidateObjectIndex(obj_type);
 				else
-					signature=dynamic_cast<Operator *>(*itr)->getSignature();
-
-				found=(signature==aux_name1);
-				if(!found) itr++;
+				{
+					index.remove(prev_key);
+					index[new_key]=pos;
+					obj_index_keys[object]=new_key;
+				}
 			}
 		}
+	}
+}
 
-		if(found)
+BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
+{
+	BaseObject *object=nullptr;
+	vector<BaseObject *> *obj_list=nullptr;
+	QHash<QString, int>::iterator itr;
+	QString aux_name=name;
+
+	obj_list=getObjectList(obj_type);
+	obj_idx=-1;
+
+	if(!obj_list)
+		throw Exception(ERR_OBT_OBJ_INVALID_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	else
+	{
+		/* The name is formatted (if not yet) in order to be compared with the formatted names stored on the index.
+			 Functions and operators are searched by their signatures */
+		if(obj_type!=OBJ_FUNCTION && obj_type!=OBJ_OPERATOR &&
+			 !name.contains("\"") && !name.contains("."))
+			aux_name=BaseObject::formatName(aux_name);
+
+		if(obj_indexes.count(obj_type)==0 || invalid_indexes[obj_type])
+			createObjectIndex(obj_type);
+
+		itr=obj_indexes[obj_type].find(aux_name);
+
+		if(itr!=obj_indexes[obj_type].end())
 		{
-			object=(*itr);
-			obj_idx=(itr-obj_list->begin());
+			obj_idx=itr.value();
+			object=obj_list->at(obj_idx);
 		}
-		else obj_idx=-1;
 	}
 
 	return(object);
@@ -651,6 +767,16 @@ QString DatabaseModel::getAuthor(void)
 	return(author);
 }
 
+unsigned DatabaseModel::getCodeGenerationThreads(void)
+{
+	return(code_gen_threads);
+}
+
+unsigned DatabaseModel::getLoadingThreads(void)
+{
+	return(load_threads);
+}
+
 void DatabaseModel::setProtected(bool value)
 {
 	ObjectType types[19]={
@@ -698,6 +824,11 @@ void DatabaseModel::destroyObjects(void)
 	BaseObject *object=nullptr;
 	unsigned i, cnt=sizeof(types)/sizeof(ObjectType);
 
+	//The references index isn't maintained while the objects are destroyed
+	invalid_refs_index=true;
+	obj_referrers.clear();
+	obj_referenced.clear();
+
 	disconnectRelationships();
 
 	for(i=0; i < cnt; i++)
@@ -715,6 +846,11 @@ void DatabaseModel::destroyObjects(void)
 			list->pop_back();
 		}
 	}
+
+	obj_indexes.clear();
+	obj_index_keys.clear();
+	dup_index_keys.clear();
+	invalid_indexes.clear();
 }
 
 void DatabaseModel::addTable(Table *table, int obj_idx)
@@ -1097,10 +1233,14 @@ void DatabaseModel::disconnectRelationships(void)
 
 void DatabaseModel::validateRelationships(void)
 {
+	static Profiler::Entry *validate_tm=Profiler::getTimer("model.validate-relationships");
+	Profiler::Timer validate_timer(validate_tm);
 	vector<BaseObject *>::iterator itr, itr_end, itr_ant;
+	vector<BaseObject *>::reverse_iterator ritr, ritr_end;
 	Relationship *rel=nullptr;
 	BaseRelationship *base_rel=nullptr;
-	vector<BaseObject *> vet_rel, vet_rel_inv, rels;
+	vector<BaseObject *> vet_rel_inv, rels;
+	set<BaseObject *> reval_rels;
 	bool found_inval_rel;
 	vector<Exception> errors;
 	map<unsigned, QString>::iterator itr1, itr1_end;
@@ -1151,9 +1291,6 @@ void DatabaseModel::validateRelationships(void)
 				//Makes a cast to the correct object class
 				rel=dynamic_cast<Relationship *>(base_rel);
 
-				if(!loading_model)
-					rel->saveObjectsIndexes();
-
 				//If the relationships is invalid
 				if(rel->isInvalidated())
 				{
@@ -1163,9 +1300,6 @@ void DatabaseModel::validateRelationships(void)
 					//Marks the flag indicating the at least one relationship was found invalidated
 					found_inval_rel=true;
 				}
-				else
-					//Otherwise inserts the relationship on the valid relationships
-					vet_rel.push_back(base_rel);
 			}
 		}
 
@@ -1176,16 +1310,30 @@ void DatabaseModel::validateRelationships(void)
 			if(!loading_model && xml_special_objs.empty())
 				storeSpecialObjectsXML();
 
-			//Disconnects all the relationship
-			disconnectRelationships();
-
-			/* Merges the two lists (valid and invalid relationships),
-			taking care to insert the invalid ones at the end of the list */
-			rels=vet_rel;
-			rels.insert(rels.end(), vet_rel_inv.begin(), vet_rel_inv.end());
-			vet_rel.clear();
+			//Gets only the relationships affected by the invalidated ones in the order they must be connected
+			rels=getRelationshipsToRevalidate(vet_rel_inv);
 			vet_rel_inv.clear();
 
+			/* Saves the objects indexes of the relationships before disconnect them. This is done only
+			 in the first time the relationship is revalidated in order to preserve the original positions */
+			itr=rels.begin();
+			itr_end=rels.end();
+			while(itr!=itr_end)
+			{
+				if(reval_rels.insert(*itr).second && !loading_model)
+					dynamic_cast<Relationship *>(*itr)->saveObjectsIndexes();
+				itr++;
+			}
+
+			//The relationships are disconnected from the last to the first
+			ritr=rels.rbegin();
+			ritr_end=rels.rend();
+			while(ritr!=ritr_end)
+			{
+				dynamic_cast<Relationship *>(*ritr)->disconnectRelationship();
+				ritr++;
+			}
+
 			//Walking through the created list connecting the relationships
 			itr=rels.begin();
 			itr_end=rels.end();
@@ -1289,6 +1437,10 @@ void DatabaseModel::validateRelationships(void)
 				while(itr1!=itr1_end);
 			}
 		}
+
+		//Checks again all the relationships since the connections may invalidate other ones
+		itr=relationships.begin();
+		itr_end=relationships.end();
 	}
 	//The validation continues until there is some invalid relationship
 	while(found_inval_rel);
@@ -1340,14 +1492,157 @@ void DatabaseModel::validateRelationships(void)
 	itr=relationships.begin();
 	itr_end=relationships.end();
 
+	/* Restores the objects indexes of the revalidated relationships. While loading the model the
+		 indexes of all relationships are restored since they were read from the file */
 	while(itr!=itr_end)
 	{
 		rel=dynamic_cast<Relationship *>(*itr);
-		rel->restoreObjectsIndexes();
+
+		if(loading_model || reval_rels.count(rel))
+			rel->restoreObjectsIndexes();
+
 		itr++;
 	}
 }
 
+vector<BaseObject *> DatabaseModel::getRelationshipsToRevalidate(vector<BaseObject *> &inv_rels)
+{
+	map<BaseTable *, vector<Relationship *> > rels_by_ref_tab;
+	map<Relationship *, unsigned> rel_pos, in_degree;
+	map<unsigned, Relationship *> ready_rels, pend_rels;
+	set<Relationship *> affected_rels;
+	set<Relationship *>::iterator itr_rel;
+	set<BaseTable *> visited_tabs;
+	vector<BaseTable *> tables;
+	vector<Relationship *>::iterator itr, itr_end;
+	vector<BaseObject *> sorted_rels;
+	Relationship *rel=nullptr;
+	BaseTable *table=nullptr;
+	unsigned i, count=relationships.size();
+
+	/* Maps each table to the relationships that propagates its columns. For n-n relationships both
+		 tables are the reference ones since the generated table receives columns from them */
+	for(i=0; i < count; i++)
+	{
+		rel=dynamic_cast<Relationship *>(relationships[i]);
+		if(!rel) continue;
+
+		rel_pos[rel]=i;
+
+		if(rel->getRelationshipType()==Relationship::RELATIONSHIP_NN)
+		{
+			rels_by_ref_tab[rel->getTable(BaseRelationship::SRC_TABLE)].push_back(rel);
+
+			if(rel->getTable(BaseRelationship::DST_TABLE)!=rel->getTable(BaseRelationship::SRC_TABLE))
+				rels_by_ref_tab[rel->getTable(BaseRelationship::DST_TABLE)].push_back(rel);
+		}
+		else if(rel->getReferenceTable())
+			rels_by_ref_tab[rel->getReferenceTable()].push_back(rel);
+	}
+
+	//The tables of the invalidated relationships are the start point of the search
+	for(i=0; i < inv_rels.size(); i++)
+	{
+		rel=dynamic_cast<Relationship *>(inv_rels[i]);
+		affected_rels.insert(rel);
+		tables.push_back(rel->getTable(BaseRelationship::SRC_TABLE));
+		tables.push_back(rel->getTable(BaseRelationship::DST_TABLE));
+
+		if(rel->getReceiverTable())
+			tables.push_back(rel->getReceiverTable());
+	}
+
+	/* Walks through the tables affected by the revalidation: each relationship that propagates
+		 columns from an affected table needs to be revalidated too, so its receiver table is affected as well */
+	while(!tables.empty())
+	{
+		table=tables.back();
+		tables.pop_back();
+
+		if(!table || !visited_tabs.insert(table).second || rels_by_ref_tab.count(table)==0)
+			continue;
+
+		itr=rels_by_ref_tab[table].begin();
+		itr_end=rels_by_ref_tab[table].end();
+
+		while(itr!=itr_end)
+		{
+			rel=(*itr);
+			itr++;
+
+			if(affected_rels.insert(rel).second && rel->getReceiverTable())
+				tables.push_back(rel->getReceiverTable());
+		}
+	}
+
+	/* Counts, for each affected relationship, the amount of affected relationships
+		 that add columns to its reference tables */
+	itr_rel=affected_rels.begin();
+	while(itr_rel!=affected_rels.end())
+	{
+		table=(*itr_rel)->getReceiverTable();
+
+		if(table && rels_by_ref_tab.count(table))
+		{
+			itr=rels_by_ref_tab[table].begin();
+			itr_end=rels_by_ref_tab[table].end();
+
+			while(itr!=itr_end)
+			{
+				if((*itr)!=(*itr_rel) && affected_rels.count(*itr))
+					in_degree[*itr]++;
+				itr++;
+			}
+		}
+		itr_rel++;
+	}
+
+	itr_rel=affected_rels.begin();
+	while(itr_rel!=affected_rels.end())
+	{
+		if(in_degree[*itr_rel]==0)
+			ready_rels[rel_pos[*itr_rel]]=(*itr_rel);
+		else
+			pend_rels[rel_pos[*itr_rel]]=(*itr_rel);
+		itr_rel++;
+	}
+
+	/* Sorts the relationships in topological order. Relationships with the same precedence
+		 are kept in the order they appear on the model */
+	while(!ready_rels.empty() || !pend_rels.empty())
+	{
+		//In case of cycles the first pending relationship is used to proceed the sorting
+		if(ready_rels.empty())
+		{
+			ready_rels.insert(*pend_rels.begin());
+			pend_rels.erase(pend_rels.begin());
+		}
+
+		rel=ready_rels.begin()->second;
+		ready_rels.erase(ready_rels.begin());
+		sorted_rels.push_back(rel);
+
+		table=rel->getReceiverTable();
+		if(table && rels_by_ref_tab.count(table))
+		{
+			itr=rels_by_ref_tab[table].begin();
+			itr_end=rels_by_ref_tab[table].end();
+
+			while(itr!=itr_end)
+			{
+				if((*itr)!=rel && pend_rels.count(rel_pos[*itr]) && --in_degree[*itr]==0)
+				{
+					pend_rels.erase(rel_pos[*itr]);
+					ready_rels[rel_pos[*itr]]=(*itr);
+				}
+				itr++;
+			}
+		}
+	}
+
+	return(sorted_rels);
+}
+
 void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 {
 	try
@@ -1614,10 +1909,12 @@ void DatabaseModel::createSpecialObject(const QString &xml_def, unsigned obj_id)
 	ObjectType obj_type;
 	BaseObject *object=nullptr;
 
+	/* Reads the passed xml buffer on a separated parser context so the document being
+		 read by the caller (e.g. the model file during the loading) remains untouched */
+	XMLParser::pushContext();
+
 	try
 	{
-		//Restart the XML parser to read the passed xml buffer
-		XMLParser::restartParser();
 		XMLParser::loadXMLBuffer(xml_def);
 
 		//Identifies the object type through the start element on xml buffer
@@ -1640,9 +1937,12 @@ void DatabaseModel::createSpecialObject(const QString &xml_def, unsigned obj_id)
 		 id (obj_id) if it is specified */
 		if(object && obj_id!=0)
 			object->object_id=obj_id;
+
+		XMLParser::popContext();
 	}
 	catch(Exception &e)
 	{
+		XMLParser::popContext();
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, xml_def);
 	}
 }
@@ -2319,6 +2619,10 @@ void DatabaseModel::addPermission(Permission *perm)
 
 		permissions.push_back(perm);
 		perm->setDatabase(this);
+		invalidateObjectIndex(OBJ_PERMISSION);
+
+		if(!invalid_refs_index)
+			addObjectReferences(perm, false);
 	}
 	catch(Exception &e)
 	{
@@ -2365,6 +2669,10 @@ void DatabaseModel::removePermissions(BaseObject *object)
 		if(perm->getObject()==object)
 		{
 			permissions.erase(itr);
+			invalidateObjectIndex(OBJ_PERMISSION);
+
+			if(!invalid_refs_index)
+				removeObjectReferences(perm, false, true);
 			itr=itr_end=permissions.end();
 
 			if(!permissions.empty())
@@ -2503,6 +2811,13 @@ void DatabaseModel::loadModel(const QString &filename)
 		BaseObject *object=nullptr;
 		bool protected_model=false;
 		map<unsigned, QString>::iterator itr, itr_end;
+		ProgressReporter prog_rep;
+		static Profiler::Entry *load_tm=Profiler::getTimer("model.load"),
+													 *parse_tm=Profiler::getTimer("model.load.xml-parsing"),
+													 *create_tm=Profiler::getTimer("model.load.object-creation"),
+													 *special_tm=Profiler::getTimer("model.load.special-objects"),
+													 *created_cnt=Profiler::getCounter("model.load.objects-created");
+		Profiler::Timer load_timer(load_tm), parse_timer(parse_tm, false);
 
 		//Configuring the path to the base path for objects DTD
 		dtd_file=GlobalAttributes::SCHEMAS_ROOT_DIR +
@@ -2515,6 +2830,7 @@ void DatabaseModel::loadModel(const QString &filename)
 		try
 		{
 			loading_model=true;
+			invalid_refs_index=true;
 			XMLParser::restartParser();
 
 			//Loads the root DTD
@@ -2522,8 +2838,12 @@ void DatabaseModel::loadModel(const QString &filename)
 														GlobalAttributes::OBJECT_DTD_EXT,
 														GlobalAttributes::ROOT_DTD);
 
-			//Loads the file validating it against the root DTD
-			XMLParser::loadXMLFile(filename);
+			/* Opens the file validating it against the root DTD. The top-level elements are read
+				 one at a time so only the object being created is kept on memory. With more than one
+				 loading thread the elements are parsed ahead by batches on the worker threads while
+				 the objects are still created (and linked) here in the order they appear on the file */
+			parse_timer.start();
+			XMLParser::openXMLStream(filename, load_threads);
 
 			//Gets the basic model information
 			XMLParser::getElementAttributes(attribs);
@@ -2531,104 +2851,97 @@ void DatabaseModel::loadModel(const QString &filename)
 			this->author=attribs[ParsersAttributes::MODEL_AUTHOR];
 			protected_model=(attribs[ParsersAttributes::PROTECTED]==ParsersAttributes::_TRUE_);
 
-			if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+			while(XMLParser::readNextStreamElement())
 			{
-				do
-				{
-					if(XMLParser::getElementType()==XML_ELEMENT_NODE)
-					{
-						elem_name=XMLParser::getElementName();
+				parse_timer.stop();
+				elem_name=XMLParser::getElementName();
 
-						/* When the current element is a permission, indicates that the parser created all the
+				/* When the current element is a permission, indicates that the parser created all the
 				 other objects. Thus, if there is no incomplete objects that need to be recreated
 				 the permissions will be loaded */
-						if(elem_name==ParsersAttributes::PERMISSION)
-						{
-							//Recreates the special objects before load the permissions
-							if(!xml_special_objs.empty())
-							{
-								//Makes a backup of the main buffer of the xml parser that contains all the model file definition
-								str_aux=XMLParser::getXMLBuffer();
+				if(elem_name==ParsersAttributes::PERMISSION)
+				{
+					//Recreates the special objects before load the permissions
+					if(!xml_special_objs.empty())
+					{
+						Profiler::Timer special_timer(special_tm);
 
-								itr=xml_special_objs.begin();
-								itr_end=xml_special_objs.end();
+						itr=xml_special_objs.begin();
+						itr_end=xml_special_objs.end();
 
-								while(itr!=itr_end)
-								{
-									createSpecialObject(itr->second, itr->first);
-									itr++;
-								}
+						while(itr!=itr_end)
+						{
+							createSpecialObject(itr->second, itr->first);
+							itr++;
+						}
 
-								xml_special_objs.clear();
+						xml_special_objs.clear();
+					}
 
-								//Reload the main buffer
-								XMLParser::restartParser();
-								XMLParser::loadXMLBuffer(str_aux);
-								XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+					addPermission(createPermission());
+				}
+				else
+				{
+					//Indentifies the object type to be load according to the current element on the parser
+					obj_type=getObjectType(elem_name);
 
-								//Moves the parser to the first permission on the buffer
-								while(XMLParser::getElementName()!=ParsersAttributes::PERMISSION &&
-											XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
-							}
+					if(obj_type==OBJ_DATABASE)
+					{
+						XMLParser::getElementAttributes(attribs);
+						encoding=attribs[ParsersAttributes::ENCODING];
+						template_db=attribs[ParsersAttributes::TEMPLATE_DB];
+						localizations[0]=attribs[ParsersAttributes::_LC_CTYPE_];
+						localizations[1]=attribs[ParsersAttributes::_LC_COLLATE_];
 
-							addPermission(createPermission());
-						}
-						else
-						{
-							//Indentifies the object type to be load according to the current element on the parser
-							obj_type=getObjectType(elem_name);
+						if(!attribs[ParsersAttributes::CONN_LIMIT].isEmpty())
+							conn_limit=attribs[ParsersAttributes::CONN_LIMIT].toInt();
 
-							if(obj_type==OBJ_DATABASE)
-							{
-								XMLParser::getElementAttributes(attribs);
-								encoding=attribs[ParsersAttributes::ENCODING];
-								template_db=attribs[ParsersAttributes::TEMPLATE_DB];
-								localizations[0]=attribs[ParsersAttributes::_LC_CTYPE_];
-								localizations[1]=attribs[ParsersAttributes::_LC_COLLATE_];
+						setBasicAttributes(this);
+					}
+					else
+					{
+						try
+						{
+							Profiler::Timer create_timer(create_tm);
 
-								if(!attribs[ParsersAttributes::CONN_LIMIT].isEmpty())
-									conn_limit=attribs[ParsersAttributes::CONN_LIMIT].toInt();
+							//Saves the current position of the parser before create any object
+							XMLParser::savePosition();
+							object=createObject(obj_type);
 
-								setBasicAttributes(this);
-							}
-							else
+							if(object)
 							{
-								try
-								{
-									//Saves the current position of the parser before create any object
-									XMLParser::savePosition();
-									object=createObject(obj_type);
+								if(!dynamic_cast<TableObject *>(object) && obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
+									addObject(object);
 
-									if(object)
-									{
-										if(!dynamic_cast<TableObject *>(object) && obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
-											addObject(object);
-
-										if(!signalsBlocked())
-										{
-											emit s_objectLoaded(XMLParser::getCurrentBufferLine()/XMLParser::getBufferLineCount(),
-																					trUtf8("Loading object: %1 (%2)")
-																					.arg(Utf8String::create(object->getName()))
-																					.arg(object->getTypeName()),
-																					obj_type);
-										}
-									}
+								created_cnt->increment();
 
-									XMLParser::restorePosition();
-								}
-								catch(Exception &e)
+								//The message is formatted only when the progress report is actually delivered
+								if(!signalsBlocked() && prog_rep.isReportDue(XMLParser::getStreamProgress()))
 								{
-									QString info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename()).arg(XMLParser::getCurrentElement()->line);
-									throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
+									emit s_objectLoaded(XMLParser::getStreamProgress(),
+																			trUtf8("Loading object: %1 (%2)")
+																			.arg(Utf8String::create(object->getName()))
+																			.arg(object->getTypeName()),
+																			obj_type);
 								}
 							}
-						}
 
+							XMLParser::restorePosition();
+						}
+						catch(Exception &e)
+						{
+							QString info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename()).arg(XMLParser::getCurrentElement()->line);
+							throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
+						}
 					}
 				}
-				while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+
+				parse_timer.start();
 			}
 
+			XMLParser::closeXMLStream();
+			parse_timer.stop();
+
 			this->BaseObject::setProtected(protected_model);
 			loading_model=false;
 			this->validateRelationships();
@@ -2642,6 +2955,8 @@ void DatabaseModel::loadModel(const QString &filename)
 			if(XMLParser::getCurrentElement())
 				extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename()).arg(XMLParser::getCurrentElement()->line);
 
+			XMLParser::closeXMLStream();
+
 			if(e.getErrorType()>=ERR_INVALID_SYNTAX)
 			{
 				str_aux=QString(Exception::getErrorMessage(ERR_LOAD_INV_MODEL_FILE)).arg(filename);
@@ -5725,7 +6040,23 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 
 			if(revalidate_rels || ref_tab_inheritance)
 			{
-				disconnectRelationships();
+				itr=relationships.begin();
+				itr_end=relationships.end();
+
+				/* Invalidates only the relationships that propagate columns from the parent table,
+					 the ones that depends on them are revalidated as well by validateRelationships() */
+				while(itr!=itr_end)
+				{
+					rel=dynamic_cast<Relationship *>(*itr);
+					itr++;
+
+					if(rel->getReferenceTable()==parent_tab ||
+						 (rel->getRelationshipType()==Relationship::RELATIONSHIP_NN &&
+							(rel->getTable(BaseRelationship::SRC_TABLE)==parent_tab ||
+							 rel->getTable(BaseRelationship::DST_TABLE)==parent_tab)))
+						rel->forceInvalidate();
+				}
+
 				validateRelationships();
 			}
 		}
@@ -5739,27 +6070,27 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 QString DatabaseModel::__getCodeDefinition(unsigned def_type)
 {
 	if(conn_limit >= 0)
-		attributes[ParsersAttributes::CONN_LIMIT]=QString("%1").arg(conn_limit);
+		attributes[ParsersAttributes::ID_CONN_LIMIT]=QString("%1").arg(conn_limit);
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
 	{
 		if(encoding!=BaseType::null)
-			attributes[ParsersAttributes::ENCODING]="'" + (~encoding) + "'";
+			attributes[ParsersAttributes::ID_ENCODING]="'" + (~encoding) + "'";
 
 		if(!localizations[1].isEmpty())
-			attributes[ParsersAttributes::_LC_COLLATE_]="'" + localizations[1] + "'";
+			attributes[ParsersAttributes::ID__LC_COLLATE_]="'" + localizations[1] + "'";
 
 		if(!localizations[0].isEmpty())
-			attributes[ParsersAttributes::_LC_CTYPE_]="'" + localizations[0]  + "'";
+			attributes[ParsersAttributes::ID__LC_CTYPE_]="'" + localizations[0]  + "'";
 	}
 	else
 	{
-		attributes[ParsersAttributes::ENCODING]=(~encoding);
-		attributes[ParsersAttributes::_LC_COLLATE_]=localizations[1];
-		attributes[ParsersAttributes::_LC_CTYPE_]=localizations[0];
+		attributes[ParsersAttributes::ID_ENCODING]=(~encoding);
+		attributes[ParsersAttributes::ID__LC_COLLATE_]=localizations[1];
+		attributes[ParsersAttributes::ID__LC_CTYPE_]=localizations[0];
 	}
 
-	attributes[ParsersAttributes::TEMPLATE_DB]=template_db;
+	attributes[ParsersAttributes::ID_TEMPLATE_DB]=template_db;
 	return(this->BaseObject::__getCodeDefinition(def_type));
 }
 
@@ -5768,34 +6099,29 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type)
 	return(this->getCodeDefinition(def_type, true));
 }
 
-QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
+void DatabaseModel::writeCodeDefinition(QIODevice &output, unsigned def_type, bool export_file)
 {
 	map<QString, QString> attribs_aux;
-	unsigned count1, i, count;
+	unsigned count1, i, i1, count, chunk_size;
+	int obj_pos, perm_pos;
 	float general_obj_cnt, gen_defs_count;
-	bool sql_disabled=false;
+	bool sql_disabled=false, in_comment=false;
 	BaseObject *object=nullptr;
 	vector<BaseObject *> *obj_list=nullptr;
 	vector<BaseObject *>::iterator itr, itr_end;
-	vector<unsigned>::iterator itr1, itr1_end;
+	ProgressReporter prog_rep;
 	QString msg=trUtf8("Generating %1 of the object: %2 (%3)"),
 			attrib=ParsersAttributes::OBJECTS,
 			def_type_str=(def_type==SchemaParser::SQL_DEFINITION ? "SQL" : "XML");
 	Type *usr_type=nullptr;
-	map<unsigned, BaseObject *> objects_map;
-	vector<unsigned> ids_objs, ids_tab_objs;
-	Table *table=nullptr;
-	Index *index=nullptr;
-	Trigger *trigger=nullptr;
-	Constraint *constr=nullptr;
-	Relationship *rel=nullptr;
+	vector<BaseObject *> ordered_objs, gen_objs, chunk;
+	vector<QString> definitions;
+	vector<bool> generated;
+	QString model_def, objs_def, pending_code,
+			obj_marker=QString("\x01%1\x01").arg(ParsersAttributes::OBJECTS),
+			perm_marker=QString("\x01%1\x01").arg(ParsersAttributes::PERMISSION);
 	ObjectType obj_type,
-			aux_obj_types[]={ OBJ_ROLE, OBJ_TABLESPACE, OBJ_SCHEMA },
-			obj_types[]={ OBJ_COLLATION, OBJ_LANGUAGE, OBJ_FUNCTION, OBJ_TYPE,
-										OBJ_CAST, OBJ_CONVERSION, OBJ_EXTENSION,
-										OBJ_OPERATOR, OBJ_OPFAMILY, OBJ_OPCLASS,
-										OBJ_AGGREGATE, OBJ_DOMAIN, OBJ_TEXTBOX, BASE_RELATIONSHIP,
-										OBJ_RELATIONSHIP, OBJ_TABLE, OBJ_VIEW, OBJ_SEQUENCE };
+			aux_obj_types[]={ OBJ_ROLE, OBJ_TABLESPACE, OBJ_SCHEMA };
 	try
 	{
 		general_obj_cnt=this->getObjectCount();
@@ -5849,7 +6175,7 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 
 					//Increments the generated definition count and emits the signal
 					gen_defs_count++;
-					if(!signalsBlocked())
+					if(!signalsBlocked() && prog_rep.isReportDue((gen_defs_count/general_obj_cnt) * 100))
 					{
 						emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
 																msg.arg(def_type_str)
@@ -5862,276 +6188,189 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			}
 		}
 
-		//Includes the database model on the objects map permitting to create the code in a correct order
-		objects_map[this->getObjectId()]=this;
-		ids_objs.push_back(this->getObjectId());
+		//Getting the objects in the order their code must be generated
+		getCodeGenerationOrder(def_type, ordered_objs);
 
-		//Generating the definition for the other objects type
-		if(def_type==SchemaParser::XML_DEFINITION)
-			count=18;
-		else
-			count=14;
+		attribs_aux[ParsersAttributes::SHELL_TYPES]="";
 
-		for(i=0; i < count; i++)
+		if(def_type==SchemaParser::SQL_DEFINITION)
 		{
-			//For SQL definition, only the textbox and base relationship does not has the code generated
-			if(def_type==SchemaParser::SQL_DEFINITION &&
-				 (obj_types[i]==OBJ_TEXTBOX || obj_types[i]==BASE_RELATIONSHIP))
-				obj_list=nullptr;
-			else
-				obj_list=getObjectList(obj_types[i]);
+			itr=types.begin();
+			itr_end=types.end();
 
-			if(obj_list)
+			while(itr!=itr_end)
 			{
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+				usr_type=dynamic_cast<Type *>(*itr);
+				itr++;
 
-				while(itr!=itr_end)
-				{
-					object=(*itr);
-					objects_map[object->getObjectId()]=object;
-					ids_objs.push_back(object->getObjectId());
-					itr++;
-				}
+				if(usr_type->getConfiguration()==Type::BASE_TYPE)
+					usr_type->convertFunctionParameters();
 			}
 		}
 
-		/* Getting and storing the special objects (which reference columns of tables added for relationships)
-			on the map of objects and their ids in an array of auxiliary ids 'ids_tab_objs'.
-			For this list of tables is scanned again and its constraints and indexes are validated as special or not.
-			The vector of ids is concatenated to the main vector of ids before his ordination when the definition is XML
-			or concatenated after ordination to SQL definition, so the special objects are created correctly in both languages */
-		itr=tables.begin();
-		itr_end=tables.end();
+		itr=ordered_objs.begin();
+		itr_end=ordered_objs.end();
 
 		while(itr!=itr_end)
 		{
-			table=dynamic_cast<Table *>(*itr);
+			object=(*itr);
+			obj_type=object->getObjectType();
 			itr++;
 
-			count=table->getConstraintCount();
-			for(i=0; i < count; i++)
+			/* For SQL definition the database and the shell types are placed on their own sections
+				 of the code so they are generated here. All the other objects are written on the output
+				 as soon as their code is generated */
+			if(def_type==SchemaParser::SQL_DEFINITION &&
+				 (obj_type==OBJ_DATABASE ||
+					(obj_type==OBJ_TYPE && dynamic_cast<Type *>(object)->getConfiguration()==Type::BASE_TYPE)))
 			{
-				constr=table->getConstraint(i);
-
-				/* Case the constraint is a special object stores it on the objects map. Independently to the
-				configuration, foreign keys are discarded in this iteration because on the end of the method
-				they have the definition generated */
-				if((!constr->isAddedByLinking() &&
-						((constr->getConstraintType()!=ConstraintType::primary_key && constr->isReferRelationshipAddedColumn()))))
+				if(obj_type==OBJ_DATABASE)
 				{
-					objects_map[constr->getObjectId()]=constr;
-					ids_tab_objs.push_back(constr->getObjectId());
-				}
-			}
+					/* The Database has the SQL code definition disabled when generating the
+					code of the entire model because this object cannot be created from a multiline sql command */
 
-			count=table->getTriggerCount();
-			for(i=0; i < count; i++)
-			{
-				trigger=table->getTrigger(i);
+					//Saving the sql disabled state
+					sql_disabled=this->isSQLDisabled();
 
-				if(trigger->isReferRelationshipAddedColumn())
-				{
-					objects_map[trigger->getObjectId()]=trigger;
-					ids_tab_objs.push_back(trigger->getObjectId());
-				}
-			}
+					//Disables the sql to generate a commented code
+					this->setSQLDisabled(true);
+					attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
 
-			count=table->getIndexCount();
-			for(i=0; i < count; i++)
-			{
-				index=table->getIndex(i);
+					//Restore the original sql disabled state
+					this->setSQLDisabled(sql_disabled);
+				}
+				else
+					//Generating the shell type declaration (only for base types)
+					attribs_aux[ParsersAttributes::SHELL_TYPES]+=getObjectCodeDefinition(object, def_type);
 
-				if(index->isReferRelationshipAddedColumn())
+				gen_defs_count++;
+				if(!signalsBlocked() && prog_rep.isReportDue((gen_defs_count/general_obj_cnt) * 100))
 				{
-					objects_map[index->getObjectId()]=index;
-					ids_tab_objs.push_back(index->getObjectId());
+					emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
+															msg.arg(def_type_str)
+															.arg(Utf8String::create(object->getName()))
+															.arg(object->getTypeName()),
+															object->getObjectType());
 				}
 			}
+			else
+				gen_objs.push_back(object);
 		}
 
+		attribs_aux[ParsersAttributes::MODEL_AUTHOR]=author;
+		attribs_aux[ParsersAttributes::EXPORT_TO_FILE]=(export_file ? "1" : "");
+
 		if(def_type==SchemaParser::XML_DEFINITION)
-			ids_objs.insert(ids_objs.end(), ids_tab_objs.begin(), ids_tab_objs.end());
+			attribs_aux[ParsersAttributes::PROTECTED]=(this->is_protected ? "1" : "");
 
-		/* SPECIAL CASE: Generating the SQL for tables, views, relationships and sequences
+		/* The objects and permissions sections are replaced by markers in the model's code. The code is
+			 then written in pieces: the text before the objects marker, the objects (one by one), the text
+			 between the markers, the permissions (one by one) and the remaining text */
+		//For XML definition roles, tablespaces and schemas were generated on the objects section
+		objs_def=attribs_aux[ParsersAttributes::OBJECTS];
+		attribs_aux[ParsersAttributes::OBJECTS]=obj_marker;
+		attribs_aux[ParsersAttributes::PERMISSION]=perm_marker;
 
-		 This generations is made in the following way:
-		 1) Based on the relationship list, generates the SQL for the participant tables and after this the
-				SQL for the relationship itself.
-		 2) Generates the SQL for the other tables (that does not participates in relationships)
-		 3) The sequences must have its code generated after the tables
-		 4) View are the last objects that has the code generated avoiding table/column reference breaking */
 		if(def_type==SchemaParser::SQL_DEFINITION)
+			model_def=SchemaParser::getCodeDefinition(ParsersAttributes::DB_MODEL, attribs_aux, def_type);
+		else
 		{
-			BaseObject *objs[3]={nullptr, nullptr, nullptr};
-			vector<BaseObject *> vet_aux;
-
-			vet_aux=relationships;
-			vet_aux.insert(vet_aux.end(), tables.begin(),tables.end());
-			vet_aux.insert(vet_aux.end(), sequences.begin(),sequences.end());
-			vet_aux.insert(vet_aux.end(), views.begin(),views.end());;
-			itr=vet_aux.begin();
-			itr_end=vet_aux.end();
-
-			while(itr!=itr_end)
-			{
-				object=(*itr);
-				itr++;
-
-				if(object->getObjectType()==OBJ_RELATIONSHIP)
-				{
-					rel=dynamic_cast<Relationship *>(object);
-					objs[0]=rel->getTable(Relationship::SRC_TABLE);
-					objs[1]=rel->getTable(Relationship::DST_TABLE);
-					objs[2]=rel;
-
-					for(i=0; i < 3; i++)
-					{
-						if(objects_map.count(objs[i]->getObjectId())==0)
-						{
-							objects_map[objs[i]->getObjectId()]=objs[i];
-							ids_objs.push_back(objs[i]->getObjectId());
-						}
-					}
-				}
-				else
-				{
-					if(objects_map.count(object->getObjectId())==0)
-					{
-						objects_map[object->getObjectId()]=object;
-						ids_objs.push_back(object->getObjectId());
-					}
-				}
-			}
+			/* The XML code is generated directly from the schema file because the chars conversion
+				 to XML entities is made on each piece written to the output (see writeCode()) */
+			model_def=SchemaParser::getCodeDefinition(GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
+																								GlobalAttributes::XML_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR +
+																								ParsersAttributes::DB_MODEL + GlobalAttributes::SCHEMA_EXT, attribs_aux);
 		}
 
-		//Sort the objects id vector to created the definition in a correct way
-		sort(ids_objs.begin(), ids_objs.end());
+		obj_pos=model_def.indexOf(obj_marker);
+		perm_pos=model_def.indexOf(perm_marker);
+		writeCode(output, model_def.mid(0, obj_pos), def_type, pending_code, in_comment);
+		writeCode(output, objs_def, def_type, pending_code, in_comment);
+		objs_def.clear();
 
-		if(def_type==SchemaParser::SQL_DEFINITION)
-			ids_objs.insert(ids_objs.end(), ids_tab_objs.begin(), ids_tab_objs.end());
-
-		attribs_aux[ParsersAttributes::SHELL_TYPES]="";
+		/* Generating the objects in blocks. When using several threads each block is generated in parallel
+			 and then written in the original order, so the memory used is limited to the size of a block */
+		chunk_size=(code_gen_threads > 1 ? code_gen_threads : 1) * 64;
+		count=gen_objs.size();
 
-		if(def_type==SchemaParser::SQL_DEFINITION)
+		for(i=0; i < count; i+=chunk_size)
 		{
-			itr=types.begin();
-			itr_end=types.end();
-
-			while(itr!=itr_end)
-			{
-				usr_type=dynamic_cast<Type *>(*itr);
-				itr++;
-
-				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-					usr_type->convertFunctionParameters();
-			}
-		}
+			chunk.assign(gen_objs.begin() + i, gen_objs.begin() + min(i + chunk_size, count));
+			definitions.assign(chunk.size(), "");
+			generated.assign(chunk.size(), false);
 
-		itr1=ids_objs.begin();
-		itr1_end=ids_objs.end();
+			if(code_gen_threads > 1)
+				generateCodeInParallel(chunk, definitions, generated, def_type);
 
-		attrib=ParsersAttributes::OBJECTS;
-		while(itr1!=itr1_end)
-		{
-			object=objects_map[(*itr1)];
-			obj_type=object->getObjectType();
-			itr1++;
-
-			if(obj_type==OBJ_TYPE && def_type==SchemaParser::SQL_DEFINITION)
+			for(i1=0; i1 < chunk.size(); i1++)
 			{
-				usr_type=dynamic_cast<Type *>(object);
+				object=chunk[i1];
 
-				//Generating the shell type declaration (only for base types)
-				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-					attribs_aux[ParsersAttributes::SHELL_TYPES]+=usr_type->getCodeDefinition(def_type, true);
-				else
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
-			}
-			else if(obj_type==OBJ_DATABASE)
-			{
-				if(def_type==SchemaParser::SQL_DEFINITION)
+				if(!generated[i1])
 				{
-					/* The Database has the SQL code definition disabled when generating the
-					code of the entire model because this object cannot be created from a multiline sql command */
+					if(object->getObjectType()==OBJ_DATABASE)
+						definitions[i1]=this->__getCodeDefinition(def_type);
+					else
+						definitions[i1]=getObjectCodeDefinition(object, def_type);
+				}
 
-					//Saving the sql disabled state
-					sql_disabled=this->isSQLDisabled();
+				writeCode(output, definitions[i1], def_type, pending_code, in_comment);
 
-					//Disables the sql to generate a commented code
-					this->setSQLDisabled(true);
-					attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
+				//Releases the generated code as soon as it's written
+				definitions[i1].clear();
 
-					//Restore the original sql disabled state
-					this->setSQLDisabled(sql_disabled);
+				gen_defs_count++;
+				if(!signalsBlocked() && prog_rep.isReportDue((gen_defs_count/general_obj_cnt) * 100))
+				{
+					emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
+															msg.arg(def_type_str)
+															.arg(Utf8String::create(object->getName()))
+															.arg(object->getTypeName()),
+															object->getObjectType());
 				}
-				else
-					attribs_aux[attrib]+=this->__getCodeDefinition(def_type);
-			}
-			else if(obj_type==OBJ_CONSTRAINT)
-			{
-				attribs_aux[attrib]+=dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true);
-			}
-			else
-			{
-				if(object->isSystemObject())
-					attribs_aux[attrib]+="";
-				else
-					attribs_aux[attrib]+=object->getCodeDefinition(def_type);
 			}
+		}
 
-			gen_defs_count++;
-			if(!signalsBlocked())
+		//The complete definition of base types are placed after all the other objects
+		if(def_type==SchemaParser::SQL_DEFINITION)
+		{
+			count1=types.size();
+			for(i=0; i < count1; i++)
 			{
-				emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
-														msg.arg(def_type_str)
-														.arg(Utf8String::create(object->getName()))
-														.arg(object->getTypeName()),
-														object->getObjectType());
+				usr_type=dynamic_cast<Type *>(types[i]);
+				if(usr_type->getConfiguration()==Type::BASE_TYPE)
+				{
+					writeCode(output, usr_type->getCodeDefinition(def_type), def_type, pending_code, in_comment);
+					usr_type->convertFunctionParameters(true);
+				}
 			}
 		}
 
+		writeCode(output, model_def.mid(obj_pos + obj_marker.size(), perm_pos - obj_pos - obj_marker.size()),
+							def_type, pending_code, in_comment);
+
 		//Gernerating the SQL/XML code for permissions
 		itr=permissions.begin();
 		itr_end=permissions.end();
-		attribs_aux[ParsersAttributes::PERMISSION]="";
 
 		while(itr!=itr_end)
 		{
-			attribs_aux[ParsersAttributes::PERMISSION]+=dynamic_cast<Permission *>(*itr)->getCodeDefinition(def_type);
+			writeCode(output, dynamic_cast<Permission *>(*itr)->getCodeDefinition(def_type), def_type, pending_code, in_comment);
 
 			gen_defs_count++;
-			if(!signalsBlocked())
+			if(!signalsBlocked() && prog_rep.isReportDue((gen_defs_count/general_obj_cnt) * 100))
 			{
 				emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
 														msg.arg(def_type_str)
 														.arg(Utf8String::create((*itr)->getName()))
-														.arg(object->getTypeName()),
-														object->getObjectType());
+														.arg((*itr)->getTypeName()),
+														(*itr)->getObjectType());
 			}
 
 			itr++;
 		}
 
-		attribs_aux[ParsersAttributes::MODEL_AUTHOR]=author;
-
-		if(def_type==SchemaParser::XML_DEFINITION)
-		{
-			attribs_aux[ParsersAttributes::PROTECTED]=(this->is_protected ? "1" : "");
-		}
-		else
-		{
-			count1=types.size();
-			for(i=0; i < count1; i++)
-			{
-				usr_type=dynamic_cast<Type *>(types[i]);
-				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-				{
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
-					usr_type->convertFunctionParameters(true);
-				}
-			}
-		}
+		writeCode(output, model_def.mid(perm_pos + perm_marker.size()), def_type, pending_code, in_comment, true);
 	}
 	catch(Exception &e)
 	{
@@ -6147,510 +6386,1198 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 		}
 		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
-
-	attribs_aux[ParsersAttributes::EXPORT_TO_FILE]=(export_file ? "1" : "");
-
-	return(SchemaParser::getCodeDefinition(ParsersAttributes::DB_MODEL, attribs_aux, def_type));
 }
 
-void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
+void DatabaseModel::generateSQLStatements(SQLStatementHandler &handler)
 {
-	QFile output(filename);
-	QByteArray buf;
-
-	output.open(QFile::WriteOnly);
-
-	if(!output.isOpen())
-		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTEN).arg(filename),
-										ERR_FILE_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	map<QString, QString> attribs_aux;
+	unsigned i, i1, count, chunk_size;
+	int obj_pos, perm_pos;
+	float general_obj_cnt, gen_defs_count=0;
+	BaseObject *object=nullptr;
+	vector<BaseObject *>::iterator itr, itr_end;
+	vector<BaseObject *> ordered_objs, gen_objs, chunk;
+	vector<QString> definitions;
+	vector<bool> generated;
+	QHash<BaseObject *, unsigned> levels;
+	ProgressReporter prog_rep;
+	Type *usr_type=nullptr;
+	QString model_def, msg=trUtf8("Generating %1 of the object: %2 (%3)"),
+			obj_marker=QString("\x01%1\x01").arg(ParsersAttributes::OBJECTS),
+			perm_marker=QString("\x01%1\x01").arg(ParsersAttributes::PERMISSION);
 
 	try
 	{
-		buf.append(this->getCodeDefinition(def_type));
-		output.write(buf.data(),buf.size());
-		output.close();
-	}
-	catch(Exception &e)
-	{
-		if(output.isOpen()) output.close();
-		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTER_INV_DEF).arg(filename),
-										ERR_FILE_NOT_WRITTER_INV_DEF,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-	}
-}
-
-void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps)
-{
-	//Case the object is allocated and is not included in the dependecies list
-	if(object && std::find(deps.begin(), deps.end(), object)==deps.end())
-	{
-		deps.push_back(object);
+		general_obj_cnt=this->getObjectCount();
+		getCodeGenerationOrder(SchemaParser::SQL_DEFINITION, ordered_objs);
 
-		if((deps.size()==1 && !inc_indirect_deps) || inc_indirect_deps)
+		itr=types.begin();
+		itr_end=types.end();
+		while(itr!=itr_end)
 		{
-			ObjectType obj_type=object->getObjectType();
-
-			/* if the object has a schema, tablespace and owner applies the
-		 dependecy search in these objects */
-			if(object->getSchema())
-				getObjectDependecies(object->getSchema(), deps, inc_indirect_deps);
-
-			if(object->getTablespace())
-				getObjectDependecies(object->getTablespace(), deps, inc_indirect_deps);
+			usr_type=dynamic_cast<Type *>(*itr);
+			itr++;
 
-			if(object->getOwner())
-				getObjectDependecies(object->getOwner(), deps, inc_indirect_deps);
+			if(usr_type->getConfiguration()==Type::BASE_TYPE)
+				usr_type->convertFunctionParameters();
+		}
 
-			if(object->getCollation())
-				getObjectDependecies(object->getCollation(), deps, inc_indirect_deps);
+		/* The model's code is generated without the objects. The schemas and the shell types are
+			 sent right after the code that precedes the objects section as in the complete code */
+		attribs_aux[ParsersAttributes::ROLE]="";
+		attribs_aux[ParsersAttributes::TABLESPACE]="";
+		attribs_aux[ParsersAttributes::SCHEMA]="";
+		attribs_aux[ParsersAttributes::SHELL_TYPES]="";
+		attribs_aux[this->getSchemaName()]="";
+		attribs_aux[ParsersAttributes::MODEL_AUTHOR]=author;
+		attribs_aux[ParsersAttributes::EXPORT_TO_FILE]="";
+		attribs_aux[ParsersAttributes::OBJECTS]=obj_marker;
+		attribs_aux[ParsersAttributes::PERMISSION]=perm_marker;
+
+		model_def=SchemaParser::getCodeDefinition(ParsersAttributes::DB_MODEL, attribs_aux, SchemaParser::SQL_DEFINITION);
+		obj_pos=model_def.indexOf(obj_marker);
+		perm_pos=model_def.indexOf(perm_marker);
+		sendSQLStatements(this, model_def.mid(0, obj_pos), levels, handler);
+
+		//The "public" schema does not have the SQL code definition generated
+		itr=schemas.begin();
+		itr_end=schemas.end();
+		while(itr!=itr_end)
+		{
+			object=(*itr);
+			itr++;
 
-			//** Getting the dependecies for operator class **
-			if(obj_type==OBJ_OPCLASS)
+			if(object->getName()!="public")
 			{
-				OperatorClass *op_class=dynamic_cast<OperatorClass *>(object);
-				BaseObject *usr_type=getObjectPgSQLType(op_class->getDataType());
-
-				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
-
-				if(op_class->getFamily())
-					getObjectDependecies(op_class->getFamily(), deps, inc_indirect_deps);
+				sendSQLStatements(object, object->getCodeDefinition(SchemaParser::SQL_DEFINITION), levels, handler);
+				gen_defs_count++;
 			}
-			//** Getting the dependecies for domain **
-			else if(obj_type==OBJ_DOMAIN)
-			{
-				BaseObject *usr_type=getObjectPgSQLType(dynamic_cast<Domain *>(object)->getType());
+		}
 
-				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
-			}
-			//** Getting the dependecies for conversion **
-			else if(obj_type==OBJ_CONVERSION)
+		//Sending the shell types declarations and separating the objects that are generated in blocks
+		itr=ordered_objs.begin();
+		itr_end=ordered_objs.end();
+		while(itr!=itr_end)
+		{
+			object=(*itr);
+			itr++;
+
+			if(object->getObjectType()==OBJ_TYPE && dynamic_cast<Type *>(object)->getConfiguration()==Type::BASE_TYPE)
 			{
-				Function *func=dynamic_cast<Conversion *>(object)->getConversionFunction();
-				getObjectDependecies(func, deps, inc_indirect_deps);
+				sendSQLStatements(object, getObjectCodeDefinition(object, SchemaParser::SQL_DEFINITION), levels, handler);
+				gen_defs_count++;
 			}
-			//** Getting the dependecies for cast **
-			else if(obj_type==OBJ_CAST)
-			{
-				Cast *cast=dynamic_cast<Cast *>(object);
-				BaseObject *usr_type=nullptr;
-
-				for(unsigned i=Cast::SRC_TYPE; i <= Cast::DST_TYPE; i++)
-				{
-					usr_type=getObjectPgSQLType(cast->getDataType(i));
+			//The database is created separately so its code isn't sent
+			else if(object!=this)
+				gen_objs.push_back(object);
+		}
 
-					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
-				}
+		chunk_size=(code_gen_threads > 1 ? code_gen_threads : 1) * 64;
+		count=gen_objs.size();
 
-				getObjectDependecies(cast->getCastFunction(), deps, inc_indirect_deps);
-			}
-			//** Getting the dependecies for function **
-			else if(obj_type==OBJ_FUNCTION)
-			{
-				Function *func=dynamic_cast<Function *>(object);
-				BaseObject *usr_type=getObjectPgSQLType(func->getReturnType());
-				unsigned count, i;
+		for(i=0; i < count; i+=chunk_size)
+		{
+			chunk.assign(gen_objs.begin() + i, gen_objs.begin() + min(i + chunk_size, count));
+			definitions.assign(chunk.size(), "");
+			generated.assign(chunk.size(), false);
 
-				if(!func->isSystemObject())
-					getObjectDependecies(func->getLanguage(), deps, inc_indirect_deps);
+			if(code_gen_threads > 1)
+				generateCodeInParallel(chunk, definitions, generated, SchemaParser::SQL_DEFINITION);
 
-				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
+			for(i1=0; i1 < chunk.size(); i1++)
+			{
+				object=chunk[i1];
 
-				count=func->getParameterCount();
-				for(i=0; i < count; i++)
-				{
-					usr_type=getObjectPgSQLType(func->getParameter(i).getType());
+				if(!generated[i1])
+					definitions[i1]=getObjectCodeDefinition(object, SchemaParser::SQL_DEFINITION);
 
-					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
-				}
+				sendSQLStatements(object, definitions[i1], levels, handler);
+				definitions[i1].clear();
 
-				count=func->getReturnedTableColumnCount();
-				for(i=0; i < count; i++)
+				gen_defs_count++;
+				if(!signalsBlocked() && prog_rep.isReportDue((gen_defs_count/general_obj_cnt) * 100))
 				{
-					usr_type=getObjectPgSQLType(func->getReturnedTableColumn(i).getType());
-
-					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+					emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
+															msg.arg("SQL")
+															.arg(Utf8String::create(object->getName()))
+															.arg(object->getTypeName()),
+															object->getObjectType());
 				}
 			}
-			//** Getting the dependecies for aggregate **
-			else if(obj_type==OBJ_AGGREGATE)
+		}
+
+		//The complete definition of base types are sent after all the other objects
+		count=types.size();
+		for(i=0; i < count; i++)
+		{
+			usr_type=dynamic_cast<Type *>(types[i]);
+			if(usr_type->getConfiguration()==Type::BASE_TYPE)
 			{
-				Aggregate *aggreg=dynamic_cast<Aggregate *>(object);
-				BaseObject *usr_type=nullptr;
-				unsigned count, i;
+				sendSQLStatements(usr_type, usr_type->getCodeDefinition(SchemaParser::SQL_DEFINITION), levels, handler);
+				usr_type->convertFunctionParameters(true);
+			}
+		}
 
-				for(i=Aggregate::FINAL_FUNC; i <= Aggregate::TRANSITION_FUNC; i++)
-					getObjectDependecies(aggreg->getFunction(i), deps, inc_indirect_deps);
+		sendSQLStatements(this, model_def.mid(obj_pos + obj_marker.size(), perm_pos - obj_pos - obj_marker.size()), levels, handler);
 
-				usr_type=getObjectPgSQLType(aggreg->getStateType());
+		itr=permissions.begin();
+		itr_end=permissions.end();
+		while(itr!=itr_end)
+		{
+			sendSQLStatements(*itr, dynamic_cast<Permission *>(*itr)->getCodeDefinition(SchemaParser::SQL_DEFINITION), levels, handler);
+			itr++;
+		}
 
-				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
+		sendSQLStatements(this, model_def.mid(perm_pos + perm_marker.size()), levels, handler);
+	}
+	catch(Exception &e)
+	{
+		count=types.size();
+		for(i=0; i < count; i++)
+		{
+			usr_type=dynamic_cast<Type *>(types[i]);
+			if(usr_type->getConfiguration()==Type::BASE_TYPE)
+				usr_type->convertFunctionParameters(true);
+		}
 
-				if(aggreg->getSortOperator())
-					getObjectDependecies(aggreg->getSortOperator(), deps, inc_indirect_deps);
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo());
+	}
+}
 
-				count=aggreg->getDataTypeCount();
-				for(i=0; i < count; i++)
-				{
-					usr_type=getObjectPgSQLType(aggreg->getDataType(i));
+void DatabaseModel::sendSQLStatements(BaseObject *object, const QString &code, QHash<BaseObject *, unsigned> &levels,
+																			SQLStatementHandler &handler)
+{
+	vector<QString> cmds;
+	vector<BaseObject *> deps;
+	vector<BaseObject *>::iterator itr, itr_end;
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+	Constraint *constr=dynamic_cast<Constraint *>(object);
+	unsigned level=0, i;
 
-					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
-				}
-			}
-			//** Getting the dependecies for language **
-			else if(obj_type==OBJ_LANGUAGE)
-			{
-				Language *lang=dynamic_cast<Language *>(object);
+	SQLStatement::splitCode(code, cmds);
+	if(cmds.empty()) return;
 
-				for(unsigned i=Language::VALIDATOR_FUNC; i <= Language::INLINE_FUNC; i++)
-				{
-					if(lang->getFunction(i))
-						getObjectDependecies(lang->getFunction(i), deps, inc_indirect_deps);
-				}
-			}
-			//** Getting the dependecies for operator **
-			else if(obj_type==OBJ_OPERATOR)
-			{
-				Operator *oper=dynamic_cast<Operator *>(object);
-				BaseObject *usr_type=nullptr;
-				unsigned i;
+	if(object!=this)
+	{
+		getDirectDependencies(object, deps, true);
 
-				for(i=Operator::FUNC_OPERATOR; i <= Operator::FUNC_RESTRICT; i++)
-				{
-					if(oper->getFunction(i))
-						getObjectDependecies(oper->getFunction(i), deps, inc_indirect_deps);
-				}
+		//Table objects also depend on their parent tables and foreign keys on the referenced tables
+		if(tab_obj)
+			deps.push_back(tab_obj->getParentTable());
 
-				for(i=Operator::LEFT_ARG; i <= Operator::RIGHT_ARG; i++)
-				{
-					usr_type=getObjectPgSQLType(oper->getArgumentType(i));
+		if(constr)
+			deps.push_back(constr->getReferencedTable());
 
-					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
-				}
+		if(object->getObjectType()==OBJ_PERMISSION)
+		{
+			BaseObject *perm_obj=dynamic_cast<Permission *>(object)->getObject();
+			tab_obj=dynamic_cast<TableObject *>(perm_obj);
+			deps.push_back(tab_obj ? tab_obj->getParentTable() : perm_obj);
+		}
 
-				for(i=Operator::OPER_COMMUTATOR; i <= Operator::OPER_NEGATOR; i++)
-				{
-					if(oper->getOperator(i))
-						getObjectDependecies(oper->getOperator(i), deps, inc_indirect_deps);
-				}
-			}
-			//** Getting the dependecies for role **
-			else if(obj_type==OBJ_ROLE)
-			{
-				Role *role=dynamic_cast<Role *>(object);
-				unsigned i, i1, count,
-						role_types[3]={ Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE };
+		/* Only the objects already sent are considered so cyclic dependencies (e.g. base types and
+			 their functions) are resolved by the generation order */
+		itr=deps.begin();
+		itr_end=deps.end();
+		while(itr!=itr_end)
+		{
+			if(*itr && (*itr)!=object && levels.contains(*itr))
+				level=max(level, levels.value(*itr) + 1);
 
-				for(i=0; i < 3; i++)
-				{
-					count=role->getRoleCount(role_types[i]);
-					for(i1=0; i1 < count; i1++)
-						getObjectDependecies(role->getRole(role_types[i], i1), deps, inc_indirect_deps);
-				}
-			}
-			//** Getting the dependecies for relationships **
-			else if(obj_type==OBJ_RELATIONSHIP)
-			{
-				Relationship *rel=dynamic_cast<Relationship *>(object);
-				BaseObject *usr_type=nullptr;
-				Constraint *constr=nullptr;
-				unsigned i, count;
+			itr++;
+		}
+	}
 
-				getObjectDependecies(rel->getTable(Relationship::SRC_TABLE), deps, inc_indirect_deps);
-				getObjectDependecies(rel->getTable(Relationship::DST_TABLE), deps, inc_indirect_deps);
+	//The code of an object sent more than once (e.g. base types) must be executed after the previous one
+	if(levels.contains(object))
+		level=max(level, levels.value(object) + 1);
 
-				count=rel->getAttributeCount();
-				for(i=0; i < count; i++)
-				{
-					usr_type=getObjectPgSQLType(rel->getAttribute(i)->getType());
+	levels[object]=level;
 
-					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
-				}
+	for(i=0; i < cmds.size(); i++)
+		handler.handleStatement(SQLStatement(object->getObjectId(), object->getObjectType(), level, i, cmds[i]));
+}
 
-				count=rel->getConstraintCount();
-				for(i=0; i < count; i++)
-				{
-					constr=dynamic_cast<Constraint *>(rel->getConstraint(i));
+void DatabaseModel::getCodeGenerationOrder(unsigned def_type, vector<BaseObject *> &objects)
+{
+	unsigned i, count;
+	map<unsigned, BaseObject *> objects_map;
+	vector<unsigned> ids_objs, ids_tab_objs;
+	vector<unsigned>::iterator itr1, itr1_end;
+	vector<BaseObject *> *obj_list=nullptr;
+	vector<BaseObject *>::iterator itr, itr_end;
+	BaseObject *object=nullptr;
+	Table *table=nullptr;
+	Index *index=nullptr;
+	Trigger *trigger=nullptr;
+	Constraint *constr=nullptr;
+	Relationship *rel=nullptr;
+	ObjectType obj_types[]={ OBJ_COLLATION, OBJ_LANGUAGE, OBJ_FUNCTION, OBJ_TYPE,
+													 OBJ_CAST, OBJ_CONVERSION, OBJ_EXTENSION,
+													 OBJ_OPERATOR, OBJ_OPFAMILY, OBJ_OPCLASS,
+													 OBJ_AGGREGATE, OBJ_DOMAIN, OBJ_TEXTBOX, BASE_RELATIONSHIP,
+													 OBJ_RELATIONSHIP, OBJ_TABLE, OBJ_VIEW, OBJ_SEQUENCE };
+
+	//Includes the database model on the objects map permitting to create the code in a correct order
+	objects_map[this->getObjectId()]=this;
+	ids_objs.push_back(this->getObjectId());
+
+	//Generating the definition for the other objects type
+	if(def_type==SchemaParser::XML_DEFINITION)
+		count=18;
+	else
+		count=14;
 
-					if(constr->getTablespace())
-						getObjectDependecies(constr->getTablespace(), deps, inc_indirect_deps);
-				}
-			}
-			//** Getting the dependecies for sequence **
-			else if(obj_type==OBJ_SEQUENCE)
+	for(i=0; i < count; i++)
+	{
+		//For SQL definition, only the textbox and base relationship does not has the code generated
+		if(def_type==SchemaParser::SQL_DEFINITION &&
+			 (obj_types[i]==OBJ_TEXTBOX || obj_types[i]==BASE_RELATIONSHIP))
+			obj_list=nullptr;
+		else
+			obj_list=getObjectList(obj_types[i]);
+
+		if(obj_list)
+		{
+			itr=obj_list->begin();
+			itr_end=obj_list->end();
+
+			while(itr!=itr_end)
 			{
-				Sequence *seq=dynamic_cast<Sequence *>(object);
-				if(seq->getOwnerColumn())
-					getObjectDependecies(seq->getOwnerColumn()->getParentTable(), deps, inc_indirect_deps);
+				object=(*itr);
+				objects_map[object->getObjectId()]=object;
+				ids_objs.push_back(object->getObjectId());
+				itr++;
 			}
-			//** Getting the dependecies for column **
-			else if(obj_type==OBJ_COLUMN)
-			{
-				BaseObject *usr_type=getObjectPgSQLType(dynamic_cast<Column *>(object)->getType());
+		}
+	}
 
-				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
+	/* Getting and storing the special objects (which reference columns of tables added for relationships)
+		on the map of objects and their ids in an array of auxiliary ids 'ids_tab_objs'.
+		For this list of tables is scanned again and its constraints and indexes are validated as special or not.
+		The vector of ids is concatenated to the main vector of ids before his ordination when the definition is XML
+		or concatenated after ordination to SQL definition, so the special objects are created correctly in both languages */
+	itr=tables.begin();
+	itr_end=tables.end();
+
+	while(itr!=itr_end)
+	{
+		table=dynamic_cast<Table *>(*itr);
+		itr++;
+
+		count=table->getConstraintCount();
+		for(i=0; i < count; i++)
+		{
+			constr=table->getConstraint(i);
+
+			/* Case the constraint is a special object stores it on the objects map. Independently to the
+			configuration, foreign keys are discarded in this iteration because on the end of the method
+			they have the definition generated */
+			if((!constr->isAddedByLinking() &&
+					((constr->getConstraintType()!=ConstraintType::primary_key && constr->isReferRelationshipAddedColumn()))))
+			{
+				objects_map[constr->getObjectId()]=constr;
+				ids_tab_objs.push_back(constr->getObjectId());
 			}
-			//** Getting the dependecies for trigger **
-			else if(obj_type==OBJ_TRIGGER)
+		}
+
+		count=table->getTriggerCount();
+		for(i=0; i < count; i++)
+		{
+			trigger=table->getTrigger(i);
+
+			if(trigger->isReferRelationshipAddedColumn())
 			{
-				Trigger *trig=dynamic_cast<Trigger *>(object);
+				objects_map[trigger->getObjectId()]=trigger;
+				ids_tab_objs.push_back(trigger->getObjectId());
+			}
+		}
 
-				if(trig->getReferencedTable())
-					getObjectDependecies(trig->getReferencedTable(), deps, inc_indirect_deps);
+		count=table->getIndexCount();
+		for(i=0; i < count; i++)
+		{
+			index=table->getIndex(i);
 
-				if(trig->getFunction())
-					getObjectDependecies(trig->getFunction(), deps, inc_indirect_deps);
+			if(index->isReferRelationshipAddedColumn())
+			{
+				objects_map[index->getObjectId()]=index;
+				ids_tab_objs.push_back(index->getObjectId());
 			}
-			//** Getting the dependecies for index **
-			else if(obj_type==OBJ_INDEX)
+		}
+	}
+
+	if(def_type==SchemaParser::XML_DEFINITION)
+		ids_objs.insert(ids_objs.end(), ids_tab_objs.begin(), ids_tab_objs.end());
+
+	/* SPECIAL CASE: Generating the SQL for tables, views, relationships and sequences
+
+	 This generations is made in the following way:
+	 1) Based on the relationship list, generates the SQL for the participant tables and after this the
+			SQL for the relationship itself.
+	 2) Generates the SQL for the other tables (that does not participates in relationships)
+	 3) The sequences must have its code generated after the tables
+	 4) View are the last objects that has the code generated avoiding table/column reference breaking */
+	if(def_type==SchemaParser::SQL_DEFINITION)
+	{
+		BaseObject *objs[3]={nullptr, nullptr, nullptr};
+		vector<BaseObject *> vet_aux;
+
+		vet_aux=relationships;
+		vet_aux.insert(vet_aux.end(), tables.begin(),tables.end());
+		vet_aux.insert(vet_aux.end(), sequences.begin(),sequences.end());
+		vet_aux.insert(vet_aux.end(), views.begin(),views.end());;
+		itr=vet_aux.begin();
+		itr_end=vet_aux.end();
+
+		while(itr!=itr_end)
+		{
+			object=(*itr);
+			itr++;
+
+			if(object->getObjectType()==OBJ_RELATIONSHIP)
 			{
-				Index *index=dynamic_cast<Index *>(object);
-				BaseObject *usr_type=nullptr;
-				unsigned i, count=index->getIndexElementCount();
+				rel=dynamic_cast<Relationship *>(object);
+				objs[0]=rel->getTable(Relationship::SRC_TABLE);
+				objs[1]=rel->getTable(Relationship::DST_TABLE);
+				objs[2]=rel;
 
-				for(i=0; i < count; i++)
+				for(i=0; i < 3; i++)
 				{
-					if(index->getIndexElement(i).getOperatorClass())
-						getObjectDependecies(index->getIndexElement(i).getOperatorClass(), deps, inc_indirect_deps);
-
-					if(index->getIndexElement(i).getColumn())
+					if(objects_map.count(objs[i]->getObjectId())==0)
 					{
-						usr_type=getObjectPgSQLType(index->getIndexElement(i).getColumn()->getType());
-
-						if(usr_type)
-							getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						objects_map[objs[i]->getObjectId()]=objs[i];
+						ids_objs.push_back(objs[i]->getObjectId());
 					}
-
-					if(index->getIndexElement(i).getCollation())
-						getObjectDependecies(index->getIndexElement(i).getCollation(), deps, inc_indirect_deps);
 				}
 			}
-			//** Getting the dependecies for table **
-			else if(obj_type==OBJ_TABLE)
+			else
 			{
-				Table *tab=dynamic_cast<Table *>(object);
-				BaseObject *usr_type=nullptr;
-				Constraint *constr=nullptr;
-				Trigger *trig=nullptr;
-				Index *index=nullptr;
-				Column *col=nullptr;
-				unsigned count, i, count1, i1;
-
-				count=tab->getColumnCount();
-				for(i=0; i < count; i++)
+				if(objects_map.count(object->getObjectId())==0)
 				{
-					col=tab->getColumn(i);
-					usr_type=getObjectPgSQLType(col->getType());
-
-					if(!col->isAddedByLinking() && usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+					objects_map[object->getObjectId()]=object;
+					ids_objs.push_back(object->getObjectId());
 				}
+			}
+		}
+	}
 
-				count=tab->getConstraintCount();
-				for(i=0; i < count; i++)
-				{
-					constr=dynamic_cast<Constraint *>(tab->getConstraint(i));
-					count1=constr->getExcludeElementCount();
+	//Sort the objects id vector to created the definition in a correct way
+	sort(ids_objs.begin(), ids_objs.end());
 
-					for(i1=0; i1 < count1; i1++)
-					{
-						if(constr->getExcludeElement(i1).getOperator())
-							getObjectDependecies(constr->getExcludeElement(i1).getOperator(), deps, inc_indirect_deps);
+	if(def_type==SchemaParser::SQL_DEFINITION)
+		ids_objs.insert(ids_objs.end(), ids_tab_objs.begin(), ids_tab_objs.end());
 
-						if(constr->getExcludeElement(i1).getOperatorClass())
-							getObjectDependecies(constr->getExcludeElement(i1).getOperatorClass(), deps, inc_indirect_deps);
-					}
+	objects.clear();
+	itr1=ids_objs.begin();
+	itr1_end=ids_objs.end();
 
-					if(inc_indirect_deps &&
-						 !constr->isAddedByLinking() &&
-						 constr->getConstraintType()==ConstraintType::foreign_key)
-						getObjectDependecies(constr->getReferencedTable(), deps, inc_indirect_deps);
+	while(itr1!=itr1_end)
+	{
+		objects.push_back(objects_map[(*itr1)]);
+		itr1++;
+	}
+}
 
-					if(!constr->isAddedByLinking() && constr->getTablespace())
-						getObjectDependecies(constr->getTablespace(), deps, inc_indirect_deps);
-				}
+void DatabaseModel::writeCode(QIODevice &output, const QString &code, unsigned def_type, QString &pending_code, bool &in_comment, bool flush)
+{
+	QByteArray buf;
 
-				count=tab->getTriggerCount();
-				for(i=0; i < count; i++)
-				{
-					trig=dynamic_cast<Trigger *>(tab->getTrigger(i));
-					if(trig->getReferencedTable())
-						getObjectDependecies(trig->getReferencedTable(), deps, inc_indirect_deps);
+	if(def_type==SchemaParser::XML_DEFINITION)
+	{
+		int pos;
 
-					if(trig->getFunction())
-						getObjectDependecies(trig->getFunction(), deps, inc_indirect_deps);
-				}
+		/* The conversion to XML entities works over complete lines so the incomplete
+			 line at the end of the code is kept until the next piece is written */
+		pending_code+=code;
+		pos=(flush ? pending_code.size()-1 : pending_code.lastIndexOf('\n'));
 
-				count=tab->getIndexCount();
-				for(i=0; i < count; i++)
-				{
-					index=dynamic_cast<Index *>(tab->getIndex(i));
-					count1=index->getIndexElementCount();
+		if(pos < 0) return;
 
-					for(i1=0; i1 < count1; i1++)
-					{
-						if(index->getIndexElement(i1).getOperatorClass())
-							getObjectDependecies(index->getIndexElement(i1).getOperatorClass(), deps, inc_indirect_deps);
+		buf=SchemaParser::convertCharsToXMLEntities(pending_code.mid(0, pos + 1), in_comment).toUtf8();
+		pending_code.remove(0, pos + 1);
+	}
+	else
+		buf=code.toUtf8();
 
-						if(index->getIndexElement(i1).getColumn())
-						{
-							usr_type=getObjectPgSQLType(index->getIndexElement(i1).getColumn()->getType());
+	if(!buf.isEmpty() && output.write(buf)!=buf.size())
+	{
+		QFile *file=qobject_cast<QFile *>(&output);
 
-							if(usr_type)
-								getObjectDependecies(usr_type, deps, inc_indirect_deps);
-						}
+		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTEN).arg(file ? file->fileName() : output.errorString()),
+										ERR_FILE_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
 
-						if(index->getIndexElement(i1).getCollation())
-							getObjectDependecies(index->getIndexElement(i1).getCollation(), deps, inc_indirect_deps);
-					}
-				}
-			}
-			//** Getting the dependecies for user defined type **
-			else if(obj_type==OBJ_TYPE)
-			{
-				Type *usr_type=dynamic_cast<Type *>(object);
-				BaseObject *aux_type=nullptr;
-				unsigned count, i;
+QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
+{
+	QBuffer buffer;
 
-				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-				{
-					aux_type=getObjectPgSQLType(usr_type->getLikeType());
+	buffer.open(QBuffer::WriteOnly);
+	writeCodeDefinition(buffer, def_type, export_file);
+	buffer.close();
 
-					if(aux_type)
-						getObjectDependecies(aux_type, deps, inc_indirect_deps);
+	return(QString::fromUtf8(buffer.data()));
+}
 
-					for(i=Type::INPUT_FUNC; i <= Type::ANALYZE_FUNC; i++)
-						getObjectDependecies(usr_type->getFunction(i), deps, inc_indirect_deps);
-				}
-				else if(usr_type->getConfiguration()==Type::COMPOSITE_TYPE)
-				{
-					count=usr_type->getAttributeCount();
-					for(i=0; i < count; i++)
-					{
-						aux_type=getObjectPgSQLType(usr_type->getAttribute(i).getType());
+QString DatabaseModel::getObjectCodeDefinition(BaseObject *object, unsigned def_type)
+{
+	ObjectType obj_type=object->getObjectType();
 
-						if(aux_type)
-							getObjectDependecies(aux_type, deps, inc_indirect_deps);
-					}
-				}
-			}
-			//** Getting the dependecies for view **
-			else if(obj_type==OBJ_VIEW)
-			{
-				View *view=dynamic_cast<View *>(object);
-				unsigned i, count;
+	if(obj_type==OBJ_TYPE && def_type==SchemaParser::SQL_DEFINITION)
+	{
+		Type *usr_type=dynamic_cast<Type *>(object);
 
-				count=view->getReferenceCount();
-				for(i=0; i < count; i++)
-				{
-					if(view->getReference(i).getTable())
-						getObjectDependecies(view->getReference(i).getTable(), deps, inc_indirect_deps);
-				}
+		//For base types only the shell type declaration is generated
+		if(usr_type->getConfiguration()==Type::BASE_TYPE)
+			return(usr_type->getCodeDefinition(def_type, true));
+		else
+			return(usr_type->getCodeDefinition(def_type));
+	}
+	else if(obj_type==OBJ_CONSTRAINT)
+		return(dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true));
+	else if(object->isSystemObject())
+		return("");
+	else
+		return(object->getCodeDefinition(def_type));
+}
 
-				for(i=0; i < view->getTriggerCount(); i++)
-					getObjectDependecies(view->getTrigger(i), deps, inc_indirect_deps);
+void DatabaseModel::generateCodeInParallel(vector<BaseObject *> &objects, vector<QString> &definitions,
+																					 vector<bool> &generated, unsigned def_type)
+{
+	vector<BaseObject *> par_objs;
+	vector<CodeGenerationTask *> tasks;
+	vector<CodeGenerationTask *>::iterator itr, itr_end;
+	CodeGenerationTask *task=nullptr;
+	QThreadPool pool;
+	QAtomicInt next_obj(0), aborted(0);
+	ObjectType obj_type;
+	unsigned i, count=objects.size();
+	int error_idx=-1;
+	Exception error;
 
-				for(i=0; i < view->getTriggerCount(); i++)
-				{
-					if(view->getTrigger(i)->getReferencedTable())
-						getObjectDependecies(view->getTrigger(i)->getReferencedTable(), deps, inc_indirect_deps);
-				}
-			}
+	for(i=0; i < count; i++)
+	{
+		obj_type=objects[i]->getObjectType();
+
+		/* The database, relationships and table children (special objects) are generated by the calling thread
+			 because their code is shared with other objects (e.g. a table generates its triggers and indexes, a
+			 relationship generates the constraints of the receiver table) */
+		if(obj_type==OBJ_DATABASE || obj_type==OBJ_RELATIONSHIP || obj_type==OBJ_CONSTRAINT ||
+			 obj_type==OBJ_TRIGGER || obj_type==OBJ_INDEX)
+			par_objs.push_back(nullptr);
+		else
+		{
+			par_objs.push_back(objects[i]);
+			generated[i]=true;
 		}
 	}
-}
 
-void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode)
-{
-	refs.clear();
+	pool.setMaxThreadCount(code_gen_threads);
 
-	if(object)
+	for(i=0; i < code_gen_threads; i++)
 	{
-		vector<BaseObject *>::iterator itr_perm, itr_perm_end;
-		ObjectType obj_type=object->getObjectType();
-		bool refer=false;
-		Permission *perm=nullptr;
+		task=new CodeGenerationTask(this, par_objs, definitions, next_obj, aborted, def_type);
+		tasks.push_back(task);
+		pool.start(task);
+	}
 
-		//Get the permissions thata references the object
-		itr_perm=permissions.begin();
-		itr_perm_end=permissions.end();
+	pool.waitForDone();
 
-		while(itr_perm!=itr_perm_end && (!exclusion_mode || (exclusion_mode && !refer)))
+	//Getting the error related to the first object (in the list order) that could not be generated
+	itr=tasks.begin();
+	itr_end=tasks.end();
+	while(itr!=itr_end)
+	{
+		task=(*itr);
+
+		if(task->getErrorIndex() >= 0 && (error_idx < 0 || task->getErrorIndex() < error_idx))
 		{
-			perm=dynamic_cast<Permission *>(*itr_perm);
-			if(perm->getObject()==object)
-			{
-				refer=true;
-				refs.push_back(perm);
-			}
-			itr_perm++;
+			error_idx=task->getErrorIndex();
+			error=task->getError();
 		}
 
-		if(obj_type==OBJ_TABLE && (!exclusion_mode || (exclusion_mode && !refer)))
-		{
-			Table *table=dynamic_cast<Table *>(object);
-			Sequence *seq=nullptr;
-			Constraint *constr=nullptr;
-			Table *tab=nullptr;
-			Trigger *gat=nullptr;
-			BaseRelationship *base_rel=nullptr;
-			View *view=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			unsigned i, count;
+		delete(task);
+		itr++;
+	}
 
-			itr=relationships.begin();
-			itr_end=relationships.end();
+	if(error_idx >= 0)
+		throw Exception(error.getErrorMessage(), error.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
+}
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				base_rel=dynamic_cast<BaseRelationship *>(*itr);
-				if(base_rel->getTable(BaseRelationship::SRC_TABLE)==table ||
-					 base_rel->getTable(BaseRelationship::DST_TABLE)==table)
-				{
-					refer=true;
-					refs.push_back(base_rel);
-				}
-				itr++;
-			}
+void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
+{
+	QFile output(filename);
 
-			itr=sequences.begin();
-			itr_end=sequences.end();
+	//The file is also read in order to calculate the checksum appended to the XML definition
+	output.open(QFile::ReadWrite | QFile::Truncate);
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				seq=dynamic_cast<Sequence *>(*itr);
-				if(seq->getOwnerColumn() &&
-					 seq->getOwnerColumn()->getParentTable()==table)
-				{
-					refer=true;
-					refs.push_back(seq);
-				}
+	if(!output.isOpen())
+		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTEN).arg(filename),
+										ERR_FILE_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-				itr++;
-			}
+	try
+	{
+		//The code is written on the file as the objects have their definition generated
+		this->writeCodeDefinition(output, def_type, true);
 
-			itr=tables.begin();
-			itr_end=tables.end();
+		/* The checksum identifies the file as written by pgModeler so it can be loaded
+			 without the DTD validation while it isn't modified (see XMLParser::isTrustedFile()) */
+		if(def_type==SchemaParser::XML_DEFINITION)
+			XMLParser::appendChecksum(output);
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				tab=dynamic_cast<Table *>(*itr);
+		output.close();
+	}
+	catch(Exception &e)
+	{
+		if(output.isOpen()) output.close();
+		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTER_INV_DEF).arg(filename),
+										ERR_FILE_NOT_WRITTER_INV_DEF,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
 
-				count=tab->getConstraintCount();
-				for(i=0; i < count&& (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					constr=tab->getConstraint(i);
-					//If a constraint references its own parent table it'll not be included on the references list
-					if(constr->getConstraintType()==ConstraintType::foreign_key &&
+void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps, int max_depth, const vector<ObjectType> &types)
+{
+	vector<BaseObject *> objects;
+
+	objects.push_back(object);
+	getObjectDependecies(objects, deps, inc_indirect_deps, max_depth, types);
+}
+
+void DatabaseModel::getObjectDependecies(const vector<BaseObject *> &objects, vector<BaseObject *> &deps, bool inc_indirect_deps, int max_depth, const vector<ObjectType> &types)
+{
+	QHash<BaseObject *, int> visited;
+	QHash<BaseObject *, int>::iterator vis_itr;
+	vector<pair<BaseObject *, int> > worklist;
+	vector<BaseObject *> direct_deps;
+	vector<BaseObject *>::const_iterator itr, itr_end;
+	vector<BaseObject *>::reverse_iterator ritr, ritr_end;
+	BaseObject *object=nullptr;
+	unsigned i;
+	int depth;
+
+	//Without the indirect dependencies only the objects linked to the informed ones are retrieved
+	if(!inc_indirect_deps)
+		max_depth=1;
+
+	/* Stores the smallest depth in which each object was visited. Objects already on the list are
+		 not searched again so they are marked with a depth smaller than the one of the informed objects */
+	itr=deps.begin();
+	itr_end=deps.end();
+	while(itr!=itr_end)
+	{
+		visited[*itr]=-1;
+		itr++;
+	}
+
+	/* The informed objects are stacked in reverse order so they are visited in the same
+		 order they are informed. Each one is traversed completely before the next one */
+	for(i=objects.size(); i > 0; i--)
+		worklist.push_back(make_pair(objects[i-1], 0));
+
+	/* Depth-first search using an explicit stack. The dependencies of an object are stacked
+		 in reverse order so the resulting list follows the order of a recursive traversal */
+	while(!worklist.empty())
+	{
+		object=worklist.back().first;
+		depth=worklist.back().second;
+		worklist.pop_back();
+
+		if(!object)
+			continue;
+
+		vis_itr=visited.find(object);
+
+		/* When the search is limited by depth an object first reached at a deeper level (e.g. as a dependency
+			 of a previous informed object) is expanded again when reached at a shallower one, since its
+			 dependencies may be inside the limit now. Without limit every object is expanded only once */
+		if(vis_itr!=visited.end())
+		{
+			if(max_depth < 0 || vis_itr.value() <= depth)
+				continue;
+
+			vis_itr.value()=depth;
+		}
+		else
+		{
+			visited[object]=depth;
+
+			if(types.empty() || std::find(types.begin(), types.end(), object->getObjectType())!=types.end())
+				deps.push_back(object);
+		}
+
+		if(max_depth < 0 || depth < max_depth)
+		{
+			getDirectDependencies(object, direct_deps, inc_indirect_deps);
+			ritr=direct_deps.rbegin();
+			ritr_end=direct_deps.rend();
+
+			while(ritr!=ritr_end)
+			{
+				vis_itr=visited.find(*ritr);
+
+				if(*ritr && (vis_itr==visited.end() || (max_depth >= 0 && vis_itr.value() > depth + 1)))
+					worklist.push_back(make_pair(*ritr, depth + 1));
+				ritr++;
+			}
+		}
+	}
+}
+
+void DatabaseModel::getDirectDependencies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps)
+{
+	ObjectType obj_type;
+
+	deps.clear();
+
+	if(!object)
+		return;
+
+	obj_type=object->getObjectType();
+
+	//The schema, tablespace, owner and collation of the object are its first dependencies
+	if(object->getSchema())
+		deps.push_back(object->getSchema());
+
+	if(object->getTablespace())
+		deps.push_back(object->getTablespace());
+
+	if(object->getOwner())
+		deps.push_back(object->getOwner());
+
+	if(object->getCollation())
+		deps.push_back(object->getCollation());
+
+	//** Getting the dependecies for operator class **
+	if(obj_type==OBJ_OPCLASS)
+	{
+		OperatorClass *op_class=dynamic_cast<OperatorClass *>(object);
+		BaseObject *usr_type=getObjectPgSQLType(op_class->getDataType());
+
+		if(usr_type)
+			deps.push_back(usr_type);
+
+		if(op_class->getFamily())
+			deps.push_back(op_class->getFamily());
+	}
+	//** Getting the dependecies for domain **
+	else if(obj_type==OBJ_DOMAIN)
+	{
+		BaseObject *usr_type=getObjectPgSQLType(dynamic_cast<Domain *>(object)->getType());
+
+		if(usr_type)
+			deps.push_back(usr_type);
+	}
+	//** Getting the dependecies for conversion **
+	else if(obj_type==OBJ_CONVERSION)
+	{
+		Function *func=dynamic_cast<Conversion *>(object)->getConversionFunction();
+		deps.push_back(func);
+	}
+	//** Getting the dependecies for cast **
+	else if(obj_type==OBJ_CAST)
+	{
+		Cast *cast=dynamic_cast<Cast *>(object);
+		BaseObject *usr_type=nullptr;
+
+		for(unsigned i=Cast::SRC_TYPE; i <= Cast::DST_TYPE; i++)
+		{
+			usr_type=getObjectPgSQLType(cast->getDataType(i));
+
+			if(usr_type)
+				deps.push_back(usr_type);
+		}
+
+		deps.push_back(cast->getCastFunction());
+	}
+	//** Getting the dependecies for function **
+	else if(obj_type==OBJ_FUNCTION)
+	{
+		Function *func=dynamic_cast<Function *>(object);
+		BaseObject *usr_type=getObjectPgSQLType(func->getReturnType());
+		unsigned count, i;
+
+		if(!func->isSystemObject())
+			deps.push_back(func->getLanguage());
+
+		if(usr_type)
+			deps.push_back(usr_type);
+
+		count=func->getParameterCount();
+		for(i=0; i < count; i++)
+		{
+			usr_type=getObjectPgSQLType(func->getParameter(i).getType());
+
+			if(usr_type)
+				deps.push_back(usr_type);
+		}
+
+		count=func->getReturnedTableColumnCount();
+		for(i=0; i < count; i++)
+		{
+			usr_type=getObjectPgSQLType(func->getReturnedTableColumn(i).getType());
+
+			if(usr_type)
+				deps.push_back(usr_type);
+		}
+	}
+	//** Getting the dependecies for aggregate **
+	else if(obj_type==OBJ_AGGREGATE)
+	{
+		Aggregate *aggreg=dynamic_cast<Aggregate *>(object);
+		BaseObject *usr_type=nullptr;
+		unsigned count, i;
+
+		for(i=Aggregate::FINAL_FUNC; i <= Aggregate::TRANSITION_FUNC; i++)
+			deps.push_back(aggreg->getFunction(i));
+
+		usr_type=getObjectPgSQLType(aggreg->getStateType());
+
+		if(usr_type)
+			deps.push_back(usr_type);
+
+		if(aggreg->getSortOperator())
+			deps.push_back(aggreg->getSortOperator());
+
+		count=aggreg->getDataTypeCount();
+		for(i=0; i < count; i++)
+		{
+			usr_type=getObjectPgSQLType(aggreg->getDataType(i));
+
+			if(usr_type)
+				deps.push_back(usr_type);
+		}
+	}
+	//** Getting the dependecies for language **
+	else if(obj_type==OBJ_LANGUAGE)
+	{
+		Language *lang=dynamic_cast<Language *>(object);
+
+		for(unsigned i=Language::VALIDATOR_FUNC; i <= Language::INLINE_FUNC; i++)
+		{
+			if(lang->getFunction(i))
+				deps.push_back(lang->getFunction(i));
+		}
+	}
+	//** Getting the dependecies for operator **
+	else if(obj_type==OBJ_OPERATOR)
+	{
+		Operator *oper=dynamic_cast<Operator *>(object);
+		BaseObject *usr_type=nullptr;
+		unsigned i;
+
+		for(i=Operator::FUNC_OPERATOR; i <= Operator::FUNC_RESTRICT; i++)
+		{
+			if(oper->getFunction(i))
+				deps.push_back(oper->getFunction(i));
+		}
+
+		for(i=Operator::LEFT_ARG; i <= Operator::RIGHT_ARG; i++)
+		{
+			usr_type=getObjectPgSQLType(oper->getArgumentType(i));
+
+			if(usr_type)
+				deps.push_back(usr_type);
+		}
+
+		for(i=Operator::OPER_COMMUTATOR; i <= Operator::OPER_NEGATOR; i++)
+		{
+			if(oper->getOperator(i))
+				deps.push_back(oper->getOperator(i));
+		}
+	}
+	//** Getting the dependecies for role **
+	else if(obj_type==OBJ_ROLE)
+	{
+		Role *role=dynamic_cast<Role *>(object);
+		unsigned i, i1, count,
+				role_types[3]={ Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE };
+
+		for(i=0; i < 3; i++)
+		{
+			count=role->getRoleCount(role_types[i]);
+			for(i1=0; i1 < count; i1++)
+				deps.push_back(role->getRole(role_types[i], i1));
+		}
+	}
+	//** Getting the dependecies for relationships **
+	else if(obj_type==OBJ_RELATIONSHIP)
+	{
+		Relationship *rel=dynamic_cast<Relationship *>(object);
+		BaseObject *usr_type=nullptr;
+		Constraint *constr=nullptr;
+		unsigned i, count;
+
+		deps.push_back(rel->getTable(Relationship::SRC_TABLE));
+		deps.push_back(rel->getTable(Relationship::DST_TABLE));
+
+		count=rel->getAttributeCount();
+		for(i=0; i < count; i++)
+		{
+			usr_type=getObjectPgSQLType(rel->getAttribute(i)->getType());
+
+			if(usr_type)
+				deps.push_back(usr_type);
+		}
+
+		count=rel->getConstraintCount();
+		for(i=0; i < count; i++)
+		{
+			constr=dynamic_cast<Constraint *>(rel->getConstraint(i));
+
+			if(constr->getTablespace())
+				deps.push_back(constr->getTablespace());
+		}
+	}
+	//** Getting the dependecies for sequence **
+	else if(obj_type==OBJ_SEQUENCE)
+	{
+		Sequence *seq=dynamic_cast<Sequence *>(object);
+		if(seq->getOwnerColumn())
+			deps.push_back(seq->getOwnerColumn()->getParentTable());
+	}
+	//** Getting the dependecies for column **
+	else if(obj_type==OBJ_COLUMN)
+	{
+		BaseObject *usr_type=getObjectPgSQLType(dynamic_cast<Column *>(object)->getType());
+
+		if(usr_type)
+			deps.push_back(usr_type);
+	}
+	//** Getting the dependecies for trigger **
+	else if(obj_type==OBJ_TRIGGER)
+	{
+		Trigger *trig=dynamic_cast<Trigger *>(object);
+
+		if(trig->getReferencedTable())
+			deps.push_back(trig->getReferencedTable());
+
+		if(trig->getFunction())
+			deps.push_back(trig->getFunction());
+	}
+	//** Getting the dependecies for index **
+	else if(obj_type==OBJ_INDEX)
+	{
+		Index *index=dynamic_cast<Index *>(object);
+		BaseObject *usr_type=nullptr;
+		unsigned i, count=index->getIndexElementCount();
+
+		for(i=0; i < count; i++)
+		{
+			if(index->getIndexElement(i).getOperatorClass())
+				deps.push_back(index->getIndexElement(i).getOperatorClass());
+
+			if(index->getIndexElement(i).getColumn())
+			{
+				usr_type=getObjectPgSQLType(index->getIndexElement(i).getColumn()->getType());
+
+				if(usr_type)
+					deps.push_back(usr_type);
+			}
+
+			if(index->getIndexElement(i).getCollation())
+				deps.push_back(index->getIndexElement(i).getCollation());
+		}
+	}
+	//** Getting the dependecies for table **
+	else if(obj_type==OBJ_TABLE)
+	{
+		Table *tab=dynamic_cast<Table *>(object);
+		BaseObject *usr_type=nullptr;
+		Constraint *constr=nullptr;
+		Trigger *trig=nullptr;
+		Index *index=nullptr;
+		Column *col=nullptr;
+		unsigned count, i, count1, i1;
+
+		count=tab->getColumnCount();
+		for(i=0; i < count; i++)
+		{
+			col=tab->getColumn(i);
+			usr_type=getObjectPgSQLType(col->getType());
+
+			if(!col->isAddedByLinking() && usr_type)
+				deps.push_back(usr_type);
+		}
+
+		count=tab->getConstraintCount();
+		for(i=0; i < count; i++)
+		{
+			constr=dynamic_cast<Constraint *>(tab->getConstraint(i));
+			count1=constr->getExcludeElementCount();
+
+			for(i1=0; i1 < count1; i1++)
+			{
+				if(constr->getExcludeElement(i1).getOperator())
+					deps.push_back(constr->getExcludeElement(i1).getOperator());
+
+				if(constr->getExcludeElement(i1).getOperatorClass())
+					deps.push_back(constr->getExcludeElement(i1).getOperatorClass());
+			}
+
+			if(inc_indirect_deps &&
+				 !constr->isAddedByLinking() &&
+				 constr->getConstraintType()==ConstraintType::foreign_key)
+				deps.push_back(constr->getReferencedTable());
+
+			if(!constr->isAddedByLinking() && constr->getTablespace())
+				deps.push_back(constr->getTablespace());
+		}
+
+		count=tab->getTriggerCount();
+		for(i=0; i < count; i++)
+		{
+			trig=dynamic_cast<Trigger *>(tab->getTrigger(i));
+			if(trig->getReferencedTable())
+				deps.push_back(trig->getReferencedTable());
+
+			if(trig->getFunction())
+				deps.push_back(trig->getFunction());
+		}
+
+		count=tab->getIndexCount();
+		for(i=0; i < count; i++)
+		{
+			index=dynamic_cast<Index *>(tab->getIndex(i));
+			count1=index->getIndexElementCount();
+
+			for(i1=0; i1 < count1; i1++)
+			{
+				if(index->getIndexElement(i1).getOperatorClass())
+					deps.push_back(index->getIndexElement(i1).getOperatorClass());
+
+				if(index->getIndexElement(i1).getColumn())
+				{
+					usr_type=getObjectPgSQLType(index->getIndexElement(i1).getColumn()->getType());
+
+					if(usr_type)
+						deps.push_back(usr_type);
+				}
+
+				if(index->getIndexElement(i1).getCollation())
+					deps.push_back(index->getIndexElement(i1).getCollation());
+			}
+		}
+	}
+	//** Getting the dependecies for user defined type **
+	else if(obj_type==OBJ_TYPE)
+	{
+		Type *usr_type=dynamic_cast<Type *>(object);
+		BaseObject *aux_type=nullptr;
+		unsigned count, i;
+
+		if(usr_type->getConfiguration()==Type::BASE_TYPE)
+		{
+			aux_type=getObjectPgSQLType(usr_type->getLikeType());
+
+			if(aux_type)
+				deps.push_back(aux_type);
+
+			for(i=Type::INPUT_FUNC; i <= Type::ANALYZE_FUNC; i++)
+				deps.push_back(usr_type->getFunction(i));
+		}
+		else if(usr_type->getConfiguration()==Type::COMPOSITE_TYPE)
+		{
+			count=usr_type->getAttributeCount();
+			for(i=0; i < count; i++)
+			{
+				aux_type=getObjectPgSQLType(usr_type->getAttribute(i).getType());
+
+				if(aux_type)
+					deps.push_back(aux_type);
+			}
+		}
+	}
+	//** Getting the dependecies for view **
+	else if(obj_type==OBJ_VIEW)
+	{
+		View *view=dynamic_cast<View *>(object);
+		unsigned i, count;
+
+		count=view->getReferenceCount();
+		for(i=0; i < count; i++)
+		{
+			if(view->getReference(i).getTable())
+				deps.push_back(view->getReference(i).getTable());
+		}
+
+		for(i=0; i < view->getTriggerCount(); i++)
+			deps.push_back(view->getTrigger(i));
+
+		for(i=0; i < view->getTriggerCount(); i++)
+		{
+			if(view->getTrigger(i)->getReferencedTable())
+				deps.push_back(view->getTrigger(i)->getReferencedTable());
+		}
+	}
+}
+
+void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode)
+{
+	refs.clear();
+
+	if(object)
+	{
+		QHash<BaseObject *, QSet<BaseObject *> >::const_iterator itr_refs;
+		QSet<BaseObject *>::const_iterator itr, itr_end;
+		map<unsigned, BaseObject *> refs_map;
+		map<unsigned, BaseObject *>::iterator itr_map, itr_map_end;
+
+		if(invalid_refs_index)
+			createReferencesIndex();
+
+		itr_refs=obj_referrers.constFind(object);
+
+		if(itr_refs!=obj_referrers.constEnd())
+		{
+			//The references are returned in the objects creation order
+			itr=itr_refs.value().begin();
+			itr_end=itr_refs.value().end();
+
+			while(itr!=itr_end)
+			{
+				refs_map[(*itr)->getObjectId()]=(*itr);
+				itr++;
+			}
+
+			itr_map=refs_map.begin();
+			itr_map_end=refs_map.end();
+
+			/* In exclusion mode only the first reference is returned. As base relationship are created
+			automatically by the model they aren't considered as a reference to the table in this mode */
+			while(itr_map!=itr_map_end && (!exclusion_mode || refs.empty()))
+			{
+				if(!exclusion_mode || itr_map->second->getObjectType()!=BASE_RELATIONSHIP)
+					refs.push_back(itr_map->second);
+
+				itr_map++;
+			}
+		}
+	}
+
+		#ifndef QT_NO_DEBUG
+			checkObjectReferences(object, refs, exclusion_mode);
+		#endif
+	}
+}
+
+#ifndef QT_NO_DEBUG
+void DatabaseModel::checkObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode)
+{
+	vector<BaseObject *> scan_refs;
+	bool stale=false;
+
+	scanObjectReferences(object, scan_refs, exclusion_mode);
+
+	//In exclusion mode only the presence of references matters since each search stops on a different object
+	if(exclusion_mode)
+		stale=(refs.empty()!=scan_refs.empty());
+	else
+	{
+		QSet<BaseObject *> idx_set, scan_set;
+		unsigned i;
+
+		for(i=0; i < refs.size(); i++)
+			idx_set.insert(refs[i]);
+
+		for(i=0; i < scan_refs.size(); i++)
+			scan_set.insert(scan_refs[i]);
+
+		stale=(idx_set!=scan_set);
+	}
+
+	/* The references found by the scan are returned when the index doesn't match them. This way a missing
+		 call to updateObjectReferences() can't allow the removal of an object that is still referenced */
+	if(stale)
+	{
+		qWarning("DatabaseModel: the references index of '%s' (%s) differs from the model scan (%u indexed, %u scanned)",
+						 object->getName(true).toUtf8().constData(), object->getTypeName().toUtf8().constData(),
+						 static_cast<unsigned>(refs.size()), static_cast<unsigned>(scan_refs.size()));
+		refs=scan_refs;
+	}
+}
+
+void DatabaseModel::scanObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode)
+{
+	refs.clear();
+
+	if(object)
+	{
+		vector<BaseObject *>::iterator itr_perm, itr_perm_end;
+		ObjectType obj_type=object->getObjectType();
+		bool refer=false;
+		Permission *perm=nullptr;
+
+		//Get the permissions thata references the object
+		itr_perm=permissions.begin();
+		itr_perm_end=permissions.end();
+
+		while(itr_perm!=itr_perm_end && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			perm=dynamic_cast<Permission *>(*itr_perm);
+			if(perm->getObject()==object)
+			{
+				refer=true;
+				refs.push_back(perm);
+			}
+			itr_perm++;
+		}
+
+		if(obj_type==OBJ_TABLE && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			Table *table=dynamic_cast<Table *>(object);
+			Sequence *seq=nullptr;
+			Constraint *constr=nullptr;
+			Table *tab=nullptr;
+			Trigger *gat=nullptr;
+			BaseRelationship *base_rel=nullptr;
+			View *view=nullptr;
+			vector<BaseObject *>::iterator itr, itr_end;
+			unsigned i, count;
+
+			itr=relationships.begin();
+			itr_end=relationships.end();
+
+			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			{
+				base_rel=dynamic_cast<BaseRelationship *>(*itr);
+				if(base_rel->getTable(BaseRelationship::SRC_TABLE)==table ||
+					 base_rel->getTable(BaseRelationship::DST_TABLE)==table)
+				{
+					refer=true;
+					refs.push_back(base_rel);
+				}
+				itr++;
+			}
+
+			itr=sequences.begin();
+			itr_end=sequences.end();
+
+			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			{
+				seq=dynamic_cast<Sequence *>(*itr);
+				if(seq->getOwnerColumn() &&
+					 seq->getOwnerColumn()->getParentTable()==table)
+				{
+					refer=true;
+					refs.push_back(seq);
+				}
+
+				itr++;
+			}
+
+			itr=tables.begin();
+			itr_end=tables.end();
+
+			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			{
+				tab=dynamic_cast<Table *>(*itr);
+
+				count=tab->getConstraintCount();
+				for(i=0; i < count&& (!exclusion_mode || (exclusion_mode && !refer)); i++)
+				{
+					constr=tab->getConstraint(i);
+					//If a constraint references its own parent table it'll not be included on the references list
+					if(constr->getConstraintType()==ConstraintType::foreign_key &&
 						 constr->getParentTable()!=constr->getReferencedTable() &&
 						 constr->getReferencedTable()==table)
 					{
@@ -7092,21 +8019,274 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 				role_aux=dynamic_cast<Role *>(*itr);
 				itr++;
 
-				for(i1=0; i1 < 3 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
+				for(i1=0; i1 < 3 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
+				{
+					count=role_aux->getRoleCount(role_types[i1]);
+					for(i=0; i < count && !refer; i++)
+					{
+						if(role_aux->getRole(role_types[i1], i)==role)
+						{
+							refer=true;
+							refs.push_back(role_aux);
+						}
+					}
+				}
+			}
+
+			for(i=0; i < 13 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+			{
+				obj_list=getObjectList(obj_types[i]);
+				itr=obj_list->begin();
+				itr_end=obj_list->end();
+
+				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+				{
+					if((*itr)->getOwner()==role)
+					{
+						refer=true;
+						refs.push_back(*itr);
+					}
+					itr++;
+				}
+			}
+
+			//Special case: check if the role to be removed is the owner of the database
+			if((!exclusion_mode || (exclusion_mode && !refer)) && this->getOwner()==role)
+			{
+				refer=true;
+				refs.push_back(this);
+			}
+		}
+
+		if(obj_type==OBJ_TABLESPACE && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			vector<BaseObject *>::iterator itr, itr_end;
+			unsigned i, count;
+			Table *tab=nullptr;
+			Index *ind=nullptr;
+			Constraint *rest=nullptr;
+
+			itr=tables.begin();
+			itr_end=tables.end();
+
+			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			{
+				tab=dynamic_cast<Table *>(*itr);
+
+				if(tab->getTablespace()==object)
+				{
+					refer=true;
+					refs.push_back(tab);
+				}
+
+				count=tab->getIndexCount();
+				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+				{
+					ind=tab->getIndex(i);
+					if(ind->getTablespace()==object)
+					{
+						refer=true;
+						refs.push_back(ind);
+					}
+				}
+
+				count=tab->getConstraintCount();
+				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+				{
+					rest=tab->getConstraint(i);
+					if(rest->getTablespace()==object)
+					{
+						refer=true;
+						refs.push_back(rest);
+					}
+				}
+
+				itr++;
+			}
+
+			if((!exclusion_mode || (exclusion_mode && !refer)) && this->BaseObject::getTablespace()==object)
+			{
+				refer=true;
+				refs.push_back(this);
+			}
+		}
+
+		if(obj_type==OBJ_LANGUAGE && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			vector<BaseObject *>::iterator itr, itr_end;
+			Function *func=nullptr;
+
+			itr=functions.begin();
+			itr_end=functions.end();
+
+			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			{
+				func=dynamic_cast<Function *>(*itr);
+				if(func->getLanguage()==object)
+				{
+					refer=true;
+					refs.push_back(func);
+				}
+				itr++;
+			}
+		}
+
+		if(obj_type==OBJ_OPERATOR && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			vector<BaseObject *> *obj_list=nullptr;
+			vector<BaseObject *>::iterator itr, itr_end;
+			ObjectType obj_types[3]={OBJ_OPCLASS,
+															 OBJ_AGGREGATE,
+															 OBJ_OPERATOR};
+			unsigned i, i1, count;
+			OperatorClass *op_class=nullptr;
+			Operator *oper_aux=nullptr, *oper=dynamic_cast<Operator *>(object);
+
+			for(i=0; i < 3 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+			{
+				obj_list=getObjectList(obj_types[i]);
+				itr=obj_list->begin();
+				itr_end=obj_list->end();
+
+				if(obj_types[i]==OBJ_OPCLASS)
+				{
+					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+					{
+						op_class=dynamic_cast<OperatorClass *>(*itr);
+						itr++;
+
+						count=op_class->getElementCount();
+						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
+						{
+							if(op_class->getElement(i1).getOperator()==oper)
+							{
+								refer=true;
+								refs.push_back(op_class);
+							}
+						}
+					}
+				}
+				else if(obj_types[i]==OBJ_AGGREGATE)
+				{
+					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+					{
+						if(dynamic_cast<Aggregate *>(*itr)->getSortOperator()==oper)
+						{
+							refer=true;
+							refs.push_back(*itr);
+						}
+						itr++;
+					}
+				}
+				else if(obj_types[i]==OBJ_OPERATOR)
+				{
+					while(itr!=itr_end && !refer)
+					{
+						oper_aux=dynamic_cast<Operator *>(*itr);
+						itr++;
+
+						for(i1=Operator::OPER_COMMUTATOR; i1 <= Operator::OPER_NEGATOR &&
+								(!exclusion_mode || (exclusion_mode && !refer)); i1++)
+						{
+							if(oper_aux->getOperator(i1)==oper)
+							{
+								refer=true;
+								refs.push_back(oper_aux);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		if(obj_type==OBJ_OPFAMILY && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			vector<BaseObject *>::iterator itr, itr_end;
+			OperatorFamily *op_family=dynamic_cast<OperatorFamily *>(object);
+
+			itr=op_classes.begin();
+			itr_end=op_classes.end();
+
+			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			{
+				if(dynamic_cast<OperatorClass *>(*itr)->getFamily()==op_family)
+				{
+					refer=true;
+					refs.push_back(*itr);
+				}
+				itr++;
+			}
+		}
+
+		if(obj_type==OBJ_COLLATION && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			ObjectType  obj_types[]={ OBJ_DOMAIN, OBJ_COLLATION, OBJ_TYPE },
+									tab_obj_types[]={ OBJ_COLUMN, OBJ_INDEX };
+			unsigned i, count;
+			vector<BaseObject *> *obj_list=nullptr;
+			vector<BaseObject *>::iterator itr, itr_end;
+			vector<TableObject *> *tab_obj_list=nullptr;
+			vector<TableObject *>::iterator tab_itr, tab_itr_end;
+			TableObject *tab_obj=nullptr;
+
+			count=sizeof(obj_types)/sizeof(ObjectType);
+			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+			{
+				obj_list=getObjectList(obj_types[i]);
+				itr=obj_list->begin();
+				itr_end=obj_list->end();
+
+				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+				{
+					if((*itr)->getCollation()==object)
+					{
+						refer=true;
+						refs.push_back(*itr);
+					}
+
+					itr++;
+				}
+			}
+
+			count=sizeof(tab_obj_types)/sizeof(ObjectType);
+			obj_list=getObjectList(OBJ_TABLE);
+			itr=obj_list->begin();
+			itr_end=obj_list->end();
+
+			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			{
+				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
 				{
-					count=role_aux->getRoleCount(role_types[i1]);
-					for(i=0; i < count && !refer; i++)
+					tab_obj_list=dynamic_cast<Table *>(*itr)->getObjectList(tab_obj_types[i]);
+					tab_itr=tab_obj_list->begin();
+					tab_itr_end=tab_obj_list->end();
+
+					while(tab_itr!=tab_itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
 					{
-						if(role_aux->getRole(role_types[i1], i)==role)
+						tab_obj=(*tab_itr);
+						if((tab_obj->getObjectType()==OBJ_COLUMN && tab_obj->getCollation()==object) ||
+							 (tab_obj->getObjectType()==OBJ_INDEX &&
+								dynamic_cast<Index *>(tab_obj)->isReferCollation(dynamic_cast<Collation *>(object))))
 						{
 							refer=true;
-							refs.push_back(role_aux);
+							refs.push_back(*tab_itr);
 						}
+						tab_itr++;
 					}
 				}
+				itr++;
 			}
+		}
 
-			for(i=0; i < 13 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+		if(obj_type==OBJ_COLUMN && (!exclusion_mode || (exclusion_mode && !refer)))
+		{
+			Column *column=dynamic_cast<Column *>(object);
+			vector<BaseObject *> *obj_list=nullptr;
+			vector<BaseObject *>::iterator itr, itr_end;
+			ObjectType  obj_types[]={ OBJ_SEQUENCE, OBJ_VIEW, OBJ_TABLE, OBJ_RELATIONSHIP };
+			unsigned i, count=4;
+
+			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
 			{
 				obj_list=getObjectList(obj_types[i]);
 				itr=obj_list->begin();
@@ -7114,318 +8294,581 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 
 				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
 				{
-					if((*itr)->getOwner()==role)
+					if((obj_types[i]==OBJ_SEQUENCE && dynamic_cast<Sequence *>(*itr)->getOwnerColumn()==column) ||
+						 (obj_types[i]==OBJ_VIEW && dynamic_cast<View *>(*itr)->isReferencingColumn(column)))
 					{
 						refer=true;
 						refs.push_back(*itr);
 					}
+					else if(obj_types[i]==OBJ_TABLE)
+					{
+						Table *tab=dynamic_cast<Table *>(*itr);
+						unsigned trig_cnt, constr_cnt, idx, count1, i1;
+						Trigger *trig=nullptr;
+
+						constr_cnt=tab->getConstraintCount();
+						for(idx=0; idx < constr_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
+						{
+							if(tab->getConstraint(idx)->isColumnReferenced(column))
+							{
+								refer=true;
+								refs.push_back(tab->getConstraint(idx));
+							}
+
+						}
+
+						trig_cnt=tab->getTriggerCount();
+						for(idx=0; idx < trig_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
+						{
+							trig=tab->getTrigger(idx);
+							count1=trig->getColumnCount();
+
+							for(i1=0; i1 < count1 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
+							{
+								if(trig->getColumn(i1)==column)
+								{
+									refer=true;
+									refs.push_back(trig);
+								}
+							}
+						}
+					}
+					else if(obj_types[i]==OBJ_RELATIONSHIP)
+					{
+						Relationship *rel=dynamic_cast<Relationship *>(*itr);
+						unsigned constr_cnt, idx;
+
+						constr_cnt=rel->getConstraintCount();
+						for(idx=0; idx < constr_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
+						{
+							if(rel->getConstraint(idx)->isColumnReferenced(column))
+							{
+								refer=true;
+								refs.push_back(rel);
+							}
+						}
+					}
+
 					itr++;
 				}
 			}
+		}
+	}
+}
+#endif
 
-			//Special case: check if the role to be removed is the owner of the database
-			if((!exclusion_mode || (exclusion_mode && !refer)) && this->getOwner()==role)
+void DatabaseModel::updateReferencesIndex(void)
+{
+	if(invalid_refs_index)
+		createReferencesIndex();
+}
+
+void DatabaseModel::updateObjectReferences(BaseObject *object)
+{
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+	Table *table=nullptr;
+	bool in_model=false;
+
+	if(invalid_refs_index || !object)
+		return;
+
+	//Table objects belongs to the model when their parent table does
+	if(tab_obj)
+	{
+		table=dynamic_cast<Table *>(tab_obj->getParentTable());
+		in_model=(table && table->getDatabase()==this);
+	}
+	else
+		in_model=(object==this || object->getDatabase()==this);
+
+	if(in_model)
+		addObjectReferences(object, false);
+	else
+		removeObjectReferences(object, false, true);
+}
+
+void DatabaseModel::createReferencesIndex(void)
+{
+	ObjectType types[]={ OBJ_PERMISSION, OBJ_RELATIONSHIP, OBJ_SEQUENCE, OBJ_TABLE,
+											 OBJ_VIEW, OBJ_CAST, OBJ_CONVERSION, OBJ_AGGREGATE,
+											 OBJ_OPERATOR, OBJ_TYPE, OBJ_LANGUAGE, OBJ_FUNCTION,
+											 OBJ_DOMAIN, OBJ_OPCLASS, OBJ_OPFAMILY, OBJ_ROLE,
+											 OBJ_SCHEMA, OBJ_TABLESPACE, OBJ_COLLATION, OBJ_EXTENSION,
+											 BASE_RELATIONSHIP };
+	vector<BaseObject *> *obj_list=nullptr;
+	vector<BaseObject *>::iterator itr, itr_end;
+	unsigned i, count=sizeof(types)/sizeof(ObjectType);
+
+	obj_referrers.clear();
+	obj_referenced.clear();
+
+	for(i=0; i < count; i++)
+	{
+		obj_list=getObjectList(types[i]);
+		itr=obj_list->begin();
+		itr_end=obj_list->end();
+
+		while(itr!=itr_end)
+		{
+			addObjectReferences(*itr, true);
+			itr++;
+		}
+	}
+
+	//The database itself references its owner and tablespace
+	addObjectReferences(this, false);
+	invalid_refs_index=false;
+}
+
+void DatabaseModel::addObjectReferences(BaseObject *object, bool inc_children)
+{
+	vector<BaseObject *> ref_objs;
+	vector<BaseObject *>::iterator itr, itr_end;
+	Table *table=dynamic_cast<Table *>(object);
+
+	if(!object)
+		return;
+
+	//Discards the references previously registered for the object
+	if(obj_referenced.contains(object))
+		removeObjectReferences(object, false, false);
+
+	getReferencedObjects(object, ref_objs);
+	itr=ref_objs.begin();
+	itr_end=ref_objs.end();
+
+	while(itr!=itr_end)
+	{
+		obj_referrers[*itr].insert(object);
+		itr++;
+	}
+
+	obj_referenced[object]=ref_objs;
+
+	if(table && inc_children)
+	{
+		ObjectType types[]={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_TRIGGER, OBJ_INDEX };
+		vector<TableObject *> *tab_obj_list=nullptr;
+		vector<TableObject *>::iterator tab_itr, tab_itr_end;
+		unsigned i, count=sizeof(types)/sizeof(ObjectType);
+
+		for(i=0; i < count; i++)
+		{
+			tab_obj_list=table->getObjectList(types[i]);
+			tab_itr=tab_obj_list->begin();
+			tab_itr_end=tab_obj_list->end();
+
+			while(tab_itr!=tab_itr_end)
 			{
-				refer=true;
-				refs.push_back(this);
+				addObjectReferences(*tab_itr, false);
+				tab_itr++;
 			}
 		}
+	}
+}
 
-		if(obj_type==OBJ_TABLESPACE && (!exclusion_mode || (exclusion_mode && !refer)))
+void DatabaseModel::removeObjectReferences(BaseObject *object, bool inc_children, bool rem_referrers)
+{
+	QHash<BaseObject *, vector<BaseObject *> >::iterator itr_refs;
+	QHash<BaseObject *, QSet<BaseObject *> >::iterator itr_referrers;
+	vector<BaseObject *> objs;
+	vector<BaseObject *>::iterator itr, itr_end, itr_ref, itr_ref_end;
+	Table *table=dynamic_cast<Table *>(object);
+
+	if(!object)
+		return;
+
+	objs.push_back(object);
+
+	if(table && inc_children)
+	{
+		ObjectType types[]={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_TRIGGER, OBJ_INDEX };
+		vector<TableObject *> *tab_obj_list=nullptr;
+		unsigned i, count=sizeof(types)/sizeof(ObjectType);
+
+		for(i=0; i < count; i++)
 		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			unsigned i, count;
-			Table *tab=nullptr;
-			Index *ind=nullptr;
-			Constraint *rest=nullptr;
+			tab_obj_list=table->getObjectList(types[i]);
+			objs.insert(objs.end(), tab_obj_list->begin(), tab_obj_list->end());
+		}
+	}
 
-			itr=tables.begin();
-			itr_end=tables.end();
+	//Removes the objects from the referrers list of the objects they reference
+	itr=objs.begin();
+	itr_end=objs.end();
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				tab=dynamic_cast<Table *>(*itr);
+	while(itr!=itr_end)
+	{
+		itr_refs=obj_referenced.find(*itr);
 
-				if(tab->getTablespace()==object)
-				{
-					refer=true;
-					refs.push_back(tab);
-				}
+		if(itr_refs!=obj_referenced.end())
+		{
+			itr_ref=itr_refs.value().begin();
+			itr_ref_end=itr_refs.value().end();
 
-				count=tab->getIndexCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					ind=tab->getIndex(i);
-					if(ind->getTablespace()==object)
-					{
-						refer=true;
-						refs.push_back(ind);
-					}
-				}
+			while(itr_ref!=itr_ref_end)
+			{
+				itr_referrers=obj_referrers.find(*itr_ref);
 
-				count=tab->getConstraintCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+				if(itr_referrers!=obj_referrers.end())
 				{
-					rest=tab->getConstraint(i);
-					if(rest->getTablespace()==object)
-					{
-						refer=true;
-						refs.push_back(rest);
-					}
+					itr_referrers.value().remove(*itr);
+
+					if(itr_referrers.value().isEmpty())
+						obj_referrers.erase(itr_referrers);
 				}
 
-				itr++;
+				itr_ref++;
 			}
 
-			if((!exclusion_mode || (exclusion_mode && !refer)) && this->BaseObject::getTablespace()==object)
-			{
-				refer=true;
-				refs.push_back(this);
-			}
+			obj_referenced.erase(itr_refs);
 		}
 
-		if(obj_type==OBJ_LANGUAGE && (!exclusion_mode || (exclusion_mode && !refer)))
-		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			Function *func=nullptr;
+		itr++;
+	}
 
-			itr=functions.begin();
-			itr_end=functions.end();
+	if(rem_referrers)
+	{
+		itr=objs.begin();
+		itr_end=objs.end();
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+		/* If some of the objects is still referenced by others (e.g. a column created by a relationship
+		and referenced by a foreign key of another table) the references can't be simply discarded
+		since the object can be reinserted later, so the index is entirely recreated on the next search */
+		while(itr!=itr_end && !invalid_refs_index)
+		{
+			if(obj_referrers.contains(*itr))
 			{
-				func=dynamic_cast<Function *>(*itr);
-				if(func->getLanguage()==object)
-				{
-					refer=true;
-					refs.push_back(func);
-				}
-				itr++;
+				invalid_refs_index=true;
+				obj_referrers.clear();
+				obj_referenced.clear();
 			}
+
+			itr++;
 		}
+	}
+}
 
-		if(obj_type==OBJ_OPERATOR && (!exclusion_mode || (exclusion_mode && !refer)))
+BaseObject *DatabaseModel::getUserTypeObject(PgSQLType type)
+{
+	void *ptype=type.getUserTypeReference();
+
+	if(!ptype)
+		return(nullptr);
+
+	/* The reference to the user type is stored as the pointer to the class that represents it
+	so it must be converted to that class before being used as a BaseObject */
+	switch(type.getUserTypeConfig())
+	{
+		case UserTypeConfig::BASE_TYPE: return(static_cast<Type *>(ptype));
+		case UserTypeConfig::DOMAIN_TYPE: return(static_cast<Domain *>(ptype));
+		case UserTypeConfig::TABLE_TYPE: return(static_cast<Table *>(ptype));
+		case UserTypeConfig::SEQUENCE_TYPE: return(static_cast<Sequence *>(ptype));
+		case UserTypeConfig::EXTENSION_TYPE: return(static_cast<Extension *>(ptype));
+		default: return(nullptr);
+	}
+}
+
+void DatabaseModel::getReferencedObjects(BaseObject *object, vector<BaseObject *> &objs)
+{
+	ObjectType obj_type;
+	vector<BaseObject *> aux_objs;
+	vector<BaseObject *>::iterator itr, itr_end;
+	unsigned i, i1, count;
+
+	objs.clear();
+
+	if(!object)
+		return;
+
+	obj_type=object->getObjectType();
+
+	if(obj_type==OBJ_FUNCTION || obj_type==OBJ_TABLE || obj_type==OBJ_VIEW ||
+		 obj_type==OBJ_DOMAIN || obj_type==OBJ_AGGREGATE || obj_type==OBJ_OPERATOR ||
+		 obj_type==OBJ_SEQUENCE || obj_type==OBJ_CONVERSION || obj_type==OBJ_TYPE ||
+		 obj_type==OBJ_OPFAMILY || obj_type==OBJ_OPCLASS)
+		aux_objs.push_back(object->getSchema());
+
+	if(obj_type==OBJ_FUNCTION || obj_type==OBJ_TABLE || obj_type==OBJ_DOMAIN ||
+		 obj_type==OBJ_AGGREGATE || obj_type==OBJ_SCHEMA || obj_type==OBJ_OPERATOR ||
+		 obj_type==OBJ_SEQUENCE || obj_type==OBJ_CONVERSION || obj_type==OBJ_LANGUAGE ||
+		 obj_type==OBJ_TABLESPACE || obj_type==OBJ_TYPE || obj_type==OBJ_OPFAMILY ||
+		 obj_type==OBJ_OPCLASS || obj_type==OBJ_DATABASE)
+		aux_objs.push_back(object->getOwner());
+
+	if(obj_type==OBJ_TABLE || obj_type==OBJ_INDEX ||
+		 obj_type==OBJ_CONSTRAINT || obj_type==OBJ_DATABASE)
+		aux_objs.push_back(object->getTablespace());
+
+	if(obj_type==OBJ_DOMAIN || obj_type==OBJ_COLLATION ||
+		 obj_type==OBJ_TYPE || obj_type==OBJ_COLUMN)
+		aux_objs.push_back(object->getCollation());
+
+	switch(obj_type)
+	{
+		case OBJ_PERMISSION:
+			aux_objs.push_back(dynamic_cast<Permission *>(object)->getObject());
+		break;
+
+		case OBJ_RELATIONSHIP:
+		case BASE_RELATIONSHIP:
 		{
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[3]={OBJ_OPCLASS,
-															 OBJ_AGGREGATE,
-															 OBJ_OPERATOR};
-			unsigned i, i1, count;
-			OperatorClass *op_class=nullptr;
-			Operator *oper_aux=nullptr, *oper=dynamic_cast<Operator *>(object);
+			BaseRelationship *base_rel=dynamic_cast<BaseRelationship *>(object);
+			Relationship *rel=dynamic_cast<Relationship *>(object);
+			Constraint *constr=nullptr;
+			BaseTable *tables[2]={ base_rel->getTable(BaseRelationship::SRC_TABLE),
+														 base_rel->getTable(BaseRelationship::DST_TABLE) };
+
+			//Only tables are considered referenced by relationships
+			for(i=0; i < 2; i++)
+			{
+				if(tables[i] && tables[i]->getObjectType()==OBJ_TABLE)
+					aux_objs.push_back(tables[i]);
+			}
 
-			for(i=0; i < 3 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+			if(rel)
 			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+				count=rel->getAttributeCount();
+				for(i=0; i < count; i++)
+					aux_objs.push_back(getUserTypeObject(rel->getAttribute(i)->getType()));
 
-				if(obj_types[i]==OBJ_OPCLASS)
+				count=rel->getConstraintCount();
+				for(i=0; i < count; i++)
 				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+					constr=rel->getConstraint(i);
+
+					if(constr->getConstraintType()==ConstraintType::primary_key ||
+						 constr->getConstraintType()==ConstraintType::unique ||
+						 constr->getConstraintType()==ConstraintType::foreign_key)
 					{
-						op_class=dynamic_cast<OperatorClass *>(*itr);
-						itr++;
+						for(i1=0; i1 < constr->getColumnCount(Constraint::SOURCE_COLS); i1++)
+							aux_objs.push_back(constr->getColumn(i1, Constraint::SOURCE_COLS));
 
-						count=op_class->getElementCount();
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(op_class->getElement(i1).getOperator()==oper)
-							{
-								refer=true;
-								refs.push_back(op_class);
-							}
-						}
+						for(i1=0; i1 < constr->getColumnCount(Constraint::REFERENCED_COLS); i1++)
+							aux_objs.push_back(constr->getColumn(i1, Constraint::REFERENCED_COLS));
 					}
-				}
-				else if(obj_types[i]==OBJ_AGGREGATE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+					else if(constr->getConstraintType()==ConstraintType::exclude)
 					{
-						if(dynamic_cast<Aggregate *>(*itr)->getSortOperator()==oper)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
+						for(i1=0; i1 < constr->getExcludeElementCount(); i1++)
+							aux_objs.push_back(constr->getExcludeElement(i1).getColumn());
 					}
 				}
-				else if(obj_types[i]==OBJ_OPERATOR)
-				{
-					while(itr!=itr_end && !refer)
-					{
-						oper_aux=dynamic_cast<Operator *>(*itr);
-						itr++;
+			}
+		}
+		break;
 
-						for(i1=Operator::OPER_COMMUTATOR; i1 <= Operator::OPER_NEGATOR &&
-								(!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(oper_aux->getOperator(i1)==oper)
-							{
-								refer=true;
-								refs.push_back(oper_aux);
-							}
-						}
-					}
-				}
+		case OBJ_SEQUENCE:
+		{
+			Column *col=dynamic_cast<Sequence *>(object)->getOwnerColumn();
+
+			if(col)
+			{
+				aux_objs.push_back(col);
+				aux_objs.push_back(col->getParentTable());
 			}
 		}
+		break;
 
-		if(obj_type==OBJ_OPFAMILY && (!exclusion_mode || (exclusion_mode && !refer)))
+		case OBJ_CONSTRAINT:
 		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			OperatorFamily *op_family=dynamic_cast<OperatorFamily *>(object);
+			Constraint *constr=dynamic_cast<Constraint *>(object);
 
-			itr=op_classes.begin();
-			itr_end=op_classes.end();
+			//If a constraint references its own parent table it'll not be considered a reference to the table
+			if(constr->getConstraintType()==ConstraintType::foreign_key &&
+				 constr->getParentTable()!=constr->getReferencedTable())
+				aux_objs.push_back(constr->getReferencedTable());
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			if(constr->getConstraintType()==ConstraintType::primary_key ||
+				 constr->getConstraintType()==ConstraintType::unique ||
+				 constr->getConstraintType()==ConstraintType::foreign_key)
 			{
-				if(dynamic_cast<OperatorClass *>(*itr)->getFamily()==op_family)
-				{
-					refer=true;
-					refs.push_back(*itr);
-				}
-				itr++;
+				for(i=0; i < constr->getColumnCount(Constraint::SOURCE_COLS); i++)
+					aux_objs.push_back(constr->getColumn(i, Constraint::SOURCE_COLS));
+
+				for(i=0; i < constr->getColumnCount(Constraint::REFERENCED_COLS); i++)
+					aux_objs.push_back(constr->getColumn(i, Constraint::REFERENCED_COLS));
+			}
+			else if(constr->getConstraintType()==ConstraintType::exclude)
+			{
+				for(i=0; i < constr->getExcludeElementCount(); i++)
+					aux_objs.push_back(constr->getExcludeElement(i).getColumn());
 			}
 		}
+		break;
 
-		if(obj_type==OBJ_COLLATION && (!exclusion_mode || (exclusion_mode && !refer)))
+		case OBJ_TRIGGER:
 		{
-			ObjectType  obj_types[]={ OBJ_DOMAIN, OBJ_COLLATION, OBJ_TYPE },
-									tab_obj_types[]={ OBJ_COLUMN, OBJ_INDEX };
-			unsigned i, count;
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			vector<TableObject *> *tab_obj_list=nullptr;
-			vector<TableObject *>::iterator tab_itr, tab_itr_end;
-			TableObject *tab_obj=nullptr;
+			Trigger *trig=dynamic_cast<Trigger *>(object);
 
-			count=sizeof(obj_types)/sizeof(ObjectType);
-			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+			aux_objs.push_back(trig->getReferencedTable());
+			aux_objs.push_back(trig->getFunction());
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((*itr)->getCollation()==object)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
+			count=trig->getColumnCount();
+			for(i=0; i < count; i++)
+				aux_objs.push_back(trig->getColumn(i));
+		}
+		break;
 
-					itr++;
-				}
+		case OBJ_INDEX:
+		{
+			vector<IndexElement> elems=dynamic_cast<Index *>(object)->getIndexElements();
+			vector<IndexElement>::iterator itr_elem=elems.begin();
+
+			while(itr_elem!=elems.end())
+			{
+				aux_objs.push_back((*itr_elem).getCollation());
+				itr_elem++;
 			}
+		}
+		break;
 
-			count=sizeof(tab_obj_types)/sizeof(ObjectType);
-			obj_list=getObjectList(OBJ_TABLE);
-			itr=obj_list->begin();
-			itr_end=obj_list->end();
+		case OBJ_COLUMN:
+		{
+			Column *col=dynamic_cast<Column *>(object);
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					tab_obj_list=dynamic_cast<Table *>(*itr)->getObjectList(tab_obj_types[i]);
-					tab_itr=tab_obj_list->begin();
-					tab_itr_end=tab_obj_list->end();
+			if(!col->isAddedByRelationship())
+				aux_objs.push_back(getUserTypeObject(col->getType()));
+		}
+		break;
 
-					while(tab_itr!=tab_itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						tab_obj=(*tab_itr);
-						if((tab_obj->getObjectType()==OBJ_COLUMN && tab_obj->getCollation()==object) ||
-							 (tab_obj->getObjectType()==OBJ_INDEX &&
-								dynamic_cast<Index *>(tab_obj)->isReferCollation(dynamic_cast<Collation *>(object))))
-						{
-							refer=true;
-							refs.push_back(*tab_itr);
-						}
-						tab_itr++;
-					}
-				}
-				itr++;
+		case OBJ_VIEW:
+		{
+			View *view=dynamic_cast<View *>(object);
+			Reference ref;
+
+			count=view->getReferenceCount();
+			for(i=0; i < count; i++)
+			{
+				ref=view->getReference(i);
+				aux_objs.push_back(ref.getTable());
+				aux_objs.push_back(ref.getColumn());
 			}
 		}
+		break;
 
-		if(obj_type==OBJ_COLUMN && (!exclusion_mode || (exclusion_mode && !refer)))
+		case OBJ_CAST:
 		{
-			Column *column=dynamic_cast<Column *>(object);
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType  obj_types[]={ OBJ_SEQUENCE, OBJ_VIEW, OBJ_TABLE, OBJ_RELATIONSHIP };
-			unsigned i, count=4;
+			Cast *cast=dynamic_cast<Cast *>(object);
 
-			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+			aux_objs.push_back(cast->getCastFunction());
+			aux_objs.push_back(getUserTypeObject(cast->getDataType(Cast::SRC_TYPE)));
+			aux_objs.push_back(getUserTypeObject(cast->getDataType(Cast::DST_TYPE)));
+		}
+		break;
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((obj_types[i]==OBJ_SEQUENCE && dynamic_cast<Sequence *>(*itr)->getOwnerColumn()==column) ||
-						 (obj_types[i]==OBJ_VIEW && dynamic_cast<View *>(*itr)->isReferencingColumn(column)))
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					else if(obj_types[i]==OBJ_TABLE)
-					{
-						Table *tab=dynamic_cast<Table *>(*itr);
-						unsigned trig_cnt, constr_cnt, idx, count1, i1;
-						Trigger *trig=nullptr;
+		case OBJ_CONVERSION:
+			aux_objs.push_back(dynamic_cast<Conversion *>(object)->getConversionFunction());
+		break;
 
-						constr_cnt=tab->getConstraintCount();
-						for(idx=0; idx < constr_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							if(tab->getConstraint(idx)->isColumnReferenced(column))
-							{
-								refer=true;
-								refs.push_back(tab->getConstraint(idx));
-							}
+		case OBJ_AGGREGATE:
+		{
+			Aggregate *aggreg=dynamic_cast<Aggregate *>(object);
 
-						}
+			aux_objs.push_back(aggreg->getFunction(Aggregate::FINAL_FUNC));
+			aux_objs.push_back(aggreg->getFunction(Aggregate::TRANSITION_FUNC));
+			aux_objs.push_back(aggreg->getSortOperator());
 
-						trig_cnt=tab->getTriggerCount();
-						for(idx=0; idx < trig_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							trig=tab->getTrigger(idx);
-							count1=trig->getColumnCount();
+			count=aggreg->getDataTypeCount();
+			for(i=0; i < count; i++)
+				aux_objs.push_back(getUserTypeObject(aggreg->getDataType(i)));
+		}
+		break;
 
-							for(i1=0; i1 < count1 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-							{
-								if(trig->getColumn(i1)==column)
-								{
-									refer=true;
-									refs.push_back(trig);
-								}
-							}
-						}
-					}
-					else if(obj_types[i]==OBJ_RELATIONSHIP)
-					{
-						Relationship *rel=dynamic_cast<Relationship *>(*itr);
-						unsigned constr_cnt, idx;
+		case OBJ_OPERATOR:
+		{
+			Operator *oper=dynamic_cast<Operator *>(object);
 
-						constr_cnt=rel->getConstraintCount();
-						for(idx=0; idx < constr_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							if(rel->getConstraint(idx)->isColumnReferenced(column))
-							{
-								refer=true;
-								refs.push_back(rel);
-							}
-						}
-					}
+			aux_objs.push_back(oper->getFunction(Operator::FUNC_OPERATOR));
+			aux_objs.push_back(oper->getFunction(Operator::FUNC_JOIN));
+			aux_objs.push_back(oper->getFunction(Operator::FUNC_RESTRICT));
+			aux_objs.push_back(getUserTypeObject(oper->getArgumentType(Operator::LEFT_ARG)));
+			aux_objs.push_back(getUserTypeObject(oper->getArgumentType(Operator::RIGHT_ARG)));
 
-					itr++;
-				}
+			for(i=Operator::OPER_COMMUTATOR; i <= Operator::OPER_NEGATOR; i++)
+				aux_objs.push_back(oper->getOperator(i));
+		}
+		break;
+
+		case OBJ_TYPE:
+		{
+			Type *type=dynamic_cast<Type *>(object);
+
+			for(i=Type::INPUT_FUNC; i <= Type::ANALYZE_FUNC; i++)
+				aux_objs.push_back(type->getFunction(i));
+
+			aux_objs.push_back(getUserTypeObject(type->getAlignment()));
+			aux_objs.push_back(getUserTypeObject(type->getElement()));
+			aux_objs.push_back(getUserTypeObject(type->getLikeType()));
+		}
+		break;
+
+		case OBJ_LANGUAGE:
+		{
+			Language *lang=dynamic_cast<Language *>(object);
+
+			aux_objs.push_back(lang->getFunction(Language::HANDLER_FUNC));
+			aux_objs.push_back(lang->getFunction(Language::VALIDATOR_FUNC));
+			aux_objs.push_back(lang->getFunction(Language::INLINE_FUNC));
+		}
+		break;
+
+		case OBJ_FUNCTION:
+		{
+			Function *func=dynamic_cast<Function *>(object);
+
+			aux_objs.push_back(func->getLanguage());
+			aux_objs.push_back(getUserTypeObject(func->getReturnType()));
+
+			count=func->getParameterCount();
+			for(i=0; i < count; i++)
+				aux_objs.push_back(getUserTypeObject(func->getParameter(i).getType()));
+		}
+		break;
+
+		case OBJ_DOMAIN:
+			aux_objs.push_back(getUserTypeObject(dynamic_cast<Domain *>(object)->getType()));
+		break;
+
+		case OBJ_OPCLASS:
+		{
+			OperatorClass *op_class=dynamic_cast<OperatorClass *>(object);
+
+			aux_objs.push_back(op_class->getFamily());
+			aux_objs.push_back(getUserTypeObject(op_class->getDataType()));
+
+			count=op_class->getElementCount();
+			for(i=0; i < count; i++)
+				aux_objs.push_back(op_class->getElement(i).getOperator());
+		}
+		break;
+
+		case OBJ_ROLE:
+		{
+			Role *role=dynamic_cast<Role *>(object);
+			unsigned role_types[3]={Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE};
+
+			for(i1=0; i1 < 3; i1++)
+			{
+				count=role->getRoleCount(role_types[i1]);
+				for(i=0; i < count; i++)
+					aux_objs.push_back(role->getRole(role_types[i1], i));
 			}
 		}
+		break;
+
+		default: break;
+	}
+
+	//Discards the null and the duplicated references
+	itr=aux_objs.begin();
+	itr_end=aux_objs.end();
+
+	while(itr!=itr_end)
+	{
+		if(*itr && std::find(objs.begin(), objs.end(), *itr)==objs.end())
+			objs.push_back(*itr);
+
+		itr++;
 	}
 }
 
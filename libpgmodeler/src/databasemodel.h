@@ -28,8 +28,10 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #define DATABASE_MODEL_H
 
 #include <QFile>
+#include <QBuffer>
 #include <QObject>
 #include <QStringList>
+#include <QSet>
 #include "baseobject.h"
 #include "table.h"
 #include "function.h"
@@ -51,8 +53,16 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "domain.h"
 #include "collation.h"
 #include "extension.h"
+#include "codegenerationtask.h"
+#include "sqlstatementhandler.h"
+#include "progressreporter.h"
+#include "profiler.h"
 #include <algorithm>
 #include <locale.h>
+#include <QThread>
+#include <QThreadPool>
+#include <QHash>
+#include <set>
 
 class DatabaseModel:  public QObject, public BaseObject {
 	private:
@@ -108,6 +118,82 @@ class DatabaseModel:  public QObject, public BaseObject {
 		When this flag is set it's recommend to revalidate the model using the Model validation tool */
 		invalidated;
 
+		/*! \brief Index of objects by type used to speed up the search by name. Each key is the formatted name
+		 (or the signature for functions and operators) and the value is the position of the object on its list */
+		map<ObjectType, QHash<QString, int> > obj_indexes;
+
+		//! \brief Stores the key used by each object on the index (used to update the index when objects are renamed)
+		QHash<BaseObject *, QString> obj_index_keys;
+
+		/*! \brief Keys of the index shared by more than one object of the same type. The index stores only the
+		 first object of a duplicated key, so renaming that object invalidates the index instead of removing the key */
+		map<ObjectType, QSet<QString> > dup_index_keys;
+
+		/*! \brief Stores the object types which index must be recreated on the next search. An index is invalidated
+		 when the objects positions change (insertion in the middle of the list or removal) or the names of several
+		 objects change at once (e.g. renaming a schema changes the formatted names of all objects in it) */
+		map<ObjectType, bool> invalid_indexes;
+
+		/*! \brief Reverse references index: maps each object to the objects that reference it (see getObjectReferences()).
+		 The index is created on the first search and then kept updated as the objects are added, removed or modified */
+		QHash<BaseObject *, QSet<BaseObject *> > obj_referrers;
+
+		//! \brief Stores the objects referenced by each object registered on the references index
+		QHash<BaseObject *, vector<BaseObject *> > obj_referenced;
+
+		//! \brief Indicates that the references index must be recreated on the next search
+		bool invalid_refs_index;
+
+		/*! \brief Number of threads used to generate the code of the entire model (see getCodeDefinition()).
+		 Values lower than 2 make the code be generated only by the calling thread */
+		unsigned code_gen_threads;
+
+		/*! \brief Number of threads used to parse the model file (see loadModel()). Values lower than 2 make
+		 the file be parsed only by the calling thread */
+		unsigned load_threads;
+
+		//! \brief Returns the key used to store the object on the index of objects (formatted name or signature)
+		QString getObjectIndexKey(BaseObject *object);
+
+		//! \brief Recreates the index of objects of the specified type
+		void createObjectIndex(ObjectType obj_type);
+
+		//! \brief Marks the index of the specified type as invalid (forcing its recreation on the next search)
+		void invalidateObjectIndex(ObjectType obj_type);
+
+		/*! \brief Returns the object (type, domain, table, sequence or extension) that represents the user defined type.
+		 Built-in types and types that represents views return nullptr */
+		static BaseObject *getUserTypeObject(PgSQLType type);
+
+		/*! \brief Stores on 'objs' the objects directly referenced by the passed one. Only the kinds of reference
+		 reported by getObjectReferences() are considered */
+		void getReferencedObjects(BaseObject *object, vector<BaseObject *> &objs);
+
+		//! \brief Registers the object on the references index (including the children objects when it is a table)
+		void addObjectReferences(BaseObject *object, bool inc_children);
+
+		/*! \brief Removes the references done by the object from the references index (including the children objects
+		 when it is a table). When 'rem_referrers' is true the object is removed as a referenced object as well, and in case
+		 it is still referenced by others the whole index is invalidated */
+		void removeObjectReferences(BaseObject *object, bool inc_children, bool rem_referrers);
+
+		//! \brief Recreates the entire references index
+		void createReferencesIndex(void);
+
+		#ifndef QT_NO_DEBUG
+			/*! \brief Searches the objects that reference the passed one scanning all the model's objects (the search
+			 used before the references index was created). Debug builds use it to check the index (see checkObjectReferences()) */
+			void scanObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode);
+
+			/*! \brief Compares the references returned by the index with the ones found by scanObjectReferences(),
+			 replacing them by the scanned ones when they differ (a warning is emitted in this case) */
+			void checkObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode);
+		#endif
+
+		/*! \brief Stores on 'deps' the objects which the passed one directly depends on (see getObjectDependecies()).
+		 The list may contain null and repeated objects */
+		void getDirectDependencies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps);
+
 		/*! \brief Returns an object seaching it by its name and type. The third parameter stores
 		 the object index */
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
@@ -121,6 +207,12 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Recreates the special object from the passed xml code buffer
 		void createSpecialObject(const QString &xml_def, unsigned obj_id=0);
 
+		/*! \brief Returns the relationships that must be disconnected and connected again due to the passed
+		 invalidated relationships: the invalidated ones and the ones that propagate columns from the tables
+		 (directly or indirectly) affected by them. The returned list is in topological order, this means that
+		 a relationship is placed after the relationships that add columns to its reference tables */
+		vector<BaseObject *> getRelationshipsToRevalidate(vector<BaseObject *> &inv_rels);
+
 		//! \brief Removes an user defined type (domain or type)
 		void removeUserType(BaseObject *object, int obj_idx);
 
@@ -131,6 +223,31 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Creates a IndexElement or ExcludeElement from XML depending on type of the 'elem' param.
 		void createElement(Element &elem, TableObject *tab_obj, BaseObject *parent_obj);
 
+		/*! \brief Returns the code definition of an object as it must appear on the code of the entire model.
+		 This method is used by getCodeDefinition() and by the code generation tasks and does not treats the
+		 database model itself */
+		QString getObjectCodeDefinition(BaseObject *object, unsigned def_type);
+
+		/*! \brief Writes a piece of the model's code on the output device. For XML definition the chars are converted
+		 to XML entities line by line so incomplete lines are stored on 'pending_code' until the next call or
+		 until 'flush' is true. The 'in_comment' flag keeps the comment state of the conversion between calls */
+		void writeCode(QIODevice &output, const QString &code, unsigned def_type, QString &pending_code, bool &in_comment, bool flush=false);
+
+		/*! \brief Generates, using a thread pool, the code for all objects in the list that can be generated
+		 independently, storing the code at the same position of the 'definitions' vector. The 'generated' vector
+		 indicates the positions that were treated. The first error (in the list order) raised by the tasks is rethrown */
+		void generateCodeInParallel(vector<BaseObject *> &objects, vector<QString> &definitions,
+																vector<bool> &generated, unsigned def_type);
+
+		/*! \brief Stores on 'objects' the model's objects in the order their code must be generated. The list
+		 contains the database model itself and, for SQL definition, the special objects at the end */
+		void getCodeGenerationOrder(unsigned def_type, vector<BaseObject *> &objects);
+
+		/*! \brief Splits the SQL code of the object in statements and sends them to the handler. The dependency
+		 level of the statements is calculated from the levels of the objects already sent (stored on 'levels') */
+		void sendSQLStatements(BaseObject *object, const QString &code, QHash<BaseObject *, unsigned> &levels,
+													 SQLStatementHandler &handler);
+
 	protected:
 		//! \brief Indicate if the model invalidated
 		void setInvalidated(bool value);
@@ -149,12 +266,19 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 by relationship) in order to be reconstructed in a posterior moment */
 		void storeSpecialObjectsXML(void);
 
-		//! \brief Validates all the relationship, propagating all column modifications over the tables
+		/*! \brief Validates the relationships, propagating all column modifications over the tables. Only the
+		 invalidated relationships and the ones that depends on them (see getRelationshipsToRevalidate()) are
+		 disconnected and connected again */
 		void validateRelationships(void);
 
 		//! \brief Returns the list of objects that belongs to the passed schema
 		vector<BaseObject *> getObjects(ObjectType obj_type, BaseObject *schema=nullptr);
 
+		/*! \brief Updates the object's key on the index of objects. This method is called automatically when the name,
+		 schema or signature of objects owned by the model changes and must be called when these attributes are
+		 changed by other ways (e.g. copy assignment) */
+		void updateObjectIndex(BaseObject *object);
+
 		//! \brief Returns the object index searching by its name
 		int getObjectIndex(const QString &name, ObjectType obj_type);
 
@@ -191,6 +315,14 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Sets the model's author
 		void setAuthor(const QString &author);
 
+		/*! \brief Sets the number of threads used to generate the code of the entire model. Zero means the ideal
+		 thread count for the running machine. The generated code is the same regardless the amount of threads */
+		void setCodeGenerationThreads(unsigned thread_cnt);
+
+		/*! \brief Sets the number of threads used to parse and validate the objects of a model file. Zero means the
+		 ideal thread count for the running machine. The objects are always created in the order they appear on the file */
+		void setLoadingThreads(unsigned thread_cnt);
+
 		//! \brief Sets the protection for all objects on the model
 		void setProtected(bool value);
 
@@ -215,6 +347,12 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the model's author
 		QString getAuthor(void);
 
+		//! \brief Returns the number of threads used to generate the code of the entire model
+		unsigned getCodeGenerationThreads(void);
+
+		//! \brief Returns the number of threads used to parse the model file
+		unsigned getLoadingThreads(void);
+
 		//! \brief Returns the database enconding
 		EncodingType getEncoding(void);
 
@@ -224,6 +362,11 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Saves the specified code definition for the model on the specified filename
 		void saveModel(const QString &filename, unsigned def_type);
 
+		/*! \brief Writes the complete SQL/XML definition for the entire model on the output device (which must be opened
+		 for writing). Each object's code is written as soon as it's generated so the memory used does not depend on the
+		 model's size. The parameter 'export_file' has the same meaning as in getCodeDefinition(unsigned, bool) */
+		void writeCodeDefinition(QIODevice &output, unsigned def_type, bool export_file);
+
 		/*! \brief Returns the complete SQL/XML defintion for the entire model (including all the other objects).
 		 The parameter 'export_file' is used to format the generated code in a way that can be saved
 		 in na SQL file and executed later on the DBMS server. This parameter is only used for SQL definition. */
@@ -235,6 +378,11 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the code definition only for the database (excluding the definition of the other objects)
 		QString __getCodeDefinition(unsigned def_type);
 
+		/*! \brief Generates the SQL code of the model (as done by getCodeDefinition(SQL_DEFINITION, false)) sending
+		 each statement to the handler as soon as it is generated, so the code doesn't need to be reparsed nor stored
+		 entirely in memory. The statements are sent in the same order they appear on the model's code */
+		void generateSQLStatements(SQLStatementHandler &handler);
+
 		void addRelationship(BaseRelationship *rel, int obj_idx=-1);
 		void removeRelationship(BaseRelationship *rel, int obj_idx=-1);
 		BaseRelationship *getRelationship(unsigned obj_idx, ObjectType rel_type);
@@ -387,16 +535,37 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 propagation over the tables. This method raises an error when found some. */
 		void checkRelationshipRedundancy(Relationship *rel);
 
-		/*! \brief Returns all the objects that the object depends on. The boolean paramenter is used to include the
-		 indirect dependencies on the search. Indirect dependencies are objects that is not linked directly to
-		 the informed object, e.g., a schema linked to a table that is referenced in a view */
-		void getObjectDependecies(BaseObject *objeto, vector<BaseObject *> &vet_deps, bool inc_indirect_deps=false);
+		/*! \brief Returns all the objects that the object depends on (including the object itself). The boolean paramenter
+		 is used to include the indirect dependencies on the search. Indirect dependencies are objects that is not linked directly
+		 to the informed object, e.g., a schema linked to a table that is referenced in a view. The search can be limited
+		 to a maximum depth (max_depth < 0 means no limit and the direct dependencies are at depth 1) and the objects stored
+		 on the list can be filtered by type (an empty 'types' list means all types). Objects already present on 'deps' are
+		 not searched again */
+		void getObjectDependecies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps=false,
+															int max_depth=-1, const vector<ObjectType> &types=vector<ObjectType>());
+
+		/*! \brief Returns all the objects that the informed objects depend on. This is the same as calling the method
+		 above for each object but the visited objects are shared between the searches */
+		void getObjectDependecies(const vector<BaseObject *> &objects, vector<BaseObject *> &deps, bool inc_indirect_deps=false,
+															int max_depth=-1, const vector<ObjectType> &types=vector<ObjectType>());
 
 		/*! \brief Returns all the objects that references the passed object. The boolean paramenter is used to performance purpose,
 		 generally applied when excluding objects, this means that the method will stop the search when the first
-		 reference is found */
+		 reference is found. The references are returned in the creation order of the referrer objects (object id),
+		 so in exclusion mode the oldest referrer is the one returned. Debug builds check the result against a full
+		 scan of the model (see checkObjectReferences()) */
 		void getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode=false);
 
+		/*! \brief Updates the references index with the objects currently referenced by the passed one. This method is
+		 called automatically when objects are added to or removed from the model (or tables) and when their schema, owner,
+		 tablespace or collation changes, and must be called when other references are changed outside the model
+		 (e.g. through the editing forms). Objects (or table objects) not owned by the model are removed from the index */
+		void updateObjectReferences(BaseObject *object);
+
+		/*! \brief Creates the references index when it is invalid. After that, and while the model is not modified,
+		 getObjectReferences() only reads the model so it can be called by several threads at the same time */
+		void updateReferencesIndex(void);
+
 		//! \brief Marks all the graphical objects as modified forcing their redraw
 		void setObjectsModified(void);
 
@@ -422,6 +591,7 @@ class DatabaseModel:  public QObject, public BaseObject {
 		void s_objectLoaded(int progress, QString object_id, unsigned icon_id);
 
 	friend class ModelValidationHelper;
+	friend class CodeGenerationTask;
 };
 
 #endif
@@ -22,11 +22,9 @@ Domain::Domain(void)
 {
 	obj_type=OBJ_DOMAIN;
 	not_null=false;
-	attributes[ParsersAttributes::DEFAULT_VALUE]="";
-	attributes[ParsersAttributes::NOT_nullptr]="";
-	attributes[ParsersAttributes::EXPRESSION]="";
-	attributes[ParsersAttributes::TYPE]="";
-	attributes[ParsersAttributes::CONSTRAINT]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_DEFAULT_VALUE, ParsersAttributes::ID_NOT_nullptr, ParsersAttributes::ID_EXPRESSION,
+			ParsersAttributes::ID_TYPE, ParsersAttributes::ID_CONSTRAINT };
+	declareAttributes(class_attribs);
 }
 
 Domain::~Domain(void)
@@ -113,16 +111,16 @@ PgSQLType Domain::getType(void)
 
 QString Domain::getCodeDefinition(unsigned def_type)
 {
-	attributes[ParsersAttributes::NOT_nullptr]=(not_null ? "1" : "");
-	attributes[ParsersAttributes::DEFAULT_VALUE]=default_value;
-	attributes[ParsersAttributes::EXPRESSION]=expression;
-	attributes[ParsersAttributes::CONSTRAINT]=BaseObject::formatName(constraint_name);
+	attributes[ParsersAttributes::ID_NOT_nullptr]=(not_null ? "1" : "");
+	attributes[ParsersAttributes::ID_DEFAULT_VALUE]=default_value;
+	attributes[ParsersAttributes::ID_EXPRESSION]=expression;
+	attributes[ParsersAttributes::ID_CONSTRAINT]=BaseObject::formatName(constraint_name);
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
-		attributes[ParsersAttributes::TYPE]=(*type);
+		attributes[ParsersAttributes::ID_TYPE]=(*type);
 	else
 	{
-		attributes[ParsersAttributes::TYPE]=type.getCodeDefinition(def_type);
+		attributes[ParsersAttributes::ID_TYPE]=type.getCodeDefinition(def_type);
 	}
 
 	return(BaseObject::__getCodeDefinition(def_type));
@@ -91,27 +91,27 @@ OperatorClass *Element::getOperatorClass(void)
 	return(operator_class);
 }
 
-void Element::configureAttributes(map<QString, QString> &attributes, unsigned def_type)
+void Element::configureAttributes(AttributesMap &attributes, unsigned def_type)
 {
-	attributes[ParsersAttributes::COLUMN]="";
-	attributes[ParsersAttributes::EXPRESSION]="";
-	attributes[ParsersAttributes::OP_CLASS]="";
-	attributes[ParsersAttributes::USE_SORTING]=(this->sorting_enabled ? "1" : "");
-	attributes[ParsersAttributes::nullptrS_FIRST]=(this->sorting_enabled && this->sorting_attibs[nullptrS_FIRST] ? "1" : "");
-	attributes[ParsersAttributes::ASC_ORDER]=(this->sorting_enabled && this->sorting_attibs[ASC_ORDER] ? "1" : "");
+	attributes[ParsersAttributes::ID_COLUMN]="";
+	attributes[ParsersAttributes::ID_EXPRESSION]="";
+	attributes[ParsersAttributes::ID_OP_CLASS]="";
+	attributes[ParsersAttributes::ID_USE_SORTING]=(this->sorting_enabled ? "1" : "");
+	attributes[ParsersAttributes::ID_nullptrS_FIRST]=(this->sorting_enabled && this->sorting_attibs[nullptrS_FIRST] ? "1" : "");
+	attributes[ParsersAttributes::ID_ASC_ORDER]=(this->sorting_enabled && this->sorting_attibs[ASC_ORDER] ? "1" : "");
 
 
 	if(column)
-		attributes[ParsersAttributes::COLUMN]=column->getName(true);
+		attributes[ParsersAttributes::ID_COLUMN]=column->getName(true);
 	else
-		attributes[ParsersAttributes::EXPRESSION]=expression;
+		attributes[ParsersAttributes::ID_EXPRESSION]=expression;
 
 	if(operator_class)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::OP_CLASS]=operator_class->getName(true);
+			attributes[ParsersAttributes::ID_OP_CLASS]=operator_class->getName(true);
 		else
-			attributes[ParsersAttributes::OP_CLASS]=operator_class->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::ID_OP_CLASS]=operator_class->getCodeDefinition(def_type, true);
 	}
 }
 
@@ -17,18 +17,18 @@ Operator *ExcludeElement::getOperator(void)
 
 QString ExcludeElement::getCodeDefinition(unsigned def_type)
 {
-	map<QString, QString> attributes;
+	AttributesMap attributes;
 
-	attributes[ParsersAttributes::OPERATOR]="";
+	attributes[ParsersAttributes::ID_OPERATOR]="";
 
 	configureAttributes(attributes, def_type);
 
 	if(_operator)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::OPERATOR]=_operator->getName(true);
+			attributes[ParsersAttributes::ID_OPERATOR]=_operator->getName(true);
 		else
-			attributes[ParsersAttributes::OPERATOR]=_operator->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::ID_OPERATOR]=_operator->getCodeDefinition(def_type, true);
 	}
 
 	return(SchemaParser::getCodeDefinition(ParsersAttributes::EXCLUDE_ELEMENT, attributes, def_type));
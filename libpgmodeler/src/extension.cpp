@@ -4,9 +4,8 @@ Extension::Extension(void)
 {
 	obj_type=OBJ_EXTENSION;
 	handles_type=false;
-	attributes[ParsersAttributes::HANDLES_TYPE]="";
-	attributes[ParsersAttributes::CUR_VERSION]="";
-	attributes[ParsersAttributes::OLD_VERSION]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_HANDLES_TYPE, ParsersAttributes::ID_CUR_VERSION, ParsersAttributes::ID_OLD_VERSION };
+	declareAttributes(class_attribs);
 }
 
 Extension::~Extension(void)
@@ -84,12 +83,12 @@ QString Extension::getVersion(unsigned ver)
 
 QString Extension::getCodeDefinition(unsigned def_type)
 {
-	attributes[ParsersAttributes::NAME]=this->getName(true, false);
-	attributes[ParsersAttributes::HANDLES_TYPE]=(handles_type ? "1" : "");
-	attributes[ParsersAttributes::CUR_VERSION]=versions[CUR_VERSION];
-	attributes[ParsersAttributes::OLD_VERSION]=versions[OLD_VERSION];
+	attributes[ParsersAttributes::ID_NAME]=this->getName(true, false);
+	attributes[ParsersAttributes::ID_HANDLES_TYPE]=(handles_type ? "1" : "");
+	attributes[ParsersAttributes::ID_CUR_VERSION]=versions[CUR_VERSION];
+	attributes[ParsersAttributes::ID_OLD_VERSION]=versions[OLD_VERSION];
 
-	attributes[ParsersAttributes::NAME]=this->getName();
+	attributes[ParsersAttributes::ID_NAME]=this->getName();
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
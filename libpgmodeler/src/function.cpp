@@ -29,22 +29,13 @@ Function::Function(void)
 	execution_cost=100;
 	row_amount=1000;
 
-	attributes[ParsersAttributes::PARAMETERS]="";
-	attributes[ParsersAttributes::EXECUTION_COST]="";
-	attributes[ParsersAttributes::ROW_AMOUNT]="";
-	attributes[ParsersAttributes::RETURN_TYPE]="";
-	attributes[ParsersAttributes::FUNCTION_TYPE]="";
-	attributes[ParsersAttributes::LANGUAGE]="";
-	attributes[ParsersAttributes::RETURNS_SETOF]="";
-	attributes[ParsersAttributes::SECURITY_TYPE]="";
-	attributes[ParsersAttributes::BEHAVIOR_TYPE]="";
-	attributes[ParsersAttributes::DEFINITION]="";
-	attributes[ParsersAttributes::SIGNATURE]="";
-	attributes[ParsersAttributes::REF_TYPE]="";
-	attributes[ParsersAttributes::WINDOW_FUNC]="";
-	attributes[ParsersAttributes::RETURN_TABLE]="";
-	attributes[ParsersAttributes::LIBRARY]="";
-	attributes[ParsersAttributes::SYMBOL]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_PARAMETERS, ParsersAttributes::ID_EXECUTION_COST, ParsersAttributes::ID_ROW_AMOUNT,
+			ParsersAttributes::ID_RETURN_TYPE, ParsersAttributes::ID_FUNCTION_TYPE, ParsersAttributes::ID_LANGUAGE,
+			ParsersAttributes::ID_RETURNS_SETOF, ParsersAttributes::ID_SECURITY_TYPE, ParsersAttributes::ID_BEHAVIOR_TYPE,
+			ParsersAttributes::ID_DEFINITION, ParsersAttributes::ID_SIGNATURE, ParsersAttributes::ID_REF_TYPE,
+			ParsersAttributes::ID_WINDOW_FUNC, ParsersAttributes::ID_RETURN_TABLE, ParsersAttributes::ID_LIBRARY,
+			ParsersAttributes::ID_SYMBOL };
+	declareAttributes(class_attribs);
 }
 
 void Function::setName(const QString &name)
@@ -137,7 +128,7 @@ void Function::setParametersAttribute(unsigned def_type)
 	if(def_type==SchemaParser::SQL_DEFINITION)
 		str_param.remove(str_param.size()-2,2);
 
-	attributes[ParsersAttributes::PARAMETERS]=str_param;
+	attributes[ParsersAttributes::ID_PARAMETERS]=str_param;
 }
 
 void Function::setTableReturnTypeAttribute(unsigned def_type)
@@ -154,7 +145,7 @@ void Function::setTableReturnTypeAttribute(unsigned def_type)
 	if(def_type==SchemaParser::SQL_DEFINITION)
 		str_type.remove(str_type.size()-2,2);
 
-	attributes[ParsersAttributes::RETURN_TABLE]=str_type;
+	attributes[ParsersAttributes::ID_RETURN_TABLE]=str_type;
 }
 
 void Function::setExecutionCost(unsigned exec_cost)
@@ -406,6 +397,7 @@ void Function::createSignature(bool format)
 
 	//Signature format NAME(IN|OUT PARAM1_TYPE,IN|OUT PARAM2_TYPE,...,IN|OUT PARAMn_TYPE)
 	signature=this->getName(format) + QString("(") + str_param + QString(")");
+	updateDatabaseIndex();
 }
 
 QString Function::getCodeDefinition(unsigned def_type)
@@ -415,38 +407,40 @@ QString Function::getCodeDefinition(unsigned def_type)
 
 QString Function::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
+	QMutexLocker locker(&code_gen_mutex);
+
 	setParametersAttribute(def_type);
 
-	attributes[ParsersAttributes::EXECUTION_COST]=QString("%1").arg(execution_cost);
-	attributes[ParsersAttributes::ROW_AMOUNT]=QString("%1").arg(row_amount);
-	attributes[ParsersAttributes::FUNCTION_TYPE]=(~function_type);
+	attributes[ParsersAttributes::ID_EXECUTION_COST]=QString("%1").arg(execution_cost);
+	attributes[ParsersAttributes::ID_ROW_AMOUNT]=QString("%1").arg(row_amount);
+	attributes[ParsersAttributes::ID_FUNCTION_TYPE]=(~function_type);
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
 	{
-		attributes[ParsersAttributes::LANGUAGE]=language->getName(false);
-		attributes[ParsersAttributes::RETURN_TYPE]=(*return_type);
+		attributes[ParsersAttributes::ID_LANGUAGE]=language->getName(false);
+		attributes[ParsersAttributes::ID_RETURN_TYPE]=(*return_type);
 	}
 	else
 	{
-		attributes[ParsersAttributes::LANGUAGE]=language->getCodeDefinition(def_type,true);
-		attributes[ParsersAttributes::RETURN_TYPE]=return_type.getCodeDefinition(def_type);
+		attributes[ParsersAttributes::ID_LANGUAGE]=language->getCodeDefinition(def_type,true);
+		attributes[ParsersAttributes::ID_RETURN_TYPE]=return_type.getCodeDefinition(def_type);
 	}
 
 	setTableReturnTypeAttribute(def_type);
 
-	attributes[ParsersAttributes::RETURNS_SETOF]=(returns_setof ? "1" : "");
-	attributes[ParsersAttributes::WINDOW_FUNC]=(is_wnd_function ? "1" : "");
-	attributes[ParsersAttributes::SECURITY_TYPE]=(~security_type);
-	attributes[ParsersAttributes::BEHAVIOR_TYPE]=(~behavior_type);
-	attributes[ParsersAttributes::DEFINITION]=source_code;
+	attributes[ParsersAttributes::ID_RETURNS_SETOF]=(returns_setof ? "1" : "");
+	attributes[ParsersAttributes::ID_WINDOW_FUNC]=(is_wnd_function ? "1" : "");
+	attributes[ParsersAttributes::ID_SECURITY_TYPE]=(~security_type);
+	attributes[ParsersAttributes::ID_BEHAVIOR_TYPE]=(~behavior_type);
+	attributes[ParsersAttributes::ID_DEFINITION]=source_code;
 
 	if(language->getName()==~LanguageType(LanguageType::c))
 	{
-		attributes[ParsersAttributes::SYMBOL]=symbol;
-		attributes[ParsersAttributes::LIBRARY]=library;
+		attributes[ParsersAttributes::ID_SYMBOL]=symbol;
+		attributes[ParsersAttributes::ID_LIBRARY]=library;
 	}
 
-	attributes[ParsersAttributes::SIGNATURE]=signature;
+	attributes[ParsersAttributes::ID_SIGNATURE]=signature;
 	return(BaseObject::getCodeDefinition(def_type, reduced_form));
 }
 
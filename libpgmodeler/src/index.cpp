@@ -24,21 +24,12 @@ Index::Index(void)
 	index_attribs[CONCURRENT]=false;
 	obj_type=OBJ_INDEX;
 	fill_factor=90;
-	attributes[ParsersAttributes::UNIQUE]="";
-	attributes[ParsersAttributes::CONCURRENT]="";
-	attributes[ParsersAttributes::TABLE]="";
-	attributes[ParsersAttributes::INDEX_TYPE]="";
-	attributes[ParsersAttributes::COLUMNS]="";
-	attributes[ParsersAttributes::EXPRESSION]="";
-	attributes[ParsersAttributes::FACTOR]="";
-	attributes[ParsersAttributes::CONDITION]="";
-	attributes[ParsersAttributes::OP_CLASS]="";
-	attributes[ParsersAttributes::nullptrS_FIRST]="";
-	attributes[ParsersAttributes::ASC_ORDER]="";
-	attributes[ParsersAttributes::DECL_IN_TABLE]="";
-	attributes[ParsersAttributes::ELEMENTS]="";
-	attributes[ParsersAttributes::FAST_UPDATE]="";
-	attributes[ParsersAttributes::STORAGE_PARAMS]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_UNIQUE, ParsersAttributes::ID_CONCURRENT, ParsersAttributes::ID_TABLE,
+			ParsersAttributes::ID_INDEX_TYPE, ParsersAttributes::ID_COLUMNS, ParsersAttributes::ID_EXPRESSION,
+			ParsersAttributes::ID_FACTOR, ParsersAttributes::ID_CONDITION, ParsersAttributes::ID_OP_CLASS,
+			ParsersAttributes::ID_nullptrS_FIRST, ParsersAttributes::ID_ASC_ORDER, ParsersAttributes::ID_DECL_IN_TABLE,
+			ParsersAttributes::ID_ELEMENTS, ParsersAttributes::ID_FAST_UPDATE, ParsersAttributes::ID_STORAGE_PARAMS };
+	declareAttributes(class_attribs);
 }
 
 void Index::setIndexElementsAttribute(unsigned def_type)
@@ -53,7 +44,7 @@ void Index::setIndexElementsAttribute(unsigned def_type)
 		if(i < (count-1) && def_type==SchemaParser::SQL_DEFINITION) str_elem+=",";
 	}
 
-	attributes[ParsersAttributes::ELEMENTS]=str_elem;
+	attributes[ParsersAttributes::ID_ELEMENTS]=str_elem;
 }
 
 int Index::getElementIndex(IndexElement elem)
@@ -276,30 +267,30 @@ bool Index::isReferCollation(Collation *collation)
 QString Index::getCodeDefinition(unsigned tipo_def)
 {
 	setIndexElementsAttribute(tipo_def);
-	attributes[ParsersAttributes::UNIQUE]=(index_attribs[UNIQUE] ? "1" : "");
-	attributes[ParsersAttributes::CONCURRENT]=(index_attribs[CONCURRENT] ? "1" : "");
-	attributes[ParsersAttributes::INDEX_TYPE]=(~indexing_type);
-	attributes[ParsersAttributes::CONDITION]=conditional_expr;
-	attributes[ParsersAttributes::STORAGE_PARAMS]="";
+	attributes[ParsersAttributes::ID_UNIQUE]=(index_attribs[UNIQUE] ? "1" : "");
+	attributes[ParsersAttributes::ID_CONCURRENT]=(index_attribs[CONCURRENT] ? "1" : "");
+	attributes[ParsersAttributes::ID_INDEX_TYPE]=(~indexing_type);
+	attributes[ParsersAttributes::ID_CONDITION]=conditional_expr;
+	attributes[ParsersAttributes::ID_STORAGE_PARAMS]="";
 
 	if(this->parent_table)
-		attributes[ParsersAttributes::TABLE]=this->parent_table->getName(true);
+		attributes[ParsersAttributes::ID_TABLE]=this->parent_table->getName(true);
 
 	if(this->indexing_type==IndexingType::gin)
-		attributes[ParsersAttributes::STORAGE_PARAMS]=attributes[ParsersAttributes::FAST_UPDATE]=(index_attribs[FAST_UPDATE] ? "1" : "");
+		attributes[ParsersAttributes::ID_STORAGE_PARAMS]=attributes[ParsersAttributes::ID_FAST_UPDATE]=(index_attribs[FAST_UPDATE] ? "1" : "");
 
 	if(this->indexing_type==IndexingType::btree && fill_factor >= 10)
 	{
-		attributes[ParsersAttributes::FACTOR]=QString("%1").arg(fill_factor);
-		attributes[ParsersAttributes::STORAGE_PARAMS]="1";
+		attributes[ParsersAttributes::ID_FACTOR]=QString("%1").arg(fill_factor);
+		attributes[ParsersAttributes::ID_STORAGE_PARAMS]="1";
 	}
 	else if(tipo_def==SchemaParser::XML_DEFINITION)
-		attributes[ParsersAttributes::FACTOR]="0";
+		attributes[ParsersAttributes::ID_FACTOR]="0";
 
 	/* Case the index doesn't referece some column added by relationship it will be declared
 		inside the parent table construction by the use of 'decl-in-table' schema attribute */
 	if(!isReferRelationshipAddedColumn())
-		attributes[ParsersAttributes::DECL_IN_TABLE]="1";
+		attributes[ParsersAttributes::ID_DECL_IN_TABLE]="1";
 
 	return(BaseObject::__getCodeDefinition(tipo_def));
 }
@@ -35,18 +35,18 @@ Collation *IndexElement::getCollation(void)
 
 QString IndexElement::getCodeDefinition(unsigned def_type)
 {
-	map<QString, QString> attributes;
+	AttributesMap attributes;
 
-	attributes[ParsersAttributes::COLLATION]="";
+	attributes[ParsersAttributes::ID_COLLATION]="";
 
 	configureAttributes(attributes, def_type);
 
 	if(collation)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::COLLATION]=collation->getName(true);
+			attributes[ParsersAttributes::ID_COLLATION]=collation->getName(true);
 		else
-			attributes[ParsersAttributes::COLLATION]=collation->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::ID_COLLATION]=collation->getCodeDefinition(def_type, true);
 	}
 
 	return(SchemaParser::getCodeDefinition(ParsersAttributes::INDEX_ELEMENT,attributes, def_type));
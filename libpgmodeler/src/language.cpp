@@ -26,10 +26,9 @@ Language::Language(void)
 	for(unsigned i=VALIDATOR_FUNC; i <= INLINE_FUNC; i++)
 		functions[i]=nullptr;
 
-	attributes[ParsersAttributes::TRUSTED]="";
-	attributes[ParsersAttributes::HANDLER_FUNC]="";
-	attributes[ParsersAttributes::VALIDATOR_FUNC]="";
-	attributes[ParsersAttributes::INLINE_FUNC]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_TRUSTED, ParsersAttributes::ID_HANDLER_FUNC, ParsersAttributes::ID_VALIDATOR_FUNC,
+			ParsersAttributes::ID_INLINE_FUNC };
+	declareAttributes(class_attribs);
 }
 
 void Language::setName(const QString &name)
@@ -110,12 +109,14 @@ QString Language::getCodeDefinition(unsigned def_type)
 
 QString Language::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
+	QMutexLocker locker(&code_gen_mutex);
+
 	unsigned i;
 	QString attribs_func[3]={ParsersAttributes::VALIDATOR_FUNC,
 													 ParsersAttributes::HANDLER_FUNC,
 													 ParsersAttributes::INLINE_FUNC};
 
-	attributes[ParsersAttributes::TRUSTED]=(is_trusted ? "1" : "");
+	attributes[ParsersAttributes::ID_TRUSTED]=(is_trusted ? "1" : "");
 
 	if(!reduced_form && def_type==SchemaParser::XML_DEFINITION)
 		reduced_form=(!functions[VALIDATOR_FUNC] && !functions[HANDLER_FUNC] && !functions[INLINE_FUNC] && !this->getOwner());
@@ -34,21 +34,15 @@ Operator::Operator(void)
 	argument_types[LEFT_ARG]=PgSQLType("any");
 	argument_types[RIGHT_ARG]=PgSQLType("any");
 
-	attributes[ParsersAttributes::LEFT_TYPE]="";
-	attributes[ParsersAttributes::RIGHT_TYPE]="";
-	attributes[ParsersAttributes::COMMUTATOR_OP]="";
-	attributes[ParsersAttributes::NEGATOR_OP]="";
-	//attributes[ParsersAttributes::SORT_OP]="";
-	//attributes[ParsersAttributes::SORT2_OP]="";
-	//attributes[ParsersAttributes::LESS_OP]="";
-	//attributes[ParsersAttributes::GREATER_OP]="";
-	attributes[ParsersAttributes::RESTRICTION_FUNC]="";
-	attributes[ParsersAttributes::JOIN_FUNC]="";
-	attributes[ParsersAttributes::OPERATOR_FUNC]="";
-	attributes[ParsersAttributes::HASHES]="";
-	attributes[ParsersAttributes::MERGES]="";
-	attributes[ParsersAttributes::SIGNATURE]="";
-	attributes[ParsersAttributes::REF_TYPE]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_LEFT_TYPE, ParsersAttributes::ID_RIGHT_TYPE, ParsersAttributes::ID_COMMUTATOR_OP,
+			ParsersAttributes::ID_NEGATOR_OP, ParsersAttributes::ID_RESTRICTION_FUNC, ParsersAttributes::ID_JOIN_FUNC,
+			ParsersAttributes::ID_OPERATOR_FUNC, ParsersAttributes::ID_HASHES, ParsersAttributes::ID_MERGES,
+			ParsersAttributes::ID_SIGNATURE, ParsersAttributes::ID_REF_TYPE };
+	declareAttributes(class_attribs);
+	//attributes[ParsersAttributes::ID_SORT_OP]="";
+	//attributes[ParsersAttributes::ID_SORT2_OP]="";
+	//attributes[ParsersAttributes::ID_LESS_OP]="";
+	//attributes[ParsersAttributes::ID_GREATER_OP]="";
 }
 
 bool Operator::isValidName(const QString &name)
@@ -92,7 +86,10 @@ void Operator::setName(const QString &name)
 		if(!isValidName(name))
 			throw Exception(ERR_ASG_INV_NAME_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		else
+		{
 			this->obj_name=name;
+			updateDatabaseIndex();
+		}
 	}
 }
 
@@ -164,6 +161,9 @@ void Operator::setArgumentType(PgSQLType arg_type, unsigned arg_id)
 		throw Exception( ERR_REF_OPER_ARG_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	argument_types[arg_id]=arg_type;
+
+	//The operator's signature depends on the arguments types
+	updateDatabaseIndex();
 }
 
 void Operator::setOperator(Operator *oper, unsigned op_type)
@@ -282,6 +282,8 @@ QString Operator::getCodeDefinition(unsigned def_type)
 
 QString Operator::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
+	QMutexLocker locker(&code_gen_mutex);
+
 	unsigned i;
 	QString atribs_tipos[]={ParsersAttributes::LEFT_TYPE, ParsersAttributes::RIGHT_TYPE},
 			atribs_ops[]={ ParsersAttributes::COMMUTATOR_OP,
@@ -316,7 +318,7 @@ QString Operator::getCodeDefinition(unsigned def_type, bool reduced_form)
 				attributes[atribs_ops[i]]=operators[i]->getName(true);
 			else
 			{
-				operators[i]->attributes[ParsersAttributes::REF_TYPE]=atribs_ops[i];
+				operators[i]->attributes[ParsersAttributes::ID_REF_TYPE]=atribs_ops[i];
 				attributes[atribs_ops[i]]=operators[i]->getCodeDefinition(def_type, true);
 			}
 		}
@@ -336,9 +338,9 @@ QString Operator::getCodeDefinition(unsigned def_type, bool reduced_form)
 		}
 	}
 
-	attributes[ParsersAttributes::HASHES]=(hashes ? "1" : "");
-	attributes[ParsersAttributes::MERGES]=(merges ? "1" : "");
-	attributes[ParsersAttributes::SIGNATURE]=getSignature();
+	attributes[ParsersAttributes::ID_HASHES]=(hashes ? "1" : "");
+	attributes[ParsersAttributes::ID_MERGES]=(merges ? "1" : "");
+	attributes[ParsersAttributes::ID_SIGNATURE]=getSignature();
 
 	return(BaseObject::getCodeDefinition(def_type, reduced_form));
 }
@@ -23,11 +23,9 @@ OperatorClass::OperatorClass(void)
 	obj_type=OBJ_OPCLASS;
 	family=nullptr;
 	is_default=false;
-	attributes[ParsersAttributes::FAMILY]="";
-	attributes[ParsersAttributes::ELEMENTS]="";
-	attributes[ParsersAttributes::INDEX_TYPE]="";
-	attributes[ParsersAttributes::TYPE]="";
-	attributes[ParsersAttributes::DEFAULT]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_FAMILY, ParsersAttributes::ID_ELEMENTS, ParsersAttributes::ID_INDEX_TYPE,
+			ParsersAttributes::ID_TYPE, ParsersAttributes::ID_DEFAULT };
+	declareAttributes(class_attribs);
 }
 
 OperatorClass::~OperatorClass(void)
@@ -74,7 +72,7 @@ void OperatorClass::setElementsAttribute(unsigned def_type)
 			 i < count-1) str_elems+=",\n";
 	}
 
-	attributes[ParsersAttributes::ELEMENTS]=str_elems;
+	attributes[ParsersAttributes::ID_ELEMENTS]=str_elems;
 }
 
 void OperatorClass::addElement(OperatorClassElement elem)
@@ -162,18 +160,20 @@ QString OperatorClass::getCodeDefinition(unsigned def_type)
 
 QString OperatorClass::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
+	QMutexLocker locker(&code_gen_mutex);
+
 	setElementsAttribute(def_type);
-	attributes[ParsersAttributes::INDEX_TYPE]=(~indexing_type);
-	attributes[ParsersAttributes::DEFAULT]=(is_default ? "1" : "");
+	attributes[ParsersAttributes::ID_INDEX_TYPE]=(~indexing_type);
+	attributes[ParsersAttributes::ID_DEFAULT]=(is_default ? "1" : "");
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
-		attributes[ParsersAttributes::TYPE]=(*data_type);
+		attributes[ParsersAttributes::ID_TYPE]=(*data_type);
 	else
-		attributes[ParsersAttributes::TYPE]=data_type.getCodeDefinition(def_type);
+		attributes[ParsersAttributes::ID_TYPE]=data_type.getCodeDefinition(def_type);
 
 	if(family)
 	{
-		attributes[ParsersAttributes::FAMILY]=family->getName(true);
+		attributes[ParsersAttributes::ID_FAMILY]=family->getName(true);
 	}
 
 	return(BaseObject::getCodeDefinition(def_type, reduced_form));
@@ -128,60 +128,60 @@ bool OperatorClassElement::isForOrderBy(void)
 
 QString OperatorClassElement::getCodeDefinition(unsigned def_type)
 {
-	map<QString, QString> attributes;
-
-	attributes[ParsersAttributes::TYPE]="";
-	attributes[ParsersAttributes::STRATEGY_NUM]="";
-	attributes[ParsersAttributes::SIGNATURE]="";
-	attributes[ParsersAttributes::FUNCTION]="";
-	attributes[ParsersAttributes::OPERATOR]="";
-	attributes[ParsersAttributes::STORAGE]="";
-	attributes[ParsersAttributes::OP_FAMILY]="";
-	attributes[ParsersAttributes::FOR_ORDER_BY]="";
-	attributes[ParsersAttributes::DEFINITION]="";
+	AttributesMap attributes;
+
+	attributes[ParsersAttributes::ID_TYPE]="";
+	attributes[ParsersAttributes::ID_STRATEGY_NUM]="";
+	attributes[ParsersAttributes::ID_SIGNATURE]="";
+	attributes[ParsersAttributes::ID_FUNCTION]="";
+	attributes[ParsersAttributes::ID_OPERATOR]="";
+	attributes[ParsersAttributes::ID_STORAGE]="";
+	attributes[ParsersAttributes::ID_OP_FAMILY]="";
+	attributes[ParsersAttributes::ID_FOR_ORDER_BY]="";
+	attributes[ParsersAttributes::ID_DEFINITION]="";
 
 	if(element_type==FUNCTION_ELEM && function && strategy_number > 0)
 	{
 		//FUNCTION support_number [ ( op_type [ , op_type ] ) ] funcname ( argument_type [, ...] )
-		attributes[ParsersAttributes::FUNCTION]="1";
-		attributes[ParsersAttributes::STRATEGY_NUM]=QString("%1").arg(strategy_number);
+		attributes[ParsersAttributes::ID_FUNCTION]="1";
+		attributes[ParsersAttributes::ID_STRATEGY_NUM]=QString("%1").arg(strategy_number);
 
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::SIGNATURE]=function->getSignature();
+			attributes[ParsersAttributes::ID_SIGNATURE]=function->getSignature();
 		else
-			attributes[ParsersAttributes::DEFINITION]=function->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::ID_DEFINITION]=function->getCodeDefinition(def_type,true);
 	}
 	else if(element_type==OPERATOR_ELEM && _operator && strategy_number > 0)
 	{
 		//OPERATOR strategy_number operator_name [ ( op_type, op_type ) ] [ RECHECK ]
-		attributes[ParsersAttributes::OPERATOR]="1";
-		attributes[ParsersAttributes::STRATEGY_NUM]=QString("%1").arg(strategy_number);
+		attributes[ParsersAttributes::ID_OPERATOR]="1";
+		attributes[ParsersAttributes::ID_STRATEGY_NUM]=QString("%1").arg(strategy_number);
 
 		if(for_order_by)
-			attributes[ParsersAttributes::FOR_ORDER_BY]="1";
+			attributes[ParsersAttributes::ID_FOR_ORDER_BY]="1";
 
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::SIGNATURE]=_operator->getSignature();
+			attributes[ParsersAttributes::ID_SIGNATURE]=_operator->getSignature();
 		else
-			attributes[ParsersAttributes::DEFINITION]=_operator->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::ID_DEFINITION]=_operator->getCodeDefinition(def_type,true);
 
 		if(op_family)
 		{
 			if(def_type==SchemaParser::SQL_DEFINITION)
-				attributes[ParsersAttributes::OP_FAMILY]=op_family->getName(true);
+				attributes[ParsersAttributes::ID_OP_FAMILY]=op_family->getName(true);
 			else
-				attributes[ParsersAttributes::DEFINITION]+=op_family->getCodeDefinition(def_type,true);
+				attributes[ParsersAttributes::ID_DEFINITION]+=op_family->getCodeDefinition(def_type,true);
 		}
 	}
 	else if(element_type==STORAGE_ELEM && storage!=PgSQLType::null)
 	{
 		//STORAGE storage_type
-		attributes[ParsersAttributes::STORAGE]="1";
+		attributes[ParsersAttributes::ID_STORAGE]="1";
 
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::TYPE]=(*storage);
+			attributes[ParsersAttributes::ID_TYPE]=(*storage);
 		else
-			attributes[ParsersAttributes::DEFINITION]=storage.getCodeDefinition(def_type);
+			attributes[ParsersAttributes::ID_DEFINITION]=storage.getCodeDefinition(def_type);
 	}
 
 	return(SchemaParser::getCodeDefinition(ParsersAttributes::ELEMENT,attributes, def_type));
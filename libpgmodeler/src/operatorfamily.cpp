@@ -21,7 +21,8 @@
 OperatorFamily::OperatorFamily(void)
 {
 	obj_type=OBJ_OPFAMILY;
-	attributes[ParsersAttributes::INDEX_TYPE]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_INDEX_TYPE };
+	declareAttributes(class_attribs);
 }
 
 void OperatorFamily::setIndexingType(IndexingType idx_type)
@@ -41,7 +42,9 @@ QString OperatorFamily::getCodeDefinition(unsigned def_type)
 
 QString OperatorFamily::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
-	attributes[ParsersAttributes::INDEX_TYPE]=(~indexing_type);
+	QMutexLocker locker(&code_gen_mutex);
+
+	attributes[ParsersAttributes::ID_INDEX_TYPE]=(~indexing_type);
 	return(BaseObject::getCodeDefinition(def_type,reduced_form));
 }
 
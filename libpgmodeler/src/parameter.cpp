@@ -66,14 +66,14 @@ QString Parameter::getCodeDefinition(unsigned def_type)
 QString Parameter::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
 	if(def_type==SchemaParser::SQL_DEFINITION)
-		attributes[ParsersAttributes::NAME]=BaseObject::formatName(obj_name);
+		attributes[ParsersAttributes::ID_NAME]=BaseObject::formatName(obj_name);
 	else
-		attributes[ParsersAttributes::NAME]=obj_name;
+		attributes[ParsersAttributes::ID_NAME]=obj_name;
 
-	attributes[ParsersAttributes::PARAM_IN]=(is_in ? "1" : "");
-	attributes[ParsersAttributes::PARAM_OUT]=(is_out ? "1" : "");
-	attributes[ParsersAttributes::DEFAULT_VALUE]=default_value;
-	attributes[ParsersAttributes::TYPE]=type.getCodeDefinition(def_type);
+	attributes[ParsersAttributes::ID_PARAM_IN]=(is_in ? "1" : "");
+	attributes[ParsersAttributes::ID_PARAM_OUT]=(is_out ? "1" : "");
+	attributes[ParsersAttributes::ID_DEFAULT_VALUE]=default_value;
+	attributes[ParsersAttributes::ID_TYPE]=type.getCodeDefinition(def_type);
 
 	return(BaseObject::getCodeDefinition(def_type, reduced_form));
 }
@@ -39,14 +39,10 @@ Permission::Permission(BaseObject *obj)
 	this->obj_type=OBJ_PERMISSION;
 	revoke=cascade=false;
 
-	attributes[ParsersAttributes::OBJECT]="";
-	attributes[ParsersAttributes::TYPE]="";
-	attributes[ParsersAttributes::PARENT]="";
-	attributes[ParsersAttributes::GRANT_OP]="";
-	attributes[ParsersAttributes::ROLES]="";
-	attributes[ParsersAttributes::PRIVILEGES]="";
-	attributes[ParsersAttributes::CASCADE]="";
-	attributes[ParsersAttributes::PRIVILEGES_GOP]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_OBJECT, ParsersAttributes::ID_TYPE, ParsersAttributes::ID_PARENT,
+			ParsersAttributes::ID_GRANT_OP, ParsersAttributes::ID_ROLES, ParsersAttributes::ID_PRIVILEGES,
+			ParsersAttributes::ID_CASCADE, ParsersAttributes::ID_PRIVILEGES_GOP };
+	declareAttributes(class_attribs);
 }
 
 bool Permission::objectAcceptsPermission(ObjectType obj_type, int privilege)
@@ -318,6 +314,7 @@ void Permission::generatePermissionId(void)
 	hash.addData(QByteArray(str_aux.toStdString().c_str()));
 	str_aux=hash.result().toHex();
 	this->obj_name=(!revoke ? QString("grant_") : QString("revoke_")) + str_aux.mid(0,10);
+	updateDatabaseIndex();
 }
 
 QString Permission::getCodeDefinition(unsigned def_type)
@@ -333,25 +330,25 @@ QString Permission::getCodeDefinition(unsigned def_type)
 
 	obj_type=object->getObjectType();
 
-	attributes[ParsersAttributes::REVOKE]=(revoke ? "1" : "");
-	attributes[ParsersAttributes::CASCADE]=(cascade ? "1" : "");
+	attributes[ParsersAttributes::ID_REVOKE]=(revoke ? "1" : "");
+	attributes[ParsersAttributes::ID_CASCADE]=(cascade ? "1" : "");
 
 	if(obj_type==OBJ_FUNCTION)
-		attributes[ParsersAttributes::OBJECT]=dynamic_cast<Function *>(object)->getSignature();
+		attributes[ParsersAttributes::ID_OBJECT]=dynamic_cast<Function *>(object)->getSignature();
 	else
-		attributes[ParsersAttributes::OBJECT]=object->getName(true);
+		attributes[ParsersAttributes::ID_OBJECT]=object->getName(true);
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
 	{
 		//Views and Tables uses the same key word when setting permission (TABLE)
-		attributes[ParsersAttributes::TYPE]=
+		attributes[ParsersAttributes::ID_TYPE]=
 		 (object->getObjectType()==OBJ_VIEW ? BaseObject::getSQLName(OBJ_TABLE): BaseObject::getSQLName(object->getObjectType()));
 	}
 	else
-		attributes[ParsersAttributes::TYPE]=BaseObject::getSchemaName(object->getObjectType());
+		attributes[ParsersAttributes::ID_TYPE]=BaseObject::getSchemaName(object->getObjectType());
 
 	if(obj_type==OBJ_COLUMN)
-		attributes[ParsersAttributes::PARENT]=dynamic_cast<Column *>(object)->getParentTable()->getName(true);
+		attributes[ParsersAttributes::ID_PARENT]=dynamic_cast<Column *>(object)->getParentTable()->getName(true);
 
 	if(def_type==SchemaParser::XML_DEFINITION)
 	{
@@ -370,21 +367,21 @@ QString Permission::getCodeDefinition(unsigned def_type)
 		for(i=0; i < 12; i++)
 		{
 			if(privileges[i] && !grant_option[i])
-				attributes[ParsersAttributes::PRIVILEGES]+=priv_vect[i].toUpper() + ",";
+				attributes[ParsersAttributes::ID_PRIVILEGES]+=priv_vect[i].toUpper() + ",";
 			else if(grant_option[i])
-				attributes[ParsersAttributes::PRIVILEGES_GOP]+=priv_vect[i].toUpper() + ",";
+				attributes[ParsersAttributes::ID_PRIVILEGES_GOP]+=priv_vect[i].toUpper() + ",";
 		}
 
-		attributes[ParsersAttributes::PRIVILEGES].remove(attributes[ParsersAttributes::PRIVILEGES].size()-1,1);
-		attributes[ParsersAttributes::PRIVILEGES_GOP].remove(attributes[ParsersAttributes::PRIVILEGES_GOP].size()-1,1);
+		attributes[ParsersAttributes::ID_PRIVILEGES].remove(attributes[ParsersAttributes::ID_PRIVILEGES].size()-1,1);
+		attributes[ParsersAttributes::ID_PRIVILEGES_GOP].remove(attributes[ParsersAttributes::ID_PRIVILEGES_GOP].size()-1,1);
 	}
 
 	count=roles.size();
 
 	for(i=0; i < count; i++)
-		attributes[ParsersAttributes::ROLES]+=roles[i]->getName(true) + ",";
+		attributes[ParsersAttributes::ID_ROLES]+=roles[i]->getName(true) + ",";
 
-	attributes[ParsersAttributes::ROLES].remove(attributes[ParsersAttributes::ROLES].size()-1,1);
+	attributes[ParsersAttributes::ID_ROLES].remove(attributes[ParsersAttributes::ID_ROLES].size()-1,1);
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
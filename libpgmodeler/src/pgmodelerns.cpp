@@ -40,6 +40,22 @@ void PgModelerNS::copyObject(BaseObject **psrc_obj, Classe *copy_obj)
 
 	//Makes the copy between the objects
 	(*orig_obj)=(*copy_obj);
+
+	//The copy may change the name (and the references) of an object that belongs to a model so its indexes must be updated
+	DatabaseModel *model=dynamic_cast<DatabaseModel *>(orig_obj->getDatabase());
+	if(model)
+	{
+		model->updateObjectIndex(orig_obj);
+		model->updateObjectReferences(orig_obj);
+	}
+
+	//The same is done for the indexes of the parent table when copying table objects
+	TableObject *tab_obj=dynamic_cast<TableObject *>(orig_obj);
+	if(tab_obj && dynamic_cast<Table *>(tab_obj->getParentTable()))
+	{
+		dynamic_cast<Table *>(tab_obj->getParentTable())->updateObjectIndex(tab_obj);
+		dynamic_cast<Table *>(tab_obj->getParentTable())->updateObjectReferences(tab_obj);
+	}
 }
 
 void PgModelerNS::copyObject(BaseObject **psrc_obj, BaseObject *copy_obj, ObjectType obj_type)
@@ -1071,6 +1071,8 @@ void Relationship::addColumnsRelGen(void)
 
 void Relationship::connectRelationship(void)
 {
+	static Profiler::Entry *connected_cnt=Profiler::getCounter("relationships.connected");
+
 	try
 	{
 		if(!connected)
@@ -1124,6 +1126,7 @@ void Relationship::connectRelationship(void)
 			dst_tab_prev_name=dst_table->getName();
 
 			this->invalidated=false;
+			connected_cnt->increment();
 		}
 	}
 	catch(Exception &e)
@@ -1856,6 +1859,8 @@ void Relationship::removeColumnsFromTablePK(Table *table)
 
 void Relationship::disconnectRelationship(bool rem_tab_objs)
 {
+	static Profiler::Entry *disconnected_cnt=Profiler::getCounter("relationships.disconnected");
+
 	try
 	{
 		if(connected)
@@ -1868,6 +1873,8 @@ void Relationship::disconnectRelationship(bool rem_tab_objs)
 			vector<TableObject *>::iterator itr_atrib, itr_atrib_end;
 			TableObject *tab_obj=nullptr;
 
+			disconnected_cnt->increment();
+
 			if(rel_type==RELATIONSHIP_GEN ||
 				 rel_type==RELATIONSHIP_DEP)
 			{
@@ -2285,41 +2292,41 @@ QString Relationship::getCodeDefinition(unsigned def_type)
 		{
 			unsigned count, i;
 
-			attributes[ParsersAttributes::RELATIONSHIP_1N]="1";
-			attributes[ParsersAttributes::CONSTRAINTS]=fk_rel1n->getCodeDefinition(def_type);
+			attributes[ParsersAttributes::ID_RELATIONSHIP_1N]="1";
+			attributes[ParsersAttributes::ID_CONSTRAINTS]=fk_rel1n->getCodeDefinition(def_type);
 
 			if(uq_rel11)
-				attributes[ParsersAttributes::CONSTRAINTS]+=uq_rel11->getCodeDefinition(def_type);
+				attributes[ParsersAttributes::ID_CONSTRAINTS]+=uq_rel11->getCodeDefinition(def_type);
 
 			count=rel_constraints.size();
 			for(i=0; i < count; i++)
 			{
 				if(dynamic_cast<Constraint *>(rel_constraints[i])->getConstraintType()!=ConstraintType::primary_key)
-					attributes[ParsersAttributes::CONSTRAINTS]+=dynamic_cast<Constraint *>(rel_constraints[i])->getCodeDefinition(def_type, false);
+					attributes[ParsersAttributes::ID_CONSTRAINTS]+=dynamic_cast<Constraint *>(rel_constraints[i])->getCodeDefinition(def_type, false);
 
 			}
 
-			attributes[ParsersAttributes::TABLE]=getReceiverTable()->getName(true);
+			attributes[ParsersAttributes::ID_TABLE]=getReceiverTable()->getName(true);
 		}
 		else if(table_relnn && rel_type==RELATIONSHIP_NN)
 		{
 			unsigned count, i;
 
-			attributes[ParsersAttributes::RELATIONSHIP_NN]="1";
-			attributes[ParsersAttributes::TABLE]=table_relnn->getCodeDefinition(def_type);
+			attributes[ParsersAttributes::ID_RELATIONSHIP_NN]="1";
+			attributes[ParsersAttributes::ID_TABLE]=table_relnn->getCodeDefinition(def_type);
 
 			count=table_relnn->getConstraintCount();
 			for(i=0; i < count; i++)
 			{
 				if(table_relnn->getConstraint(i)->getConstraintType()!=ConstraintType::primary_key)
-					attributes[ParsersAttributes::CONSTRAINTS]+=table_relnn->getConstraint(i)->getCodeDefinition(def_type, true);
+					attributes[ParsersAttributes::ID_CONSTRAINTS]+=table_relnn->getConstraint(i)->getCodeDefinition(def_type, true);
 			}
 		}
 		else if(rel_type==RELATIONSHIP_GEN)
 		{
-			attributes[ParsersAttributes::RELATIONSHIP_GEN]="1";
-			attributes[ParsersAttributes::TABLE]=getReceiverTable()->getName(true);
-			attributes[ParsersAttributes::ANCESTOR_TABLE]=getReferenceTable()->getName(true);
+			attributes[ParsersAttributes::ID_RELATIONSHIP_GEN]="1";
+			attributes[ParsersAttributes::ID_TABLE]=getReceiverTable()->getName(true);
+			attributes[ParsersAttributes::ID_ANCESTOR_TABLE]=getReferenceTable()->getName(true);
 		}
 
 		return(this->BaseObject::__getCodeDefinition(SchemaParser::SQL_DEFINITION));
@@ -2330,57 +2337,57 @@ QString Relationship::getCodeDefinition(unsigned def_type)
 		bool reduced_form;
 
 		setRelationshipAttributes();
-		attributes[ParsersAttributes::IDENTIFIER]=(identifier ? "1" : "");
-		attributes[ParsersAttributes::DEFERRABLE]=(deferrable ? "1" : "");
-		attributes[ParsersAttributes::DEFER_TYPE]=~deferral_type;
-		attributes[ParsersAttributes::TABLE_NAME]=tab_name_relnn;
-		attributes[ParsersAttributes::RELATIONSHIP_GEN]=(rel_type==RELATIONSHIP_GEN ? "1" : "");
-		attributes[ParsersAttributes::RELATIONSHIP_DEP]=(rel_type==RELATIONSHIP_DEP ? "1" : "");
-
-		attributes[ParsersAttributes::SRC_COL_PATTERN]=name_patterns[SRC_COL_PATTERN];
-		attributes[ParsersAttributes::DST_COL_PATTERN]=name_patterns[DST_COL_PATTERN];
-		attributes[ParsersAttributes::PK_PATTERN]=name_patterns[PK_PATTERN];
-		attributes[ParsersAttributes::UQ_PATTERN]=name_patterns[UQ_PATTERN];
-		attributes[ParsersAttributes::SRC_FK_PATTERN]=name_patterns[SRC_FK_PATTERN];
-		attributes[ParsersAttributes::DST_FK_PATTERN]=name_patterns[DST_FK_PATTERN];
+		attributes[ParsersAttributes::ID_IDENTIFIER]=(identifier ? "1" : "");
+		attributes[ParsersAttributes::ID_DEFERRABLE]=(deferrable ? "1" : "");
+		attributes[ParsersAttributes::ID_DEFER_TYPE]=~deferral_type;
+		attributes[ParsersAttributes::ID_TABLE_NAME]=tab_name_relnn;
+		attributes[ParsersAttributes::ID_RELATIONSHIP_GEN]=(rel_type==RELATIONSHIP_GEN ? "1" : "");
+		attributes[ParsersAttributes::ID_RELATIONSHIP_DEP]=(rel_type==RELATIONSHIP_DEP ? "1" : "");
+
+		attributes[ParsersAttributes::ID_SRC_COL_PATTERN]=name_patterns[SRC_COL_PATTERN];
+		attributes[ParsersAttributes::ID_DST_COL_PATTERN]=name_patterns[DST_COL_PATTERN];
+		attributes[ParsersAttributes::ID_PK_PATTERN]=name_patterns[PK_PATTERN];
+		attributes[ParsersAttributes::ID_UQ_PATTERN]=name_patterns[UQ_PATTERN];
+		attributes[ParsersAttributes::ID_SRC_FK_PATTERN]=name_patterns[SRC_FK_PATTERN];
+		attributes[ParsersAttributes::ID_DST_FK_PATTERN]=name_patterns[DST_FK_PATTERN];
 
 		if(rel_type==RELATIONSHIP_11 || rel_type==RELATIONSHIP_1N)
 		{
 			count=col_indexes.size();
 			for(i=0; i < count; i++)
-				attributes[ParsersAttributes::COL_INDEXES]+=QString("%1").arg(col_indexes[i]) + ",";
+				attributes[ParsersAttributes::ID_COL_INDEXES]+=QString("%1").arg(col_indexes[i]) + ",";
 
 			count=attrib_indexes.size();
 			for(i=0; i < count; i++)
-				attributes[ParsersAttributes::ATTRIB_INDEXES]+=QString("%1").arg(attrib_indexes[i]) + ",";
+				attributes[ParsersAttributes::ID_ATTRIB_INDEXES]+=QString("%1").arg(attrib_indexes[i]) + ",";
 
 			count=constr_indexes.size();
 			for(i=0; i < count; i++)
-				attributes[ParsersAttributes::CONSTR_INDEXES]+=QString("%1").arg(constr_indexes[i]) + ",";
+				attributes[ParsersAttributes::ID_CONSTR_INDEXES]+=QString("%1").arg(constr_indexes[i]) + ",";
 
 			count=rel_constraints.size();
 			for(i=0; i < count; i++)
-				attributes[ParsersAttributes::COL_INDEXES]+=QString("%1").arg(getReceiverTable()->getObjectIndex(rel_constraints[i]->getName(), OBJ_CONSTRAINT)) + ",";
+				attributes[ParsersAttributes::ID_COL_INDEXES]+=QString("%1").arg(getReceiverTable()->getObjectIndex(rel_constraints[i]->getName(), OBJ_CONSTRAINT)) + ",";
 
-			attributes[ParsersAttributes::COL_INDEXES].remove(attributes[ParsersAttributes::COL_INDEXES].size()-1,1);
-			attributes[ParsersAttributes::ATTRIB_INDEXES].remove(attributes[ParsersAttributes::ATTRIB_INDEXES].size()-1,1);
-			attributes[ParsersAttributes::CONSTR_INDEXES].remove(attributes[ParsersAttributes::CONSTR_INDEXES].size()-1,1);
+			attributes[ParsersAttributes::ID_COL_INDEXES].remove(attributes[ParsersAttributes::ID_COL_INDEXES].size()-1,1);
+			attributes[ParsersAttributes::ID_ATTRIB_INDEXES].remove(attributes[ParsersAttributes::ID_ATTRIB_INDEXES].size()-1,1);
+			attributes[ParsersAttributes::ID_CONSTR_INDEXES].remove(attributes[ParsersAttributes::ID_CONSTR_INDEXES].size()-1,1);
 		}
 
-		attributes[ParsersAttributes::COLUMNS]="";
+		attributes[ParsersAttributes::ID_COLUMNS]="";
 		count=rel_attributes.size();
 		for(i=0; i < count; i++)
 		{
-			attributes[ParsersAttributes::COLUMNS]+=dynamic_cast<Column *>(rel_attributes[i])->
+			attributes[ParsersAttributes::ID_COLUMNS]+=dynamic_cast<Column *>(rel_attributes[i])->
 																							getCodeDefinition(SchemaParser::XML_DEFINITION);
 		}
 
-		attributes[ParsersAttributes::CONSTRAINTS]="";
+		attributes[ParsersAttributes::ID_CONSTRAINTS]="";
 		count=rel_constraints.size();
 		for(i=0; i < count; i++)
 		{
 			if(!rel_constraints[i]->isProtected())
-				attributes[ParsersAttributes::CONSTRAINTS]+=dynamic_cast<Constraint *>(rel_constraints[i])->
+				attributes[ParsersAttributes::ID_CONSTRAINTS]+=dynamic_cast<Constraint *>(rel_constraints[i])->
 																										getCodeDefinition(SchemaParser::XML_DEFINITION, true);
 		}
 
@@ -2389,21 +2396,21 @@ QString Relationship::getCodeDefinition(unsigned def_type)
 		{
 			if(!gen_columns.empty() && i < gen_columns.size())
 			{
-				attributes[ParsersAttributes::SPECIAL_PK_COLS]+=QString("%1").arg(column_ids_pk_rel[i]);
-				if(i < count-1) attributes[ParsersAttributes::SPECIAL_PK_COLS]+=",";
+				attributes[ParsersAttributes::ID_SPECIAL_PK_COLS]+=QString("%1").arg(column_ids_pk_rel[i]);
+				if(i < count-1) attributes[ParsersAttributes::ID_SPECIAL_PK_COLS]+=",";
 			}
 		}
 
 		if(copy_options.getCopyMode()!=0)
 		{
-			attributes[ParsersAttributes::COPY_OPTIONS]=QString("%1").arg(copy_options.getCopyOptionsIds());
-			attributes[ParsersAttributes::COPY_MODE]=QString("%1").arg(copy_options.getCopyMode());;
+			attributes[ParsersAttributes::ID_COPY_OPTIONS]=QString("%1").arg(copy_options.getCopyOptionsIds());
+			attributes[ParsersAttributes::ID_COPY_MODE]=QString("%1").arg(copy_options.getCopyMode());;
 		}
 
-		reduced_form=(attributes[ParsersAttributes::COLUMNS].isEmpty() &&
-								 attributes[ParsersAttributes::CONSTRAINTS].isEmpty() &&
-								 attributes[ParsersAttributes::POINTS].isEmpty() &&
-								 attributes[ParsersAttributes::SPECIAL_PK_COLS].isEmpty());
+		reduced_form=(attributes[ParsersAttributes::ID_COLUMNS].isEmpty() &&
+								 attributes[ParsersAttributes::ID_CONSTRAINTS].isEmpty() &&
+								 attributes[ParsersAttributes::ID_POINTS].isEmpty() &&
+								 attributes[ParsersAttributes::ID_SPECIAL_PK_COLS].isEmpty());
 
 
 		return(this->BaseObject::getCodeDefinition(SchemaParser::XML_DEFINITION, reduced_form));
@@ -30,6 +30,7 @@ also generates the SQL code definition to represente the table link on PostgreSQ
 #include "baserelationship.h"
 #include "table.h"
 #include "textbox.h"
+#include "profiler.h"
 
 /*
 ### Relationship implementation rules ###
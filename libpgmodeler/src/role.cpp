@@ -30,20 +30,12 @@ Role::Role(void)
 
 	conn_limit=-1;
 
-	attributes[ParsersAttributes::SUPERUSER]="";
-	attributes[ParsersAttributes::CREATEDB]="";
-	attributes[ParsersAttributes::CREATEROLE]="";
-	attributes[ParsersAttributes::INHERIT]="";
-	attributes[ParsersAttributes::LOGIN]="";
-	attributes[ParsersAttributes::CONN_LIMIT]="";
-	attributes[ParsersAttributes::PASSWORD]="";
-	attributes[ParsersAttributes::ENCRYPTED]="";
-	attributes[ParsersAttributes::VALIDITY]="";
-	attributes[ParsersAttributes::REF_ROLES]="";
-	attributes[ParsersAttributes::MEMBER_ROLES]="";
-	attributes[ParsersAttributes::ADMIN_ROLES]="";
-	attributes[ParsersAttributes::REPLICATION]="";
-	attributes[ParsersAttributes::GROUP]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_SUPERUSER, ParsersAttributes::ID_CREATEDB, ParsersAttributes::ID_CREATEROLE,
+			ParsersAttributes::ID_INHERIT, ParsersAttributes::ID_LOGIN, ParsersAttributes::ID_CONN_LIMIT,
+			ParsersAttributes::ID_PASSWORD, ParsersAttributes::ID_ENCRYPTED, ParsersAttributes::ID_VALIDITY,
+			ParsersAttributes::ID_REF_ROLES, ParsersAttributes::ID_MEMBER_ROLES, ParsersAttributes::ID_ADMIN_ROLES,
+			ParsersAttributes::ID_REPLICATION, ParsersAttributes::ID_GROUP };
+	declareAttributes(class_attribs);
 }
 
 void Role::setOption(unsigned op_type, bool value)
@@ -321,10 +313,10 @@ QString Role::getPassword(void)
 QString Role::getCodeDefinition(unsigned def_type)
 {
 	unsigned i;
-	QString op_attribs[]={ ParsersAttributes::SUPERUSER, ParsersAttributes::CREATEDB,
-												 ParsersAttributes::CREATEROLE, ParsersAttributes::INHERIT,
-												 ParsersAttributes::LOGIN, ParsersAttributes::ENCRYPTED,
-												 ParsersAttributes::REPLICATION };
+	unsigned op_attribs[]={ ParsersAttributes::ID_SUPERUSER, ParsersAttributes::ID_CREATEDB,
+												 ParsersAttributes::ID_CREATEROLE, ParsersAttributes::ID_INHERIT,
+												 ParsersAttributes::ID_LOGIN, ParsersAttributes::ID_ENCRYPTED,
+												 ParsersAttributes::ID_REPLICATION };
 
 	setRoleAttribute(REF_ROLE);
 	setRoleAttribute(MEMBER_ROLE);
@@ -333,13 +325,13 @@ QString Role::getCodeDefinition(unsigned def_type)
 	for(i=0; i <= OP_REPLICATION; i++)
 		attributes[op_attribs[i]]=(options[i] ? "1" : "");
 
-	attributes[ParsersAttributes::PASSWORD]=password;
-	attributes[ParsersAttributes::VALIDITY]=validity;
+	attributes[ParsersAttributes::ID_PASSWORD]=password;
+	attributes[ParsersAttributes::ID_VALIDITY]=validity;
 
-	attributes[ParsersAttributes::GROUP]=(options[OP_LOGIN] ? "" : "1");
+	attributes[ParsersAttributes::ID_GROUP]=(options[OP_LOGIN] ? "" : "1");
 
 	if(conn_limit >= 0)
-		attributes[ParsersAttributes::CONN_LIMIT]=QString("%1").arg(conn_limit);
+		attributes[ParsersAttributes::ID_CONN_LIMIT]=QString("%1").arg(conn_limit);
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
@@ -22,11 +22,9 @@ Rule::Rule(void)
 {
 	execution_type=BaseType::null;
 	obj_type=OBJ_RULE;
-	attributes[ParsersAttributes::EVENT_TYPE]="";
-	attributes[ParsersAttributes::TABLE]="";
-	attributes[ParsersAttributes::CONDITION]="";
-	attributes[ParsersAttributes::EXEC_TYPE]="";
-	attributes[ParsersAttributes::COMMANDS]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_EVENT_TYPE, ParsersAttributes::ID_TABLE, ParsersAttributes::ID_CONDITION,
+			ParsersAttributes::ID_EXEC_TYPE, ParsersAttributes::ID_COMMANDS };
+	declareAttributes(class_attribs);
 }
 
 void Rule::setCommandsAttribute(void)
@@ -41,7 +39,7 @@ void Rule::setCommandsAttribute(void)
 		if(i < (qtd-1)) str_cmds+=";";
 	}
 
-	attributes[ParsersAttributes::COMMANDS]=str_cmds;
+	attributes[ParsersAttributes::ID_COMMANDS]=str_cmds;
 }
 
 void Rule::setEventType(EventType type)
@@ -118,12 +116,12 @@ void Rule::removeCommands(void)
 QString Rule::getCodeDefinition(unsigned def_type)
 {
 	setCommandsAttribute();
-	attributes[ParsersAttributes::CONDITION]=conditional_expr;
-	attributes[ParsersAttributes::EXEC_TYPE]=(~execution_type);
-	attributes[ParsersAttributes::EVENT_TYPE]=(~event_type);
+	attributes[ParsersAttributes::ID_CONDITION]=conditional_expr;
+	attributes[ParsersAttributes::ID_EXEC_TYPE]=(~execution_type);
+	attributes[ParsersAttributes::ID_EVENT_TYPE]=(~event_type);
 
 	if(this->parent_table)
-		attributes[ParsersAttributes::TABLE]=this->parent_table->getName(true);
+		attributes[ParsersAttributes::ID_TABLE]=this->parent_table->getName(true);
 
 
 	return(BaseObject::__getCodeDefinition(def_type));
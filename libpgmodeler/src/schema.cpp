@@ -23,8 +23,8 @@ Schema::Schema(void)
 	obj_type=OBJ_SCHEMA;
 	fill_color=QColor(225,225,225, 80);
 	rect_visible=false;
-	attributes[ParsersAttributes::FILL_COLOR]="";
-	attributes[ParsersAttributes::RECT_VISIBLE]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_FILL_COLOR, ParsersAttributes::ID_RECT_VISIBLE };
+	declareAttributes(class_attribs);
 }
 
 void Schema::setName(const QString &name)
@@ -62,7 +62,7 @@ bool Schema::isRectVisible(void)
 
 QString Schema::getCodeDefinition(unsigned def_type)
 {
-	attributes[ParsersAttributes::FILL_COLOR]=fill_color.name();
-	attributes[ParsersAttributes::RECT_VISIBLE]=(rect_visible ? "1" : "");
+	attributes[ParsersAttributes::ID_FILL_COLOR]=fill_color.name();
+	attributes[ParsersAttributes::ID_RECT_VISIBLE]=(rect_visible ? "1" : "");
 	return(BaseObject::__getCodeDefinition(def_type));
 }
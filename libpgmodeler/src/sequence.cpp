@@ -30,13 +30,10 @@ Sequence::Sequence(void)
 	max_value=MAX_POSITIVE_VALUE;
 	owner_col=nullptr;
 
-	attributes[ParsersAttributes::INCREMENT]="";
-	attributes[ParsersAttributes::MIN_VALUE]="";
-	attributes[ParsersAttributes::MAX_VALUE]="";
-	attributes[ParsersAttributes::START]="";
-	attributes[ParsersAttributes::CACHE]="";
-	attributes[ParsersAttributes::CYCLE]="";
-	attributes[ParsersAttributes::OWNER_COLUMN]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_INCREMENT, ParsersAttributes::ID_MIN_VALUE, ParsersAttributes::ID_MAX_VALUE,
+			ParsersAttributes::ID_START, ParsersAttributes::ID_CACHE, ParsersAttributes::ID_CYCLE,
+			ParsersAttributes::ID_OWNER_COLUMN };
+	declareAttributes(class_attribs);
 }
 
 bool Sequence::isNullValue(const QString &value)
@@ -344,14 +341,14 @@ QString Sequence::getCodeDefinition(unsigned def_type)
 		table=dynamic_cast<Table *>(owner_col->getParentTable());
 		str_aux=table->getName(true) + "." + owner_col->getName(true);
 	}
-	attributes[ParsersAttributes::OWNER_COLUMN]=str_aux;
-
-	attributes[ParsersAttributes::INCREMENT]=increment;
-	attributes[ParsersAttributes::MIN_VALUE]=min_value;
-	attributes[ParsersAttributes::MAX_VALUE]=max_value;
-	attributes[ParsersAttributes::START]=start;
-	attributes[ParsersAttributes::CACHE]=cache;
-	attributes[ParsersAttributes::CYCLE]=(cycle ? "1" : "");
+	attributes[ParsersAttributes::ID_OWNER_COLUMN]=str_aux;
+
+	attributes[ParsersAttributes::ID_INCREMENT]=increment;
+	attributes[ParsersAttributes::ID_MIN_VALUE]=min_value;
+	attributes[ParsersAttributes::ID_MAX_VALUE]=max_value;
+	attributes[ParsersAttributes::ID_START]=start;
+	attributes[ParsersAttributes::ID_CACHE]=cache;
+	attributes[ParsersAttributes::ID_CYCLE]=(cycle ? "1" : "");
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
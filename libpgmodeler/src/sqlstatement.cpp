@@ -0,0 +1,95 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "sqlstatement.h"
+
+SQLStatement::SQLStatement(void)
+{
+	object_id=level=index=0;
+	object_type=BASE_OBJECT;
+}
+
+SQLStatement::SQLStatement(unsigned object_id, ObjectType object_type, unsigned level, unsigned index, const QString &code)
+{
+	this->object_id=object_id;
+	this->object_type=object_type;
+	this->level=level;
+	this->index=index;
+	this->code=code;
+}
+
+unsigned SQLStatement::getObjectId(void) const
+{
+	return(object_id);
+}
+
+ObjectType SQLStatement::getObjectType(void) const
+{
+	return(object_type);
+}
+
+unsigned SQLStatement::getLevel(void) const
+{
+	return(level);
+}
+
+unsigned SQLStatement::getIndex(void) const
+{
+	return(index);
+}
+
+QString SQLStatement::getCode(void) const
+{
+	return(code);
+}
+
+void SQLStatement::splitCode(const QString &code, vector<QString> &cmds)
+{
+	int pos=0, end=0, len=code.size();
+	QStringRef lin;
+	QString cmd;
+
+	cmds.clear();
+
+	while(pos < len)
+	{
+		end=code.indexOf('\n', pos);
+		if(end < 0) end=len;
+
+		lin=code.midRef(pos, end - pos);
+		pos=end + 1;
+
+		//The ddl end token closes the current command
+		if(lin.contains(ParsersAttributes::DDL_END_TOKEN))
+		{
+			if(!cmd.isEmpty())
+				cmds.push_back(cmd);
+
+			cmd.clear();
+		}
+		//Single line comments are discarded
+		else if(!lin.isEmpty() && !(lin.size() > 2 && lin.startsWith(QString("--"))))
+		{
+			cmd.append(lin);
+			cmd.append('\n');
+		}
+	}
+
+	if(!cmd.trimmed().isEmpty())
+		cmds.push_back(cmd);
+}
@@ -0,0 +1,66 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class SQLStatement
+\brief Implements a single SQL command generated for an object of the model (see DatabaseModel::generateSQLStatements()).
+ Besides the code, the statement stores the object that generated it and its dependency level: a statement only depends
+ on statements of lower levels, so statements of the same level can be executed in any order.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef SQL_STATEMENT_H
+#define SQL_STATEMENT_H
+
+#include "baseobject.h"
+#include <vector>
+
+class SQLStatement {
+	private:
+		//! \brief Id of the object that generated the statement
+		unsigned object_id;
+
+		//! \brief Type of the object that generated the statement
+		ObjectType object_type;
+
+		//! \brief Dependency level of the statement
+		unsigned level;
+
+		//! \brief Position of the statement inside the code of the object (starting at 0)
+		unsigned index;
+
+		//! \brief SQL code of the statement without comments
+		QString code;
+
+	public:
+		SQLStatement(void);
+		SQLStatement(unsigned object_id, ObjectType object_type, unsigned level, unsigned index, const QString &code);
+
+		unsigned getObjectId(void) const;
+		ObjectType getObjectType(void) const;
+		unsigned getLevel(void) const;
+		unsigned getIndex(void) const;
+		QString getCode(void) const;
+
+		/*! \brief Splits a piece of SQL code in commands (delimited by the ddl end token) removing the
+		 single line comments. Empty commands are discarded */
+		static void splitCode(const QString &code, vector<QString> &cmds);
+};
+
+#endif
@@ -0,0 +1,40 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class SQLStatementHandler
+\brief Interface of the objects that consume the SQL statements of a model as they are generated (see DatabaseModel::generateSQLStatements())
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef SQL_STATEMENT_HANDLER_H
+#define SQL_STATEMENT_HANDLER_H
+
+#include "sqlstatement.h"
+
+class SQLStatementHandler {
+	public:
+		virtual ~SQLStatementHandler(void){}
+
+		/*! \brief Receives the statements in the order they must be executed. Errors raised by the handler
+		 abort the code generation */
+		virtual void handleStatement(const SQLStatement &stmt)=0;
+};
+
+#endif
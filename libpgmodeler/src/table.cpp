@@ -17,19 +17,16 @@
 */
 
 #include "table.h"
+#include "databasemodel.h"
 
 Table::Table(void) : BaseTable()
 {
 	obj_type=OBJ_TABLE;
 	with_oid=true;
-	attributes[ParsersAttributes::COLUMNS]="";
-	attributes[ParsersAttributes::CONSTRAINTS]="";
-	attributes[ParsersAttributes::INDEXES]="";
-	attributes[ParsersAttributes::TRIGGERS]="";
-	attributes[ParsersAttributes::RULES]="";
-	attributes[ParsersAttributes::OIDS]="";
-	attributes[ParsersAttributes::COLS_COMMENT]="";
-	attributes[ParsersAttributes::COPY_TABLE]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_COLUMNS, ParsersAttributes::ID_CONSTRAINTS, ParsersAttributes::ID_INDEXES,
+			ParsersAttributes::ID_TRIGGERS, ParsersAttributes::ID_RULES, ParsersAttributes::ID_OIDS,
+			ParsersAttributes::ID_COLS_COMMENT, ParsersAttributes::ID_COPY_TABLE };
+	declareAttributes(class_attribs);
 	copy_table=nullptr;
 	this->setName(trUtf8("new_table").toUtf8());
 }
@@ -120,7 +117,7 @@ void Table::setCommentAttribute(TableObject *tab_obj)
 		attribs[ParsersAttributes::COMMENT]=tab_obj->getComment();
 
 		SchemaParser::setIgnoreUnkownAttributes(true);
-		attributes[ParsersAttributes::COLS_COMMENT]+=SchemaParser::getCodeDefinition(ParsersAttributes::COMMENT, attribs,
+		attributes[ParsersAttributes::ID_COLS_COMMENT]+=SchemaParser::getCodeDefinition(ParsersAttributes::COMMENT, attribs,
 																																								 SchemaParser::SQL_DEFINITION);
 		SchemaParser::setIgnoreUnkownAttributes(false);
 	}
@@ -157,7 +154,7 @@ void Table::setColumnsAttribute(unsigned def_type)
 		}
 	}
 
-	attributes[ParsersAttributes::COLUMNS]=str_cols;
+	attributes[ParsersAttributes::ID_COLUMNS]=str_cols;
 }
 
 void Table::setConstraintsAttribute(unsigned def_type)
@@ -197,7 +194,7 @@ void Table::setConstraintsAttribute(unsigned def_type)
 		}
 	}
 
-	attributes[ParsersAttributes::CONSTRAINTS]=str_constr;
+	attributes[ParsersAttributes::ID_CONSTRAINTS]=str_constr;
 }
 
 void Table::setTriggersAttribute(unsigned def_type)
@@ -222,7 +219,7 @@ void Table::setTriggersAttribute(unsigned def_type)
 		}
 	}
 
-	attributes[ParsersAttributes::TRIGGERS]=str_trig;
+	attributes[ParsersAttributes::ID_TRIGGERS]=str_trig;
 }
 
 void Table::setIndexesAttribute(unsigned def_type)
@@ -246,7 +243,7 @@ void Table::setIndexesAttribute(unsigned def_type)
 			str_ind+=ind->getCodeDefinition(def_type);
 	}
 
-	attributes[ParsersAttributes::INDEXES]=str_ind;
+	attributes[ParsersAttributes::ID_INDEXES]=str_ind;
 }
 
 void Table::setRulesAttribute(unsigned def_type)
@@ -262,7 +259,7 @@ void Table::setRulesAttribute(unsigned def_type)
 			str_rule+=rules[i]->getCodeDefinition(def_type);
 	}
 
-	attributes[ParsersAttributes::RULES]=str_rule;
+	attributes[ParsersAttributes::ID_RULES]=str_rule;
 }
 
 vector<TableObject *> *Table::getObjectList(ObjectType obj_type)
@@ -345,7 +342,13 @@ void Table::addObject(BaseObject *obj, int obj_idx)
 
 					//Adds the object to the table
 					if(obj_idx < 0 || obj_idx >= static_cast<int>(obj_list->size()))
+					{
 						obj_list->push_back(tab_obj);
+
+						//Appending the object doesn't change the position of the others so the index is only updated
+						if(obj_indexes.count(obj_type) && !invalid_indexes[obj_type])
+							insertObjectIndex(tab_obj, obj_list->size()-1);
+					}
 					else
 					{
 						//If there is a object index specified inserts the object at the position
@@ -353,7 +356,12 @@ void Table::addObject(BaseObject *obj, int obj_idx)
 							obj_list->insert((obj_list->begin() + obj_idx), tab_obj);
 						else
 							obj_list->push_back(tab_obj);
+
+						//Inserting the object changes the position of the subsequent ones
+						invalidateObjectIndex(obj_type);
 					}
+
+					updateObjectReferences(tab_obj);
 				break;
 
 				case OBJ_TABLE:
@@ -531,6 +539,7 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 	{
 		vector<TableObject *> *obj_list=nullptr;
 		vector<TableObject *>::iterator itr;
+		TableObject *tab_obj=nullptr;
 
 		obj_list=getObjectList(obj_type);
 
@@ -541,8 +550,11 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 		if(obj_type!=OBJ_COLUMN)
 		{
 			itr=obj_list->begin() + obj_idx;
-			(*itr)->setParentTable(nullptr);
+			tab_obj=(*itr);
+			tab_obj->setParentTable(nullptr);
+			obj_index_keys.remove(tab_obj);
 			obj_list->erase(itr);
+			updateObjectReferences(tab_obj);
 		}
 		else
 		{
@@ -569,8 +581,14 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 			}
 
 			column->setParentTable(nullptr);
+			obj_index_keys.remove(column);
+			old_name_keys.remove(column);
 			columns.erase(itr);
+			updateObjectReferences(column);
 		}
+
+		//Removing the object changes the position of the subsequent ones
+		invalidateObjectIndex(obj_type);
 	}
 }
 
@@ -753,43 +771,193 @@ int Table::getObjectIndex(BaseObject *obj)
 	}
 }
 
-BaseObject *Table::getObject(const QString &name, ObjectType obj_type)
+void Table::insertObjectIndex(TableObject *tab_obj, int pos)
 {
-	int idx;
-	return(getObject(name, obj_type, idx));
+	QString key=tab_obj->getName();
+
+	obj_indexes[tab_obj->getObjectType()].insert(key, pos);
+	obj_index_keys[tab_obj]=key;
+
+	if(tab_obj->getObjectType()==OBJ_COLUMN)
+	{
+		key=dynamic_cast<Column *>(tab_obj)->getOldName();
+
+		if(!key.isEmpty())
+			old_names_index.insert(key, pos);
+
+		old_name_keys[tab_obj]=key;
+	}
 }
 
-BaseObject *Table::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
+void Table::moveObjectIndex(TableObject *tab_obj, int curr_pos, int new_pos)
 {
-	BaseObject *object=nullptr;
-	bool found=false, format=false;
+	QMultiHash<QString, int> &index=obj_indexes[tab_obj->getObjectType()];
+	QString key=obj_index_keys[tab_obj];
 
-	//Checks if the name contains ", if so, the search will consider formatted names
-	format=name.contains("\"");
+	index.remove(key, curr_pos);
+	index.insert(key, new_pos);
 
-	if(PgModelerNS::isTableObject(obj_type))
+	if(tab_obj->getObjectType()==OBJ_COLUMN)
 	{
-		vector<TableObject *>::iterator itr, itr_end;
-		vector<TableObject *> *obj_list=nullptr;
-		QString aux_name=name;
+		key=old_name_keys[tab_obj];
 
-		obj_list=getObjectList(obj_type);
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
+		if(!key.isEmpty())
+		{
+			old_names_index.remove(key, curr_pos);
+			old_names_index.insert(key, new_pos);
+		}
+	}
+}
 
-		while(itr!=itr_end)
+void Table::createObjectIndex(ObjectType obj_type)
+{
+	vector<TableObject *> *obj_list=getObjectList(obj_type);
+	unsigned i, count;
+
+	obj_indexes[obj_type].clear();
+
+	if(obj_type==OBJ_COLUMN)
+		old_names_index.clear();
+
+	count=obj_list->size();
+	for(i=0; i < count; i++)
+		insertObjectIndex(obj_list->at(i), i);
+
+	invalid_indexes[obj_type]=false;
+}
+
+void Table::invalidateObjectIndex(ObjectType obj_type)
+{
+	invalid_indexes[obj_type]=true;
+}
+
+void Table::updateObjectIndex(BaseObject *object)
+{
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+	ObjectType obj_type;
+
+	if(!tab_obj || !obj_index_keys.contains(tab_obj))
+		return;
+
+	obj_type=tab_obj->getObjectType();
+
+	if(obj_indexes.count(obj_type) && !invalid_indexes[obj_type])
+	{
+		vector<TableObject *> *obj_list=getObjectList(obj_type);
+		QMultiHash<QString, int> &index=obj_indexes[obj_type];
+		QMultiHash<QString, int>::iterator itr;
+		QString prev_key=obj_index_keys[tab_obj], new_key=tab_obj->getName();
+		int pos=-1;
+
+		//Locates the object position using its previous name
+		itr=index.find(prev_key);
+		while(itr!=index.end() && itr.key()==prev_key && pos < 0)
 		{
-			found=((*itr)->getName(format)==aux_name);
-			if(!found) itr++;
-			else break;
+			if(itr.value() < static_cast<int>(obj_list->size()) && obj_list->at(itr.value())==tab_obj)
+				pos=itr.value();
+			itr++;
 		}
 
-		if(found)
+		//If the object isn't found on the index using its previous name the index is recreated in the next search
+		if(pos < 0)
+			invalidateObjectIndex(obj_type);
+		else
+		{
+			if(prev_key!=new_key)
+			{
+				index.remove(prev_key, pos);
+				index.insert(new_key, pos);
+				obj_index_keys[tab_obj]=new_key;
+			}
+
+			if(obj_type==OBJ_COLUMN)
+			{
+				prev_key=old_name_keys[tab_obj];
+				new_key=dynamic_cast<Column *>(tab_obj)->getOldName();
+
+				if(prev_key!=new_key)
+				{
+					if(!prev_key.isEmpty())
+						old_names_index.remove(prev_key, pos);
+
+					if(!new_key.isEmpty())
+						old_names_index.insert(new_key, pos);
+
+					old_name_keys[tab_obj]=new_key;
+				}
+			}
+		}
+	}
+}
+
+void Table::updateObjectReferences(BaseObject *object)
+{
+	DatabaseModel *model=dynamic_cast<DatabaseModel *>(this->getDatabase());
+
+	if(model)
+		model->updateObjectReferences(object);
+}
+
+int Table::searchObjectIndex(const QString &name, ObjectType obj_type, bool old_name)
+{
+	vector<TableObject *> *obj_list=getObjectList(obj_type);
+	QMultiHash<QString, int> *index=nullptr;
+	QMultiHash<QString, int>::iterator itr;
+	QString key=name, obj_name;
+	bool format=name.contains("\"");
+	int pos=-1;
+
+	if(obj_indexes.count(obj_type)==0 || invalid_indexes[obj_type])
+		createObjectIndex(obj_type);
+
+	index=(old_name ? &old_names_index : &obj_indexes[obj_type]);
+
+	/* The index stores the names without quotes so formatted names are searched using the
+		 unformatted form and then compared with the formatted name of the candidates */
+	if(format)
+		key.remove('\"');
+
+	itr=index->find(key);
+	while(itr!=index->end() && itr.key()==key)
+	{
+		if(pos < 0 || itr.value() < pos)
 		{
-			obj_idx=(itr-obj_list->begin());
-			object=(*itr);
+			if(!format)
+				pos=itr.value();
+			else
+			{
+				if(old_name)
+					obj_name=dynamic_cast<Column *>(obj_list->at(itr.value()))->getOldName(true);
+				else
+					obj_name=obj_list->at(itr.value())->getName(true);
+
+				if(obj_name==name)
+					pos=itr.value();
+			}
 		}
-		else obj_idx=-1;
+		itr++;
+	}
+
+	return(pos);
+}
+
+BaseObject *Table::getObject(const QString &name, ObjectType obj_type)
+{
+	int idx;
+	return(getObject(name, obj_type, idx));
+}
+
+BaseObject *Table::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
+{
+	BaseObject *object=nullptr;
+	bool found=false;
+
+	if(PgModelerNS::isTableObject(obj_type))
+	{
+		obj_idx=searchObjectIndex(name, obj_type);
+
+		if(obj_idx >= 0)
+			object=getObjectList(obj_type)->at(obj_idx);
 	}
 	else if(obj_type==OBJ_TABLE)
 	{
@@ -865,24 +1033,13 @@ Column *Table::getColumn(const QString &name, bool ref_old_name)
 	}
 	else
 	{
-		Column *column=nullptr;
-		vector<TableObject *>::iterator itr, itr_end;
-		bool found=false, format=false;
-
-		format=name.contains("\"");
-		itr=columns.begin();
-		itr_end=columns.end();
-
 		//Search the column referencing the old name
-		while(itr!=itr_end && !found)
-		{
-			column=dynamic_cast<Column *>(*itr);
-			itr++;
-			found=(name!="" && column->getOldName(format)==name);
-		}
+		int idx=searchObjectIndex(name, OBJ_COLUMN, true);
 
-		if(!found) column=nullptr;
-		return(column);
+		if(idx < 0)
+			return(nullptr);
+		else
+			return(dynamic_cast<Column *>(columns[idx]));
 	}
 }
 
@@ -1081,11 +1238,11 @@ bool Table::isConstraintRefColumn(Column *column, ConstraintType constr_type)
 
 QString Table::getCodeDefinition(unsigned def_type)
 {
-	attributes[ParsersAttributes::OIDS]=(with_oid ? "1" : "");
-	attributes[ParsersAttributes::COPY_TABLE]="";
+	attributes[ParsersAttributes::ID_OIDS]=(with_oid ? "1" : "");
+	attributes[ParsersAttributes::ID_COPY_TABLE]="";
 
 	if(def_type==SchemaParser::SQL_DEFINITION && copy_table)
-		attributes[ParsersAttributes::COPY_TABLE]=copy_table->getName(true) + copy_op.getSQLDefinition();
+		attributes[ParsersAttributes::ID_COPY_TABLE]=copy_table->getName(true) + copy_op.getSQLDefinition();
 
 	(copy_table ? copy_table->getName(true) : "");
 
@@ -1155,6 +1312,7 @@ void Table::swapObjectsIndexes(ObjectType obj_type, unsigned idx1, unsigned idx2
 				aux_obj=(*itr2);
 				obj_list->erase(itr2);
 				obj_list->insert(obj_list->begin(), aux_obj);
+				invalidateObjectIndex(obj_type);
 			}
 			//If the idx2 is out of bound inserts the element idx1 on the list's end
 			else if(idx2 >= obj_list->size())
@@ -1163,6 +1321,7 @@ void Table::swapObjectsIndexes(ObjectType obj_type, unsigned idx1, unsigned idx2
 				aux_obj=(*itr1);
 				obj_list->erase(itr1);
 				obj_list->push_back(aux_obj);
+				invalidateObjectIndex(obj_type);
 			}
 			else
 			{
@@ -1172,6 +1331,13 @@ void Table::swapObjectsIndexes(ObjectType obj_type, unsigned idx1, unsigned idx2
 
 				(*itr1)=(*itr2);
 				(*itr2)=aux_obj;
+
+				//Only the two objects changed their positions so the index is updated instead of recreated
+				if(obj_indexes.count(obj_type) && !invalid_indexes[obj_type])
+				{
+					moveObjectIndex(obj_list->at(idx1), idx2, idx1);
+					moveObjectIndex(obj_list->at(idx2), idx1, idx2);
+				}
 			}
 		}
 	}
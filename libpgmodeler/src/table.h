@@ -35,6 +35,7 @@
 #include "function.h"
 #include "role.h"
 #include "copyoptions.h"
+#include <QMultiHash>
 
 class Table: public BaseTable {
 	private:
@@ -57,6 +58,39 @@ class Table: public BaseTable {
 		//! \brief Indicates if the table accepts OIDs
 		bool with_oid;
 
+		/*! \brief Indexes used to search child objects by name. Each index maps the object name to its
+		 position on the respective list. A multi hash is used because the same name can be temporarily
+		 used by more than one object (e.g. during renames), in this case the search returns the
+		 object with the lowest position, the same found by a sequential search */
+		map<ObjectType, QMultiHash<QString, int> > obj_indexes;
+
+		//! \brief Index used to search columns by their old names (see getColumn(QString, bool))
+		QMultiHash<QString, int> old_names_index;
+
+		//! \brief Stores the names (and old names for columns) under which each child object is indexed
+		QHash<TableObject *, QString> obj_index_keys, old_name_keys;
+
+		/*! \brief Indicates the indexes that must be recreated on the next search. The columns index
+		 and the old names index are always recreated together */
+		map<ObjectType, bool> invalid_indexes;
+
+		//! \brief Recreates the index of objects by name for the specified type
+		void createObjectIndex(ObjectType obj_type);
+
+		//! \brief Marks the index of the specified type as invalid forcing its recreation in the next search
+		void invalidateObjectIndex(ObjectType obj_type);
+
+		//! \brief Inserts the object on the index of its type (and on the old names index for columns) using the specified position
+		void insertObjectIndex(TableObject *tab_obj, int pos);
+
+		//! \brief Changes the position of the object on the indexes without changing its keys
+		void moveObjectIndex(TableObject *tab_obj, int curr_pos, int new_pos);
+
+		/*! \brief Searches the object position using the index of objects by name or the old names index (old_name=true).
+		 Formatted names (containing quotes) are compared against the formatted names of the objects. Returns -1 when
+		 no object is found */
+		int searchObjectIndex(const QString &name, ObjectType obj_type, bool old_name=false);
+
 		/*! \brief Gets one table ancestor (OBJ_TABLE) or copy (BASE_TABLE) using its name and stores
 		 the index of the found object on parameter 'obj_idx' */
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
@@ -268,6 +302,15 @@ class Table: public BaseTable {
 		//! \brief Returns the specified object type list
 		vector<TableObject *> *getObjectList(ObjectType obj_type);
 
+		/*! \brief Updates the object's name (and old name for columns) on the index of objects by name.
+		 This method is called automatically when the name of a child object changes and must be
+		 called when it is changed by other ways (e.g. copy assignment) */
+		void updateObjectIndex(BaseObject *object);
+
+		/*! \brief Updates the references index of the model that owns the table for the passed child object
+		 (see DatabaseModel::updateObjectReferences()). Tables not owned by a model ignore this call */
+		void updateObjectReferences(BaseObject *object);
+
 		/*! \brief Gets objects which refer to object of the parameter (directly or indirectly) and stores them in a vector.
 		 The 'exclusion_mode' is used to speed up the execution of the method when it is used to validate the
 		 deletion of the object, getting only the first reference to the object candidate for deletion.
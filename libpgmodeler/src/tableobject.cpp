@@ -17,6 +17,7 @@
 */
 
 #include "tableobject.h"
+#include "table.h"
 
 TableObject::TableObject(void)
 {
@@ -34,6 +35,24 @@ BaseTable *TableObject::getParentTable(void)
 	return(parent_table);
 }
 
+void TableObject::updateDatabaseIndex(void)
+{
+	Table *table=dynamic_cast<Table *>(parent_table);
+
+	if(table)
+		table->updateObjectIndex(this);
+
+	BaseObject::updateDatabaseIndex();
+}
+
+void TableObject::updateDatabaseReferences(void)
+{
+	Table *table=dynamic_cast<Table *>(parent_table);
+
+	if(table)
+		table->updateObjectReferences(this);
+}
+
 void TableObject::setAddedByLinking(bool value)
 {
 	add_by_linking=value;
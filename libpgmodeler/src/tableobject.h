@@ -55,6 +55,14 @@ class TableObject: public BaseObject {
 		//! \brief Defines that the object is include by copy relationship
 		void setAddedByCopy(bool value);
 
+		/*! \brief Informs the parent table (when it is a Table) that the name of the object changed
+		 so its index of objects by name can be updated (see Table::updateObjectIndex()) */
+		void updateDatabaseIndex(void);
+
+		/*! \brief Informs the parent table (when it is a Table) that the objects referenced by the object changed
+		 so the references index of the model can be updated (see Table::updateObjectReferences()) */
+		void updateDatabaseReferences(void);
+
 	public:
 		TableObject(void);
 
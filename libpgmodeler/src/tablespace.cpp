@@ -23,7 +23,8 @@ unsigned Tablespace::tabspace_id=10000;
 Tablespace::Tablespace(void)
 {
 	obj_type=OBJ_TABLESPACE;
-	attributes[ParsersAttributes::DIRECTORY]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_DIRECTORY };
+	declareAttributes(class_attribs);
 	object_id=Tablespace::tabspace_id++;
 }
 
@@ -60,7 +61,7 @@ QString Tablespace::getDirectory(void)
 QString Tablespace::getCodeDefinition(unsigned def_type)
 {
 	if(directory!="")
-		attributes[ParsersAttributes::DIRECTORY]="'" + directory + "'";
+		attributes[ParsersAttributes::ID_DIRECTORY]="'" + directory + "'";
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
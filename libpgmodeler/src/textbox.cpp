@@ -22,10 +22,9 @@ Textbox::Textbox(void)
 {
 	obj_type=OBJ_TEXTBOX;
 	text_attributes[0]=text_attributes[1]=text_attributes[2]=false;
-	attributes[ParsersAttributes::ITALIC]="";
-	attributes[ParsersAttributes::BOLD]="";
-	attributes[ParsersAttributes::UNDERLINE]="";
-	attributes[ParsersAttributes::COLOR]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_ITALIC, ParsersAttributes::ID_BOLD, ParsersAttributes::ID_UNDERLINE,
+			ParsersAttributes::ID_COLOR };
+	declareAttributes(class_attribs);
 }
 
 QString Textbox::getCodeDefinition(unsigned def_type)
@@ -37,16 +36,16 @@ QString Textbox::getCodeDefinition(unsigned def_type)
 		setPositionAttribute();
 
 		if(text_attributes[ITALIC_TXT])
-			attributes[ParsersAttributes::ITALIC]="1";
+			attributes[ParsersAttributes::ID_ITALIC]="1";
 
 		if(text_attributes[BOLD_TXT])
-			attributes[ParsersAttributes::BOLD]="1";
+			attributes[ParsersAttributes::ID_BOLD]="1";
 
 		if(text_attributes[UNDERLINE_TXT])
-			attributes[ParsersAttributes::UNDERLINE]="1";
+			attributes[ParsersAttributes::ID_UNDERLINE]="1";
 
 		if(text_color.name()!="#000000")
-			attributes[ParsersAttributes::COLOR]=text_color.name();
+			attributes[ParsersAttributes::ID_COLOR]=text_color.name();
 
 		return(this->BaseObject::__getCodeDefinition(SchemaParser::XML_DEFINITION));
 	}
@@ -32,23 +32,13 @@ Trigger::Trigger(void)
 	for(i=0; i < 4; i++)
 		events[tipos[i]]=false;
 
-	attributes[ParsersAttributes::ARGUMENTS]="";
-	attributes[ParsersAttributes::EVENTS]="";
-	attributes[ParsersAttributes::TRIGGER_FUNC]="";
-	attributes[ParsersAttributes::TABLE]="";
-	attributes[ParsersAttributes::COLUMNS]="";
-	attributes[ParsersAttributes::FIRING_TYPE]="";
-	attributes[ParsersAttributes::PER_ROW]="";
-	attributes[ParsersAttributes::INS_EVENT]="";
-	attributes[ParsersAttributes::DEL_EVENT]="";
-	attributes[ParsersAttributes::UPD_EVENT]="";
-	attributes[ParsersAttributes::TRUNC_EVENT]="";
-	attributes[ParsersAttributes::CONDITION]="";
-	attributes[ParsersAttributes::REF_TABLE]="";
-	attributes[ParsersAttributes::DEFER_TYPE]="";
-	attributes[ParsersAttributes::DEFERRABLE]="";
-	attributes[ParsersAttributes::DECL_IN_TABLE]="";
-	attributes[ParsersAttributes::CONSTRAINT]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_ARGUMENTS, ParsersAttributes::ID_EVENTS, ParsersAttributes::ID_TRIGGER_FUNC,
+			ParsersAttributes::ID_TABLE, ParsersAttributes::ID_COLUMNS, ParsersAttributes::ID_FIRING_TYPE,
+			ParsersAttributes::ID_PER_ROW, ParsersAttributes::ID_INS_EVENT, ParsersAttributes::ID_DEL_EVENT,
+			ParsersAttributes::ID_UPD_EVENT, ParsersAttributes::ID_TRUNC_EVENT, ParsersAttributes::ID_CONDITION,
+			ParsersAttributes::ID_REF_TABLE, ParsersAttributes::ID_DEFER_TYPE, ParsersAttributes::ID_DEFERRABLE,
+			ParsersAttributes::ID_DECL_IN_TABLE, ParsersAttributes::ID_CONSTRAINT };
+	declareAttributes(class_attribs);
 }
 
 void Trigger::addArgument(const QString &arg)
@@ -72,7 +62,7 @@ void Trigger::setArgumentAttribute(unsigned def_type)
 		if(i < (count-1)) str_args+=",";
 	}
 
-	attributes[ParsersAttributes::ARGUMENTS]=str_args;
+	attributes[ParsersAttributes::ID_ARGUMENTS]=str_args;
 }
 
 void Trigger::setFiringType(FiringType firing_type)
@@ -312,13 +302,13 @@ void Trigger::setBasicAttributes(unsigned def_type)
 			if(event_types[i]==EventType::on_update)
 			{
 				count=upd_columns.size();
-				attributes[ParsersAttributes::COLUMNS]="";
+				attributes[ParsersAttributes::ID_COLUMNS]="";
 
 				for(i1=0; i1 < count; i1++)
 				{
-					attributes[ParsersAttributes::COLUMNS]+=upd_columns.at(i1)->getName(true);
+					attributes[ParsersAttributes::ID_COLUMNS]+=upd_columns.at(i1)->getName(true);
 					if(i1 < count-1)
-						attributes[ParsersAttributes::COLUMNS]+=",";
+						attributes[ParsersAttributes::ID_COLUMNS]+=",";
 				}
 			}
 		}
@@ -326,17 +316,17 @@ void Trigger::setBasicAttributes(unsigned def_type)
 
 	if(str_aux!="") str_aux.remove(str_aux.size()-3,3);
 
-	if(def_type==SchemaParser::SQL_DEFINITION && !attributes[ParsersAttributes::COLUMNS].isEmpty())
-		str_aux+=" OF " + attributes[ParsersAttributes::COLUMNS];
+	if(def_type==SchemaParser::SQL_DEFINITION && !attributes[ParsersAttributes::ID_COLUMNS].isEmpty())
+		str_aux+=" OF " + attributes[ParsersAttributes::ID_COLUMNS];
 
-	attributes[ParsersAttributes::EVENTS]=str_aux;
+	attributes[ParsersAttributes::ID_EVENTS]=str_aux;
 
 	if(function)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::TRIGGER_FUNC]=function->getName(true);
+			attributes[ParsersAttributes::ID_TRIGGER_FUNC]=function->getName(true);
 		else
-			attributes[ParsersAttributes::TRIGGER_FUNC]=function->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::ID_TRIGGER_FUNC]=function->getCodeDefinition(def_type, true);
 	}
 }
 
@@ -347,24 +337,24 @@ QString Trigger::getCodeDefinition(unsigned def_type)
 	/* Case the trigger doesn't referece some column added by relationship it will be declared
 		inside the parent table construction by the use of 'decl-in-table' schema attribute */
 	if(!isReferRelationshipAddedColumn())
-		attributes[ParsersAttributes::DECL_IN_TABLE]="1";
+		attributes[ParsersAttributes::ID_DECL_IN_TABLE]="1";
 
 	if(this->parent_table)
-		attributes[ParsersAttributes::TABLE]=this->parent_table->getName(true);
+		attributes[ParsersAttributes::ID_TABLE]=this->parent_table->getName(true);
 
-	attributes[ParsersAttributes::CONSTRAINT]=(is_constraint ? "1" : "");
-	attributes[ParsersAttributes::FIRING_TYPE]=(~firing_type);
+	attributes[ParsersAttributes::ID_CONSTRAINT]=(is_constraint ? "1" : "");
+	attributes[ParsersAttributes::ID_FIRING_TYPE]=(~firing_type);
 
 	//** Constraint trigger MUST execute per row **
-	attributes[ParsersAttributes::PER_ROW]=((is_exec_per_row && !is_constraint) || is_constraint ? "1" : "");
+	attributes[ParsersAttributes::ID_PER_ROW]=((is_exec_per_row && !is_constraint) || is_constraint ? "1" : "");
 
-	attributes[ParsersAttributes::CONDITION]=condition;
+	attributes[ParsersAttributes::ID_CONDITION]=condition;
 
 	if(referenced_table)
 	{
-		attributes[ParsersAttributes::REF_TABLE]=referenced_table->getName(true);
-		attributes[ParsersAttributes::DEFERRABLE]=(is_deferrable ? "1" : "");
-		attributes[ParsersAttributes::DEFER_TYPE]=(~deferral_type);
+		attributes[ParsersAttributes::ID_REF_TABLE]=referenced_table->getName(true);
+		attributes[ParsersAttributes::ID_DEFERRABLE]=(is_deferrable ? "1" : "");
+		attributes[ParsersAttributes::ID_DEFER_TYPE]=(~deferral_type);
 	}
 
 	return(BaseObject::__getCodeDefinition(def_type));
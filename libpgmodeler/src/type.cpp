@@ -23,35 +23,17 @@ Type::Type(void)
 	obj_type=OBJ_TYPE;
 	setConfiguration(ENUMERATION_TYPE);
 
-	BaseObject::attributes[ParsersAttributes::BASE_TYPE]="";
-	BaseObject::attributes[ParsersAttributes::COMPOSITE_TYPE]="";
-	BaseObject::attributes[ParsersAttributes::RANGE_TYPE]="";
-	BaseObject::attributes[ParsersAttributes::TYPE_ATTRIBUTE]="";
-	BaseObject::attributes[ParsersAttributes::ENUM_TYPE]="";
-	BaseObject::attributes[ParsersAttributes::ENUMARATIONS]="";
-	BaseObject::attributes[ParsersAttributes::INPUT_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::OUTPUT_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::RECV_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::SEND_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::TPMOD_IN_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::TPMOD_OUT_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::ANALYZE_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::INTERNAL_LENGHT]="";
-	BaseObject::attributes[ParsersAttributes::BY_VALUE]="";
-	BaseObject::attributes[ParsersAttributes::ALIGNMENT]="";
-	BaseObject::attributes[ParsersAttributes::STORAGE]="";
-	BaseObject::attributes[ParsersAttributes::DEFAULT_VALUE]="";
-	BaseObject::attributes[ParsersAttributes::ELEMENT]="";
-	BaseObject::attributes[ParsersAttributes::DELIMITER]="";
-	BaseObject::attributes[ParsersAttributes::REDUCED_FORM]="";
-	BaseObject::attributes[ParsersAttributes::CATEGORY]="";
-	BaseObject::attributes[ParsersAttributes::PREFERRED]="";
-	BaseObject::attributes[ParsersAttributes::LIKE_TYPE]="";
-	BaseObject::attributes[ParsersAttributes::COLLATABLE]="";
-	BaseObject::attributes[ParsersAttributes::SUBTYPE]="";
-	BaseObject::attributes[ParsersAttributes::SUBTYPE_DIFF_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::CANONICAL_FUNC]="";
-	BaseObject::attributes[ParsersAttributes::OP_CLASS]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_BASE_TYPE, ParsersAttributes::ID_COMPOSITE_TYPE, ParsersAttributes::ID_RANGE_TYPE,
+			ParsersAttributes::ID_TYPE_ATTRIBUTE, ParsersAttributes::ID_ENUM_TYPE, ParsersAttributes::ID_ENUMARATIONS,
+			ParsersAttributes::ID_INPUT_FUNC, ParsersAttributes::ID_OUTPUT_FUNC, ParsersAttributes::ID_RECV_FUNC,
+			ParsersAttributes::ID_SEND_FUNC, ParsersAttributes::ID_TPMOD_IN_FUNC, ParsersAttributes::ID_TPMOD_OUT_FUNC,
+			ParsersAttributes::ID_ANALYZE_FUNC, ParsersAttributes::ID_INTERNAL_LENGHT, ParsersAttributes::ID_BY_VALUE,
+			ParsersAttributes::ID_ALIGNMENT, ParsersAttributes::ID_STORAGE, ParsersAttributes::ID_DEFAULT_VALUE,
+			ParsersAttributes::ID_ELEMENT, ParsersAttributes::ID_DELIMITER, ParsersAttributes::ID_REDUCED_FORM,
+			ParsersAttributes::ID_CATEGORY, ParsersAttributes::ID_PREFERRED, ParsersAttributes::ID_LIKE_TYPE,
+			ParsersAttributes::ID_COLLATABLE, ParsersAttributes::ID_SUBTYPE, ParsersAttributes::ID_SUBTYPE_DIFF_FUNC,
+			ParsersAttributes::ID_CANONICAL_FUNC, ParsersAttributes::ID_OP_CLASS };
+	declareAttributes(class_attribs);
 }
 
 Type::~Type(void)
@@ -404,7 +386,7 @@ void Type::setElementsAttribute(unsigned def_type)
 	if(def_type==SchemaParser::SQL_DEFINITION)
 		str_elem.remove(str_elem.lastIndexOf(','), str_elem.size());
 
-	BaseObject::attributes[ParsersAttributes::TYPE_ATTRIBUTE]=str_elem;
+	BaseObject::attributes[ParsersAttributes::ID_TYPE_ATTRIBUTE]=str_elem;
 }
 
 void Type::setEnumerationsAttribute(unsigned def_type)
@@ -423,7 +405,7 @@ void Type::setEnumerationsAttribute(unsigned def_type)
 		if(i < (count-1)) str_enum+=",";
 	}
 
-	BaseObject::attributes[ParsersAttributes::ENUMARATIONS]=str_enum;
+	BaseObject::attributes[ParsersAttributes::ID_ENUMARATIONS]=str_enum;
 }
 
 void Type::setCategory(CategoryType categ)
@@ -581,56 +563,58 @@ QString Type::getCodeDefinition(unsigned def_type)
 
 QString Type::getCodeDefinition(unsigned def_type, bool reduced_form)
 {
+	QMutexLocker locker(&code_gen_mutex);
+
 	if(config==ENUMERATION_TYPE)
 	{
-		BaseObject::attributes[ParsersAttributes::ENUM_TYPE]="1";
+		BaseObject::attributes[ParsersAttributes::ID_ENUM_TYPE]="1";
 		setEnumerationsAttribute(def_type);
 	}
 	else if(config==COMPOSITE_TYPE)
 	{
-		BaseObject::attributes[ParsersAttributes::COMPOSITE_TYPE]="1";
+		BaseObject::attributes[ParsersAttributes::ID_COMPOSITE_TYPE]="1";
 		setElementsAttribute(def_type);
 	}
 	else if(config==RANGE_TYPE)
 	{
-		BaseObject::attributes[ParsersAttributes::RANGE_TYPE]="1";
-		BaseObject::attributes[ParsersAttributes::SUBTYPE]=(*subtype);
+		BaseObject::attributes[ParsersAttributes::ID_RANGE_TYPE]="1";
+		BaseObject::attributes[ParsersAttributes::ID_SUBTYPE]=(*subtype);
 
 		if(subtype_opclass)
 		{
 			if(def_type==SchemaParser::SQL_DEFINITION)
-				BaseObject::attributes[ParsersAttributes::OP_CLASS]=subtype_opclass->getName(true);
+				BaseObject::attributes[ParsersAttributes::ID_OP_CLASS]=subtype_opclass->getName(true);
 			else
-				BaseObject::attributes[ParsersAttributes::OP_CLASS]=subtype_opclass->getCodeDefinition(def_type, true);
+				BaseObject::attributes[ParsersAttributes::ID_OP_CLASS]=subtype_opclass->getCodeDefinition(def_type, true);
 		}
 	}
 	else
 	{
-		BaseObject::attributes[ParsersAttributes::BASE_TYPE]="1";
+		BaseObject::attributes[ParsersAttributes::ID_BASE_TYPE]="1";
 
 		if(internal_len==0 && def_type==SchemaParser::SQL_DEFINITION)
-			BaseObject::attributes[ParsersAttributes::INTERNAL_LENGHT]="VARIABLE";
+			BaseObject::attributes[ParsersAttributes::ID_INTERNAL_LENGHT]="VARIABLE";
 		else
-			BaseObject::attributes[ParsersAttributes::INTERNAL_LENGHT]=QString("%1").arg(internal_len);
+			BaseObject::attributes[ParsersAttributes::ID_INTERNAL_LENGHT]=QString("%1").arg(internal_len);
 
-		BaseObject::attributes[ParsersAttributes::BY_VALUE]=(by_value ? "1" : "");
-		BaseObject::attributes[ParsersAttributes::ALIGNMENT]=(*alignment);
-		BaseObject::attributes[ParsersAttributes::STORAGE]=(~storage);
-		BaseObject::attributes[ParsersAttributes::DEFAULT_VALUE]=default_value;
+		BaseObject::attributes[ParsersAttributes::ID_BY_VALUE]=(by_value ? "1" : "");
+		BaseObject::attributes[ParsersAttributes::ID_ALIGNMENT]=(*alignment);
+		BaseObject::attributes[ParsersAttributes::ID_STORAGE]=(~storage);
+		BaseObject::attributes[ParsersAttributes::ID_DEFAULT_VALUE]=default_value;
 
 		if(element!="any")
-			BaseObject::attributes[ParsersAttributes::ELEMENT]=(*element);
+			BaseObject::attributes[ParsersAttributes::ID_ELEMENT]=(*element);
 
 		if(delimiter!='\0')
-			BaseObject::attributes[ParsersAttributes::DELIMITER]=delimiter;
+			BaseObject::attributes[ParsersAttributes::ID_DELIMITER]=delimiter;
 
-		BaseObject::attributes[ParsersAttributes::CATEGORY]=~(category);
+		BaseObject::attributes[ParsersAttributes::ID_CATEGORY]=~(category);
 
-		BaseObject::attributes[ParsersAttributes::PREFERRED]=(preferred ? "1" : "");
-		BaseObject::attributes[ParsersAttributes::COLLATABLE]=(collatable ? "1" : "");
+		BaseObject::attributes[ParsersAttributes::ID_PREFERRED]=(preferred ? "1" : "");
+		BaseObject::attributes[ParsersAttributes::ID_COLLATABLE]=(collatable ? "1" : "");
 
 		if(like_type!="any")
-			BaseObject::attributes[ParsersAttributes::LIKE_TYPE]=(*like_type);
+			BaseObject::attributes[ParsersAttributes::ID_LIKE_TYPE]=(*like_type);
 	}
 
 	if(config==BASE_TYPE || config==RANGE_TYPE)
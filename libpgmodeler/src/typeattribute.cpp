@@ -36,18 +36,18 @@ PgSQLType TypeAttribute::getType(void)
 QString TypeAttribute::getCodeDefinition(unsigned def_type)
 {
 	if(def_type==SchemaParser::SQL_DEFINITION)
-		attributes[ParsersAttributes::NAME]=BaseObject::formatName(obj_name);
+		attributes[ParsersAttributes::ID_NAME]=BaseObject::formatName(obj_name);
 	else
-		attributes[ParsersAttributes::NAME]=obj_name;
+		attributes[ParsersAttributes::ID_NAME]=obj_name;
 
-	attributes[ParsersAttributes::TYPE]=type.getCodeDefinition(def_type);
+	attributes[ParsersAttributes::ID_TYPE]=type.getCodeDefinition(def_type);
 
 	if(collation)
 	{
 		if(def_type==SchemaParser::SQL_DEFINITION)
-			attributes[ParsersAttributes::COLLATION]=collation->getName(true);
+			attributes[ParsersAttributes::ID_COLLATION]=collation->getName(true);
 		else
-			attributes[ParsersAttributes::COLLATION]=collation->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::ID_COLLATION]=collation->getCodeDefinition(def_type, true);
 	}
 
 	return(BaseObject::__getCodeDefinition(def_type));
@@ -21,14 +21,10 @@
 View::View(void) : BaseTable()
 {
 	obj_type=OBJ_VIEW;
-	attributes[ParsersAttributes::DECLARATION]="";
-	attributes[ParsersAttributes::REFERENCES]="";
-	attributes[ParsersAttributes::SELECT_EXP]="";
-	attributes[ParsersAttributes::FROM_EXP]="";
-	attributes[ParsersAttributes::SIMPLE_EXP]="";
-	attributes[ParsersAttributes::CTE_EXPRESSION]="";
-	attributes[ParsersAttributes::TRIGGERS]="";
-	attributes[ParsersAttributes::RULES]="";
+	static const vector<unsigned> class_attribs={ ParsersAttributes::ID_DECLARATION, ParsersAttributes::ID_REFERENCES, ParsersAttributes::ID_SELECT_EXP,
+			ParsersAttributes::ID_FROM_EXP, ParsersAttributes::ID_SIMPLE_EXP, ParsersAttributes::ID_CTE_EXPRESSION,
+			ParsersAttributes::ID_TRIGGERS, ParsersAttributes::ID_RULES };
+	declareAttributes(class_attribs);
 }
 
 View::~View(void)
@@ -387,22 +383,22 @@ void View::setDeclarationAttribute(void)
 		}
 	}
 
-	attributes[ParsersAttributes::DECLARATION]=decl;
+	attributes[ParsersAttributes::ID_DECLARATION]=decl;
 }
 
 void View::setReferencesAttribute(void)
 {
 	QString str_aux;
-	QString attribs[]={ ParsersAttributes::SELECT_EXP,
-											ParsersAttributes::FROM_EXP,
-											ParsersAttributes::SIMPLE_EXP };
+	unsigned attribs[]={ ParsersAttributes::ID_SELECT_EXP,
+											ParsersAttributes::ID_FROM_EXP,
+											ParsersAttributes::ID_SIMPLE_EXP };
 	vector<unsigned> *vect_exp[]={&exp_select, &exp_from, &exp_where};
 	int qtd, i, i1;
 
 	qtd=references.size();
 	for(i=0; i < qtd; i++)
 		str_aux+=references[i].getXMLDefinition();
-	attributes[ParsersAttributes::REFERENCES]=str_aux;
+	attributes[ParsersAttributes::ID_REFERENCES]=str_aux;
 
 	for(i=0; i < 3; i++)
 	{
@@ -469,7 +465,7 @@ QString View::getCodeDefinition(unsigned def_type)
 {
 	unsigned count, i;
 
-	attributes[ParsersAttributes::CTE_EXPRESSION]=cte_expression;
+	attributes[ParsersAttributes::ID_CTE_EXPRESSION]=cte_expression;
 
 	if(def_type==SchemaParser::SQL_DEFINITION)
 		setDeclarationAttribute();
@@ -481,11 +477,11 @@ QString View::getCodeDefinition(unsigned def_type)
 
 	count=triggers.size();
 	for(i=0; i < count; i++)
-		attributes[ParsersAttributes::TRIGGERS]+=triggers[i]->getCodeDefinition(def_type);
+		attributes[ParsersAttributes::ID_TRIGGERS]+=triggers[i]->getCodeDefinition(def_type);
 
 	count=rules.size();
 	for(i=0; i < count; i++)
-		attributes[ParsersAttributes::RULES]+=rules[i]->getCodeDefinition(def_type);
+		attributes[ParsersAttributes::ID_RULES]+=rules[i]->getCodeDefinition(def_type);
 
 
 	return(BaseObject::__getCodeDefinition(def_type));
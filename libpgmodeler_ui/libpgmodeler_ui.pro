@@ -69,6 +69,8 @@ SOURCES += src/mainwindow.cpp \
 	   src/modelexporthelper.cpp \
 	   src/modelvalidationwidget.cpp \
 	   src/modelvalidationhelper.cpp \
+	   src/referencesvalidationtask.cpp \
+	   src/dbmsexporttask.cpp \
 	   src/validationinfo.cpp \
 	   src/extensionwidget.cpp \
 	   src/objectfinderwidget.cpp
@@ -131,6 +133,8 @@ HEADERS += src/mainwindow.h \
 	   src/modelexporthelper.h \
 	   src/modelvalidationwidget.h \
 	   src/modelvalidationhelper.h \
+	   src/referencesvalidationtask.h \
+	   src/dbmsexporttask.h \
 	   src/validationinfo.h \
 	   src/extensionwidget.h \
 	   src/objectfinderwidget.h
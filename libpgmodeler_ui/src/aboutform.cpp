@@ -23,5 +23,15 @@ AboutForm::AboutForm(QWidget *parent) : QWidget(parent)
 	setupUi(this);
 	pgmodeler_ver_lbl->setText(QString("v%1").arg(GlobalAttributes::PGMODELER_VERSION));
 	code_name_lbl->setText(QString(" « %1 »").arg(GlobalAttributes::PGMODELER_VER_CODENAME));
+	connect(profile_btn, SIGNAL(toggled(bool)), this, SLOT(showProfilingData(bool)));
+}
+
+void AboutForm::showProfilingData(bool show)
+{
+	if(show)
+		profile_txt->setPlainText(Profiler::getReport());
+
+	frame->setVisible(!show);
+	profile_txt->setVisible(show);
 }
 
@@ -19,7 +19,8 @@
 /**
 \ingroup libpgmodeler_ui
 \class AboutForm
-\brief Form that contains information about software authoring and licensing.
+\brief Form that contains information about software authoring and licensing. It also shows the
+ profiling data collected since the application started.
 */
 
 #ifndef ABOUT_FORM_H
@@ -28,6 +29,7 @@
 #include <QWidget>
 #include "ui_aboutform.h"
 #include "globalattributes.h"
+#include "profiler.h"
 
 class AboutForm: public QWidget, public Ui::AboutForm {
 	private:
@@ -35,6 +37,10 @@ class AboutForm: public QWidget, public Ui::AboutForm {
 
 	public:
 		AboutForm(QWidget *parent = 0);
+
+	private slots:
+		//! \brief Toggles the display of the profiling data (see Profiler) in place of the authoring information
+		void showProfilingData(bool show);
 };
 
 #endif
@@ -728,8 +728,16 @@ void BaseObjectWidget::finishConfiguration(void)
 				this->object->getCodeDefinition(SchemaParser::SQL_DEFINITION);
 			else
 				this->object->getCodeDefinition(SchemaParser::XML_DEFINITION);
+
+			//The modified object may reference other objects so the references index of the model is updated
+			if(model)
+				model->updateObjectReferences(this->object);
 		}
 
+		//Objects added or modified on relationships change the references done by them
+		if(model && relationship)
+			model->updateObjectReferences(relationship);
+
 		this->accept();
 		parent_form->hide();
 
@@ -316,7 +316,9 @@ void ConnectionsConfigWidget::testConnection(void)
 	try
 	{
 		this->configureConnection(&conn);
-		conn.connect();
+
+		//The pool isn't used otherwise an idle connection would be reported as success without contacting the server
+		conn.connect(false);
 		msg_box.show(trUtf8("Success"), trUtf8("Connection successfuly stablished!"), Messagebox::INFO_ICON);
 	}
 	catch(Exception &e)
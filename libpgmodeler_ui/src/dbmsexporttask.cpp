@@ -0,0 +1,186 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "dbmsexporttask.h"
+#include "modelexporthelper.h"
+#include <QThread>
+
+const unsigned DBMSExportTask::MAX_RETRIES=3;
+
+DBMSExportTask::DBMSExportTask(ModelExportHelper *helper, DBConnection &conn, const vector<vector<QString> > &units,
+															 QAtomicInt &next_unit, QAtomicInt &aborted, unsigned chunk_size)
+{
+	this->helper=helper;
+	this->conn=&conn;
+	this->units=&units;
+	this->next_unit=&next_unit;
+	this->aborted=&aborted;
+	this->chunk_size=(chunk_size==0 ? 1 : chunk_size);
+	this->error_idx=-1;
+
+	//The task is destroyed by the export helper after collecting the results
+	setAutoDelete(false);
+}
+
+void DBMSExportTask::run(void)
+{
+	int idx, end, i, count=units->size();
+	vector<QString> cmds;
+	vector<unsigned> cmd_units;
+	vector<QString>::const_iterator itr, itr_end;
+
+	while(aborted->load()==0)
+	{
+		idx=next_unit->fetchAndAddOrdered(chunk_size);
+		if(idx >= count) break;
+
+		end=min(idx + static_cast<int>(chunk_size), count);
+		cmds.clear();
+		cmd_units.clear();
+
+		for(i=idx; i < end; i++)
+		{
+			itr=units->at(i).begin();
+			itr_end=units->at(i).end();
+
+			while(itr!=itr_end)
+			{
+				cmds.push_back(*itr);
+				cmd_units.push_back(i);
+				itr++;
+			}
+		}
+
+		executeCommands(cmds, cmd_units);
+	}
+}
+
+void DBMSExportTask::executeCommands(const vector<QString> &cmds, const vector<unsigned> &cmd_units)
+{
+	unsigned pos=0, failed=0, exec_cnt=0, i, count=cmds.size(), retries=0;
+	vector<QString> batch;
+
+	while(pos < count && aborted->load()==0)
+	{
+		batch.clear();
+
+		//Commands that can't run inside a transaction block are executed alone
+		if(ModelExportHelper::isConcurrentIndex(cmds[pos]))
+			batch.push_back(cmds[pos]);
+		else
+		{
+			for(i=pos; i < count && !ModelExportHelper::isConcurrentIndex(cmds[i]); i++)
+				batch.push_back(cmds[i]);
+		}
+
+		try
+		{
+			if(batch.size()==1)
+			{
+				exec_cnt=0;
+				conn->executeDDLCommand(batch[0]);
+			}
+			else
+				conn->executeDDLCommands(batch, exec_cnt);
+
+			pos+=batch.size();
+			retries=0;
+		}
+		catch(Exception &e)
+		{
+			failed=pos + exec_cnt;
+
+			if(helper->isIgnoredError(e))
+			{
+				ignored_errors.push_back(e);
+				pos=failed + 1;
+			}
+			/* Deadlocks happen when two connections lock the same tables in opposite order (e.g. indexes and
+				 foreign keys of the same tables created at the same time). The commands before the failed one were
+				 committed and the locks released, so the execution is resumed from the failed command after a
+				 short pause. If the command keeps failing its object is created later using a single connection */
+			else if(isTransientError(e) && retries < MAX_RETRIES)
+			{
+				retries++;
+				pos=failed;
+				QThread::msleep(50 * retries);
+			}
+			else if(isMissingDependency(e) || isTransientError(e))
+			{
+				//The failed command and the remaining ones of the same object are executed later
+				pos=failed;
+				while(pos < count && cmd_units[pos]==cmd_units[failed])
+					pos++;
+
+				deferred_units.push_back(cmd_units[failed]);
+				deferred_cmds.push_back(vector<QString>(cmds.begin() + failed, cmds.begin() + pos));
+			}
+			else
+			{
+				error_idx=cmd_units[failed];
+				error=Exception(Exception::getErrorMessage(ERR_EXPORT_FAILURE).arg(Utf8String::create(cmds[failed])),
+												ERR_EXPORT_FAILURE,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, cmds[failed]);
+				aborted->store(1);
+			}
+		}
+	}
+}
+
+bool DBMSExportTask::isTransientError(Exception &e)
+{
+	/* Error codes raised when the transaction is aborted by the server due to concurrent transactions
+			40P01 	deadlock_detected
+			40001 	serialization_failure */
+	static const QStringList err_codes={"40P01", "40001"};
+
+	return(err_codes.contains(e.getExtraInfo()));
+}
+
+bool DBMSExportTask::isMissingDependency(Exception &e)
+{
+	/* Error codes raised when a referenced object does not exist
+			3F000 	invalid_schema_name
+			42703 	undefined_column
+			42883 	undefined_function
+			42P01 	undefined_table
+			42704 	undefined_object */
+	static const QStringList err_codes={"3F000", "42703", "42883", "42P01", "42704"};
+
+	return(err_codes.contains(e.getExtraInfo()));
+}
+
+int DBMSExportTask::getErrorIndex(void)
+{
+	return(error_idx);
+}
+
+Exception DBMSExportTask::getError(void)
+{
+	return(error);
+}
+
+vector<Exception> DBMSExportTask::getIgnoredErrors(void)
+{
+	return(ignored_errors);
+}
+
+void DBMSExportTask::getDeferredUnits(vector<unsigned> &unit_idxs, vector<vector<QString> > &cmds)
+{
+	unit_idxs=deferred_units;
+	cmds=deferred_cmds;
+}
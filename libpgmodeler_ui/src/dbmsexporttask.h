@@ -0,0 +1,110 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class DBMSExportTask
+\brief Implements a worker used by ModelExportHelper to create the objects of the same dependency level
+ at the same time using several connections. Each task picks the next objects not yet created from a shared
+ list and executes their commands in batches on its own connection. Objects that fail because they depend on
+ objects not created yet (dependencies not known by the model) or that keep being aborted by deadlocks with the
+ other tasks are stored to be created later.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef DBMS_EXPORT_TASK_H
+#define DBMS_EXPORT_TASK_H
+
+#include <QRunnable>
+#include <QAtomicInt>
+#include <vector>
+#include "dbconnection.h"
+
+class ModelExportHelper;
+
+class DBMSExportTask: public QRunnable {
+	private:
+		//! \brief Maximum amount of times a command aborted by a deadlock is executed again
+		static const unsigned MAX_RETRIES;
+
+		//! \brief Helper that started the export (used to check the ignored errors)
+		ModelExportHelper *helper;
+
+		//! \brief Connection used exclusively by the task
+		DBConnection *conn;
+
+		//! \brief Commands of each object to be created
+		const vector<vector<QString> > *units;
+
+		//! \brief Index of the next object to be created (shared between all tasks)
+		QAtomicInt *next_unit;
+
+		//! \brief Flag shared between all tasks indicating that one of them failed and the others must stop
+		QAtomicInt *aborted;
+
+		//! \brief Amount of objects picked from the list at once (their commands are executed in a single batch)
+		unsigned chunk_size;
+
+		//! \brief Errors ignored by the export configuration
+		vector<Exception> ignored_errors;
+
+		//! \brief Positions of the objects that must be created later
+		vector<unsigned> deferred_units;
+
+		//! \brief Commands not executed of each deferred object
+		vector<vector<QString> > deferred_cmds;
+
+		//! \brief Position of the object that raised an error (-1 when no error occurred)
+		int error_idx;
+
+		//! \brief Error raised when creating the object at 'error_idx'
+		Exception error;
+
+		/*! \brief Returns if the error was raised because the command references an object that does not
+		 exist yet, which means that it can succeed when executed after the other objects */
+		static bool isMissingDependency(Exception &e);
+
+		/*! \brief Returns if the error was raised because the command conflicted with the commands executed
+		 by another task (deadlock or serialization failure), which means that it can succeed when executed again */
+		static bool isTransientError(Exception &e);
+
+		/*! \brief Executes the commands in batches. The 'cmd_units' vector stores the position of the
+		 object that owns each command */
+		void executeCommands(const vector<QString> &cmds, const vector<unsigned> &cmd_units);
+
+	public:
+		DBMSExportTask(ModelExportHelper *helper, DBConnection &conn, const vector<vector<QString> > &units,
+									 QAtomicInt &next_unit, QAtomicInt &aborted, unsigned chunk_size);
+
+		//! \brief Creates the objects until the list ends or another task fails
+		void run(void);
+
+		//! \brief Returns the position of the object that raised an error (-1 when no error occurred)
+		int getErrorIndex(void);
+
+		//! \brief Returns the error raised by the task
+		Exception getError(void);
+
+		//! \brief Returns the errors ignored by the task
+		vector<Exception> getIgnoredErrors(void);
+
+		//! \brief Stores the positions and the remaining commands of the objects that must be created later
+		void getDeferredUnits(vector<unsigned> &unit_idxs, vector<vector<QString> > &cmds);
+};
+
+#endif
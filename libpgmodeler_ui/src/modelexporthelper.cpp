@@ -1,14 +1,60 @@
 #include "modelexporthelper.h"
 
+const QString ModelExportHelper::DEFAULT_SCRATCH_DB="pgmodeler_scratch";
+const QString ModelExportHelper::SCRATCH_DB_COMMENT="pgModeler scratch database";
+QString ModelExportHelper::scratch_db=ModelExportHelper::DEFAULT_SCRATCH_DB;
+
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
 	sql_gen_progress=progress=0;
 	db_created=false;
 	created_objs[OBJ_ROLE]=created_objs[OBJ_TABLESPACE]=-1;
+	ddl_batch_size=DEFAULT_DDL_BATCH_SIZE;
+	ignore_dup=in_transaction=store_stmts=false;
+	export_conn=nullptr;
+	export_conns=1;
+}
+
+void ModelExportHelper::setExportConnections(unsigned conn_cnt)
+{
+	export_conns=(conn_cnt==0 ? 1 : conn_cnt);
+}
+
+void ModelExportHelper::setDDLBatchSize(unsigned size)
+{
+	ddl_batch_size=(size==0 ? 1 : size);
+}
+
+void ModelExportHelper::setScratchDatabase(const QString &db_name)
+{
+	scratch_db=(db_name.isEmpty() ? DEFAULT_SCRATCH_DB : db_name);
+}
+
+QString ModelExportHelper::getScratchDatabase(void)
+{
+	return(scratch_db);
+}
+
+bool ModelExportHelper::isConcurrentIndex(const QString &cmd)
+{
+	//Only the CONCURRENTLY option right after CREATE [UNIQUE] INDEX is considered (the command can start with comments)
+	QRegExp regexp("^(\\s*--[^\\n]*\\n)*\\s*CREATE\\s+(UNIQUE\\s+)?INDEX\\s+CONCURRENTLY\\b", Qt::CaseInsensitive);
+	return(regexp.indexIn(cmd) >= 0);
+}
+
+QString ModelExportHelper::removeConcurrentOption(const QString &cmd)
+{
+	QRegExp regexp("^((\\s*--[^\\n]*\\n)*\\s*CREATE\\s+(UNIQUE\\s+)?INDEX\\s+)CONCURRENTLY\\s+", Qt::CaseInsensitive);
+	QString code=cmd;
+
+	return(code.replace(regexp, QString("\\1")));
 }
 
 void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver)
 {
+	static Profiler::Entry *export_tm=Profiler::getTimer("export.sql-file");
+	Profiler::Timer export_timer(export_tm);
+
 	if(!db_model)
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
@@ -33,6 +79,9 @@ void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &file
 
 void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim)
 {
+	static Profiler::Entry *export_tm=Profiler::getTimer("export.png");
+	Profiler::Timer export_timer(export_tm);
+
 	if(!scene)
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
@@ -84,53 +133,41 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, DBConnection &conn, const QString &pgsql_ver, bool ignore_dup, bool simulate)
 {
 	int type_id;
-	QString  version, sql_buf, sql_cmd, lin;
+	QString sql_cmd;
 	DBConnection new_db_conn;
 	unsigned i, count;
 	ObjectType types[]={OBJ_ROLE, OBJ_TABLESPACE};
 	BaseObject *object=nullptr;
-	vector<Exception> errors;
-	QTextStream ts;
-	bool ddl_tk_found=false;
-
-	/* Error codes treated in this method
-			42P04 	duplicate_database
-			42723 	duplicate_function
-			42P06 	duplicate_schema
-			42P07 	duplicate_table
-			42710 	duplicate_object
-
-		 Reference:
-			http://www.postgresql.org/docs/current/static/errcodes-appendix.html*/
-	QString error_codes[]={"42P04", "42723", "42P06", "42P07", "42710"};
-	vector<QString> err_codes_vect(error_codes, error_codes + sizeof(error_codes) / sizeof(QString));
+	bool create_tabspcs=false;
+	static Profiler::Entry *export_tm=Profiler::getTimer("export.dbms");
+	Profiler::Timer export_timer(export_tm);
 
 	if(!db_model)
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	/* Tablespaces can't be created inside a transaction block so the simulation is made inside a transaction
+		 only when no tablespace must be created, otherwise the objects are created and then dropped */
+	count=db_model->getObjectCount(OBJ_TABLESPACE);
+	for(i=0; i < count && !create_tabspcs; i++)
+		create_tabspcs=!db_model->getObject(i, OBJ_TABLESPACE)->isSQLDisabled();
+
+	if(simulate && !create_tabspcs)
+	{
+		simulateDBMSExport(db_model, conn, pgsql_ver, ignore_dup);
+		return;
+	}
+
 	connect(db_model, SIGNAL(s_objectLoaded(int,QString,uint)), this, SLOT(updateProgress(int,QString,uint)));
 
 	try
 	{
 		db_created=false;
+		this->ignore_dup=ignore_dup;
+		export_errors.clear();
 		progress=sql_gen_progress=0;
 		created_objs[OBJ_ROLE]=created_objs[OBJ_TABLESPACE]=-1;
 		conn.connect();
-
-		//Retrive the DBMS version in order to generate the correct code
-		version=(conn.getDBMSVersion()).mid(0,3);
-
-		//Overriding the DBMS version case the version is informed on parameter
-		if(!pgsql_ver.isEmpty())
-		{
-			SchemaParser::setPgSQLVersion(pgsql_ver);
-			emit s_progressUpdated(progress, trUtf8("PostgreSQL version detection overrided. Using version %1...").arg(pgsql_ver));
-		}
-		else
-		{
-			SchemaParser::setPgSQLVersion(version);
-			emit s_progressUpdated(progress, trUtf8("PostgreSQL %1 server detected...").arg(version));
-		}
+		configurePgSQLVersion(conn, pgsql_ver);
 
 		if(ignore_dup)
 			emit s_progressUpdated(progress, trUtf8("Ignoring object duplication error..."));
@@ -161,14 +198,12 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, DBConnection &conn
 				{
 					/* Raises an error if the object is duplicated and the ignore duplicity is not set or the error
 					returned by the server is other than object duplicity */
-					if(!ignore_dup ||
-						 (ignore_dup &&
-							std::find(err_codes_vect.begin(), err_codes_vect.end(), e.getExtraInfo())==err_codes_vect.end()))
+					if(!isIgnoredError(e))
 						throw Exception(e.getErrorMessage(),
 														e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, sql_cmd);
 					else
 						//If the object is duplicated store the error on a vector
-						errors.push_back(e);
+						export_errors.push_back(e);
 				}
 
 				created_objs[types[type_id]]++;
@@ -190,13 +225,11 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, DBConnection &conn
 		{
 			/* Raises an error if the object is duplicated and the ignore duplicity is not set or the error
 			returned by the server is other than object duplicity */
-			if(!ignore_dup ||
-				 (ignore_dup &&
-					std::find(err_codes_vect.begin(), err_codes_vect.end(), e.getExtraInfo())==err_codes_vect.end()))
+			if(!isIgnoredError(e))
 				throw Exception(e.getErrorMessage(),
 												e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, sql_cmd);
 			else
-				errors.push_back(e);
+				export_errors.push_back(e);
 		}
 
 		//Connects to the new created database to create the other objects
@@ -210,63 +243,35 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, DBConnection &conn
 		//Creating the other object types
 		emit s_progressUpdated(progress, trUtf8("Creating objects on database '%1'...").arg(Utf8String::create(db_model->getName())));
 
-		//Generates the sql from entire model
-		sql_buf=db_model->getCodeDefinition(SchemaParser::SQL_DEFINITION, false);
+		/* The commands are executed in batches as soon as they are generated, so the model's code doesn't
+			 need to be stored nor reparsed (see handleStatement()) */
+		export_conn=&new_db_conn;
+		ddl_batch.clear();
 
-		/* Extract each SQL command from the buffer and execute them separately. This is done
-			 to permit the user, in case of error, identify what object is wrongly configured. */
-		ts.setString(&sql_buf);
-		i=1;
-		progress+=(sql_gen_progress/progress);
-		sql_cmd.clear();
-
-		while(!ts.atEnd())
+		if(export_conns > 1)
 		{
-			try
-			{
-				//Cleanup single line comments
-				lin=ts.readLine();
-				ddl_tk_found=(lin.indexOf(ParsersAttributes::DDL_END_TOKEN) >= 0);
-				lin.remove(QRegExp("^(--)+(.)+$"));
-
-				//If the line isn't empty after cleanup it will be included on sql command
-				if(!lin.isEmpty())
-					sql_cmd += lin + "\n";
-
-				//If the ddl end token is found
-				if(ddl_tk_found)
-				{
-					//sql_cmd.remove(ParsersAttributes::DDL_END_TOKEN);
-					sql_cmd.simplified();
-
-					//Executes the extracted SQL command
-					if(!sql_cmd.isEmpty())
-						new_db_conn.executeDDLCommand(sql_cmd);
-
-					ddl_tk_found=false;
-					sql_cmd.clear();
-					i++;
-					emit s_progressUpdated(progress + (i/progress),
-																 trUtf8("Creating objects on database '%1'...").arg(Utf8String::create(db_model->getName())));
-				}
-			}
-			catch(Exception &e)
-			{
-				if(!ignore_dup ||
-					 (ignore_dup &&
-						std::find(err_codes_vect.begin(), err_codes_vect.end(), e.getExtraInfo())==err_codes_vect.end()))
-					throw Exception(Exception::getErrorMessage(ERR_EXPORT_FAILURE).arg(Utf8String::create(sql_cmd)),
-													ERR_EXPORT_FAILURE,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, sql_cmd);
-				else
-					errors.push_back(e);
-			}
+			//All the statements are needed to know the dependency levels so they are executed after the generation
+			store_stmts=true;
+			db_model->generateSQLStatements(*this);
+			store_stmts=false;
+			exportInParallel(new_db_conn);
 		}
+		else
+		{
+			db_model->generateSQLStatements(*this);
+			executeDDLBatch();
+		}
+
+		export_conn=nullptr;
 
 		disconnect(db_model, nullptr, this, nullptr);
 
 		//Closes the new opened connection
 		if(new_db_conn.isStablished()) new_db_conn.close();
 
+		//The idle connections to the new database aren't kept since they would prevent its removal
+		ConnectionPool::clear(db_model->getName());
+
 		/* If the process was a simulation undo the export
 		removing the created objects */
 		if(simulate)
@@ -275,21 +280,414 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, DBConnection &conn
 	catch(Exception &e)
 	{
 		disconnect(db_model, nullptr, this, nullptr);
+		export_conn=nullptr;
+		store_stmts=false;
+		export_stmts.clear();
+		ddl_batch.clear();
 
 		//Closes the new opened connection
 		if(new_db_conn.isStablished()) new_db_conn.close();
+		ConnectionPool::clear(db_model->getName());
 
 		//Undo the export removing the created objects
 		undoDBMSExport(db_model, conn);
 
 		//Redirects any error to the user
-		if(errors.empty())
+		if(export_errors.empty())
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		else
+		{
+			export_errors.push_back(e);
+			throw Exception(e.getErrorMessage(),__PRETTY_FUNCTION__,__FILE__,__LINE__, export_errors);
+		}
+	}
+}
+
+void ModelExportHelper::simulateDBMSExport(DatabaseModel *db_model, DBConnection &conn, const QString &pgsql_ver, bool ignore_dup)
+{
+	unsigned i, count;
+	BaseObject *object=nullptr;
+	DBConnection scratch_conn;
+
+	connect(db_model, SIGNAL(s_objectLoaded(int,QString,uint)), this, SLOT(updateProgress(int,QString,uint)));
+
+	try
+	{
+		this->ignore_dup=ignore_dup;
+		export_errors.clear();
+		progress=sql_gen_progress=0;
+		conn.connect();
+		configurePgSQLVersion(conn, pgsql_ver);
+
+		/* The objects are created on a scratch database instead of a new one (which can't be created inside a
+			 transaction) and all of them are discarded at the end by a rollback */
+		progress=5;
+		emit s_progressUpdated(progress, trUtf8("Preparing the scratch database '%1'...").arg(Utf8String::create(scratch_db)));
+		createScratchDatabase(db_model, conn);
+
+		progress=10;
+		emit s_progressUpdated(progress, trUtf8("Simulating the export inside a transaction on database '%1'...").arg(Utf8String::create(scratch_db)));
+		scratch_conn=conn;
+		scratch_conn.setConnectionParam(DBConnection::PARAM_DB_NAME, scratch_db);
+		scratch_conn.connect();
+
+		scratch_conn.executeDDLCommand("BEGIN");
+		export_conn=&scratch_conn;
+		in_transaction=true;
+
+		count=db_model->getObjectCount(OBJ_ROLE);
+		for(i=0; i < count; i++)
+		{
+			object=db_model->getObject(i, OBJ_ROLE);
+
+			if(!object->isSQLDisabled())
+				ddl_batch.push_back(object->getCodeDefinition(SchemaParser::SQL_DEFINITION));
+		}
+
+		executeDDLBatch();
+
+		progress=50;
+		emit s_progressUpdated(progress, trUtf8("Creating objects on database '%1'...").arg(Utf8String::create(scratch_db)));
+		db_model->generateSQLStatements(*this);
+		executeDDLBatch();
+
+		scratch_conn.executeDDLCommand("ROLLBACK");
+		scratch_conn.close();
+		export_conn=nullptr;
+		in_transaction=false;
+		disconnect(db_model, nullptr, this, nullptr);
+	}
+	catch(Exception &e)
+	{
+		disconnect(db_model, nullptr, this, nullptr);
+		export_conn=nullptr;
+		in_transaction=false;
+		ddl_batch.clear();
+
+		try
+		{
+			if(scratch_conn.isStablished())
+			{
+				scratch_conn.executeDDLCommand("ROLLBACK");
+				scratch_conn.close();
+			}
+		}
+		catch(Exception &e){}
+
+		if(export_errors.empty())
 			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 		else
 		{
-			errors.push_back(e);
-			throw Exception(e.getErrorMessage(),__PRETTY_FUNCTION__,__FILE__,__LINE__, errors);
+			export_errors.push_back(e);
+			throw Exception(e.getErrorMessage(),__PRETTY_FUNCTION__,__FILE__,__LINE__, export_errors);
+		}
+	}
+}
+
+void ModelExportHelper::createScratchDatabase(DatabaseModel *db_model, DBConnection &conn)
+{
+	ResultSet res;
+	EncodingType encoding=db_model->getEncoding();
+	QString settings, comment, sql_cmd, db_name=scratch_db,
+			lc_collate=db_model->getLocalization(LC_COLLATE),
+			lc_ctype=db_model->getLocalization(LC_CTYPE),
+			template_db=db_model->getTemplateDB(),
+			enc_name=(encoding!=BaseType::null ? ~encoding : QString());
+
+	/* The settings of the model's database used to create the scratch database are stored on its comment,
+		 this way the database is created once and recreated only when validating a model with other settings */
+	settings=QString("%1 (template: %2, encoding: %3, lc_collate: %4, lc_ctype: %5)")
+					 .arg(SCRATCH_DB_COMMENT).arg(template_db).arg(enc_name).arg(lc_collate).arg(lc_ctype);
+	db_name=QString("\"%1\"").arg(db_name.replace("\"", "\"\""));
+
+	conn.executeDMLCommand(QString("SELECT shobj_description(oid, 'pg_database') FROM pg_database WHERE datname='%1'")
+												 .arg(QString(scratch_db).replace("'", "''")), res);
+
+	if(res.getTupleCount() > 0)
+	{
+		res.accessTuple(ResultSet::FIRST_TUPLE);
+		comment=Utf8String::create(res.getColumnValue(0));
+
+		if(comment==settings)
+			return;
+
+		//Databases not created by pgModeler are never removed
+		if(!comment.startsWith(SCRATCH_DB_COMMENT))
+			throw Exception(Exception::getErrorMessage(ERR_INV_SCRATCH_DATABASE).arg(Utf8String::create(scratch_db)),
+											ERR_INV_SCRATCH_DATABASE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		//The idle connections to the scratch database would prevent its removal
+		ConnectionPool::clear(scratch_db);
+		conn.executeDDLCommand(QString("DROP DATABASE %1").arg(db_name));
+	}
+
+	sql_cmd=QString("CREATE DATABASE %1").arg(db_name);
+
+	if(!template_db.isEmpty())
+		sql_cmd+=QString(" TEMPLATE = %1").arg(template_db);
+
+	if(!enc_name.isEmpty())
+		sql_cmd+=QString(" ENCODING = '%1'").arg(enc_name);
+
+	if(!lc_collate.isEmpty())
+		sql_cmd+=QString(" LC_COLLATE = '%1'").arg(lc_collate);
+
+	if(!lc_ctype.isEmpty())
+		sql_cmd+=QString(" LC_CTYPE = '%1'").arg(lc_ctype);
+
+	conn.executeDDLCommand(sql_cmd);
+	conn.executeDDLCommand(QString("COMMENT ON DATABASE %1 IS '%2'").arg(db_name).arg(QString(settings).replace("'", "''")));
+}
+
+void ModelExportHelper::configurePgSQLVersion(DBConnection &conn, const QString &pgsql_ver)
+{
+	//Retrive the DBMS version in order to generate the correct code
+	QString version=(conn.getDBMSVersion()).mid(0,3);
+
+	//Overriding the DBMS version case the version is informed on parameter
+	if(!pgsql_ver.isEmpty())
+	{
+		SchemaParser::setPgSQLVersion(pgsql_ver);
+		emit s_progressUpdated(progress, trUtf8("PostgreSQL version detection overrided. Using version %1...").arg(pgsql_ver));
+	}
+	else
+	{
+		SchemaParser::setPgSQLVersion(version);
+		emit s_progressUpdated(progress, trUtf8("PostgreSQL %1 server detected...").arg(version));
+	}
+}
+
+bool ModelExportHelper::isIgnoredError(Exception &e)
+{
+	/* Error codes ignored when the duplicated objects are ignored
+			42P04 	duplicate_database
+			42723 	duplicate_function
+			42P06 	duplicate_schema
+			42P07 	duplicate_table
+			42710 	duplicate_object
+
+		 Reference:
+			http://www.postgresql.org/docs/current/static/errcodes-appendix.html*/
+	static const QStringList err_codes={"42P04", "42723", "42P06", "42P07", "42710"};
+
+	return(ignore_dup && err_codes.contains(e.getExtraInfo()));
+}
+
+void ModelExportHelper::handleStatement(const SQLStatement &stmt)
+{
+	QString code=stmt.getCode();
+
+	if(store_stmts)
+	{
+		export_stmts.push_back(stmt);
+		return;
+	}
+
+	/* Commands that can't run inside a transaction block are executed alone. During a transactional
+		 simulation the CONCURRENTLY option is removed since the index is discarded anyway */
+	if(in_transaction)
+	{
+		ddl_batch.push_back(removeConcurrentOption(code));
+
+		if(ddl_batch.size() >= ddl_batch_size)
+			executeDDLBatch();
+	}
+	else if(ddl_batch_size > 1 && isConcurrentIndex(code))
+	{
+		executeDDLBatch();
+		ddl_batch.push_back(code);
+		executeDDLBatch();
+	}
+	else
+	{
+		ddl_batch.push_back(code);
+
+		if(ddl_batch.size() >= ddl_batch_size)
+			executeDDLBatch();
+	}
+}
+
+void ModelExportHelper::executeDDLBatch(void)
+{
+	static Profiler::Entry *exec_tm=Profiler::getTimer("export.dbms.command-execution");
+	Profiler::Timer exec_timer(exec_tm);
+	unsigned exec_cnt=0;
+	QString sql_cmd;
+
+	while(!ddl_batch.empty())
+	{
+		try
+		{
+			//Inside a transaction the commands are always protected by savepoints (see DBConnection::executeDDLCommands())
+			if(ddl_batch.size()==1 && !in_transaction)
+			{
+				exec_cnt=0;
+				export_conn->executeDDLCommand(ddl_batch[0]);
+			}
+			else
+				export_conn->executeDDLCommands(ddl_batch, exec_cnt);
+
+			ddl_batch.clear();
+		}
+		catch(Exception &e)
+		{
+			//Discards the failed command and the ones executed before it, executing the remaining ones again
+			sql_cmd=ddl_batch[exec_cnt];
+			ddl_batch.erase(ddl_batch.begin(), ddl_batch.begin() + exec_cnt + 1);
+
+			if(!isIgnoredError(e))
+			{
+				ddl_batch.clear();
+				throw Exception(Exception::getErrorMessage(ERR_EXPORT_FAILURE).arg(Utf8String::create(sql_cmd)),
+												ERR_EXPORT_FAILURE,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, sql_cmd);
+			}
+			else
+				export_errors.push_back(e);
+		}
+	}
+}
+
+void ModelExportHelper::exportInParallel(DBConnection &db_conn)
+{
+	static Profiler::Entry *exec_tm=Profiler::getTimer("export.dbms.command-execution");
+	Profiler::Timer exec_timer(exec_tm);
+	map<unsigned, vector<vector<QString> > > level_units;
+	map<unsigned, vector<unsigned> > level_orders;
+	map<unsigned, vector<vector<QString> > >::iterator itr, itr_end;
+	vector<SQLStatement>::iterator itr_stmt, itr_stmt_end;
+	vector<QString> session_cmds;
+	vector<DBConnection *> conns;
+	vector<DBMSExportTask *> tasks;
+	vector<pair<unsigned, vector<QString> > > deferred;
+	vector<unsigned> unit_idxs;
+	vector<vector<QString> > unit_cmds;
+	vector<Exception> ign_errors;
+	DBMSExportTask *task=nullptr;
+	DBConnection *conn=nullptr;
+	QThreadPool pool;
+	QAtomicInt next_unit(0), aborted(0);
+	unsigned i, i1, level_cnt, order=0, last_obj_id=0, last_level=0, chunk_size;
+	int error_idx;
+	Exception error;
+
+	/* Grouping the consecutive statements of the same object by dependency level. The statements generated
+		 by the model itself (e.g. session settings) are executed on each connection before the objects */
+	itr_stmt=export_stmts.begin();
+	itr_stmt_end=export_stmts.end();
+	while(itr_stmt!=itr_stmt_end)
+	{
+		if(itr_stmt->getObjectType()==OBJ_DATABASE)
+			session_cmds.push_back(itr_stmt->getCode());
+		else if(itr_stmt->getIndex() > 0 && itr_stmt->getObjectId()==last_obj_id && itr_stmt->getLevel()==last_level)
+			level_units[last_level].back().push_back(itr_stmt->getCode());
+		else
+		{
+			last_obj_id=itr_stmt->getObjectId();
+			last_level=itr_stmt->getLevel();
+			level_units[last_level].push_back(vector<QString>(1, itr_stmt->getCode()));
+			level_orders[last_level].push_back(order++);
+		}
+
+		itr_stmt++;
+	}
+
+	export_stmts.clear();
+
+	try
+	{
+		for(i=0; i < export_conns; i++)
+		{
+			conn=new DBConnection;
+			conns.push_back(conn);
+			(*conn)=db_conn;
+
+			for(i1=0; i1 < session_cmds.size(); i1++)
+				conn->executeDDLCommand(session_cmds[i1]);
+		}
+
+		pool.setMaxThreadCount(conns.size());
+		level_cnt=1;
+		itr=level_units.begin();
+		itr_end=level_units.end();
+
+		while(itr!=itr_end)
+		{
+			emit s_progressUpdated(progress + (level_cnt * (99 - progress)/level_units.size()),
+														 trUtf8("Creating objects of dependency level %1 of %2 using %3 connections...")
+														 .arg(level_cnt).arg(level_units.size()).arg(conns.size()));
+
+			/* The objects are picked in small chunks so the work is balanced between the connections
+				 even when the commands of some objects (e.g. indexes) take longer to execute */
+			chunk_size=max(1u, min(ddl_batch_size, static_cast<unsigned>(itr->second.size() / (conns.size() * 4))));
+			next_unit.store(0);
+
+			for(i=0; i < conns.size() && i < itr->second.size(); i++)
+			{
+				task=new DBMSExportTask(this, *conns[i], itr->second, next_unit, aborted, chunk_size);
+				tasks.push_back(task);
+				pool.start(task);
+			}
+
+			pool.waitForDone();
+
+			//Collecting the results of the tasks. The error of the first object (in the list order) is raised
+			error_idx=-1;
+			for(i=0; i < tasks.size(); i++)
+			{
+				task=tasks[i];
+				ign_errors=task->getIgnoredErrors();
+				export_errors.insert(export_errors.end(), ign_errors.begin(), ign_errors.end());
+
+				task->getDeferredUnits(unit_idxs, unit_cmds);
+				for(i1=0; i1 < unit_idxs.size(); i1++)
+					deferred.push_back(make_pair(level_orders[itr->first][unit_idxs[i1]], unit_cmds[i1]));
+
+				if(task->getErrorIndex() >= 0 && (error_idx < 0 || task->getErrorIndex() < error_idx))
+				{
+					error_idx=task->getErrorIndex();
+					error=task->getError();
+				}
+
+				delete(task);
+			}
+
+			tasks.clear();
+
+			if(error_idx >= 0)
+				throw Exception(error.getErrorMessage(), error.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &error, error.getExtraInfo());
+
+			level_cnt++;
+			itr++;
+		}
+
+		/* The objects that depend on objects created after them are created at the end in the
+			 original order using a single connection, errors at this point are not deferred anymore */
+		sort(deferred.begin(), deferred.end());
+		export_conn=conns[0];
+
+		for(i=0; i < deferred.size(); i++)
+		{
+			ddl_batch.insert(ddl_batch.end(), deferred[i].second.begin(), deferred[i].second.end());
+
+			if(ddl_batch.size() >= ddl_batch_size)
+				executeDDLBatch();
 		}
+
+		executeDDLBatch();
+		export_conn=&db_conn;
+
+		for(i=0; i < conns.size(); i++)
+			delete(conns[i]);
+	}
+	catch(Exception &e)
+	{
+		export_conn=&db_conn;
+		ddl_batch.clear();
+
+		for(i=0; i < conns.size(); i++)
+			delete(conns[i]);
+
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo());
 	}
 }
 
@@ -27,11 +27,18 @@
 
 #include "modelwidget.h"
 #include "dbconnection.h"
+#include "dbmsexporttask.h"
 
-class ModelExportHelper: public QObject {
+class ModelExportHelper: public QObject, public SQLStatementHandler {
 	private:
 		Q_OBJECT
 
+		//! \brief Comment prefix that identifies the scratch databases created by pgModeler
+		static const QString SCRATCH_DB_COMMENT;
+
+		//! \brief Name of the database where the export simulations are made (see simulateDBMSExport())
+		static QString scratch_db;
+
 		//! \brief  Stores the total progress
 		int progress,
 		//! \brief  Stores the sql generation progress
@@ -45,12 +52,90 @@ class ModelExportHelper: public QObject {
 		This attribute is used to drop the created roles / tablespaces from server */
 		map<ObjectType, int> created_objs;
 
+		//! \brief Maximum amount of SQL commands sent to the server in a single round trip (only dbms export)
+		unsigned ddl_batch_size;
+
+		//! \brief Indicates if the object duplicity errors must be ignored (only dbms export)
+		bool ignore_dup;
+
+		//! \brief Connection to the created database used to execute the commands (only dbms export)
+		DBConnection *export_conn;
+
+		//! \brief Indicates that the commands are executed inside the transaction of a simulation
+		bool in_transaction;
+
+		//! \brief Amount of connections used to create the objects in parallel (only dbms export)
+		unsigned export_conns;
+
+		//! \brief Statements stored to be executed in parallel by dependency level (see exportInParallel())
+		vector<SQLStatement> export_stmts;
+
+		//! \brief Indicates that the generated statements must be stored instead of executed
+		bool store_stmts;
+
+		//! \brief Commands waiting to be executed on the server (only dbms export)
+		vector<QString> ddl_batch;
+
+		//! \brief Ignored errors raised during the dbms export
+		vector<Exception> export_errors;
+
+		//! \brief Returns if the error must be ignored according to the ignore duplicity option
+		bool isIgnoredError(Exception &e);
+
+		/*! \brief Executes the pending commands on the new database. The ignored errors are stored and
+		 the remaining commands are executed, otherwise an error is raised */
+		void executeDDLBatch(void);
+
+		/*! \brief Simulates the dbms export creating the roles and the other objects inside a single transaction
+		on the scratch database. The transaction is rolled back at the end so nothing is kept on the server */
+		void simulateDBMSExport(DatabaseModel *db_model, DBConnection &conn, const QString &pgsql_ver, bool ignore_dup);
+
+		/*! \brief Creates the scratch database using the encoding, localizations and template of the model's database.
+		An existing scratch database is reused when it was created with the same settings, otherwise it's recreated.
+		Databases with the same name not created by pgModeler are never dropped, instead an error is raised */
+		void createScratchDatabase(DatabaseModel *db_model, DBConnection &conn);
+
+		//! \brief Defines the PostgreSQL version used to generate the code (detected from the server when 'pgsql_ver' is empty)
+		void configurePgSQLVersion(DBConnection &conn, const QString &pgsql_ver);
+
+		/*! \brief Creates the objects of the stored statements using several connections to the database. The
+		objects of the same dependency level are created at the same time and each level is started only after
+		the previous one finishes. Objects that fail due to dependencies not known by the model are created at the end */
+		void exportInParallel(DBConnection &db_conn);
+
 		//! \brief Revert the dbms export process, removing the created database, roles and tablespaces
 		void undoDBMSExport(DatabaseModel *db_model, DBConnection &conn);
 
 	public:
+		//! \brief Default amount of SQL commands sent to the server in a single round trip
+		static constexpr unsigned DEFAULT_DDL_BATCH_SIZE=200;
+
+		//! \brief Default name of the database where the export simulations are made
+		static const QString DEFAULT_SCRATCH_DB;
+
 		ModelExportHelper(QObject *parent = 0);
 
+		/*! \brief Defines the maximum amount of SQL commands executed in a single round trip during the
+		dbms export. Using 1 makes each command to be sent to the server separately */
+		void setDDLBatchSize(unsigned size);
+
+		/*! \brief Defines the amount of connections used to create the objects in parallel during the dbms export.
+		Values lower than 2 make the objects be created by a single connection in the order they are generated */
+		void setExportConnections(unsigned conn_cnt);
+
+		/*! \brief Defines the database where the export simulations are made. The database is created on the first
+		simulation and reused on the next ones. An empty name restores the default one */
+		static void setScratchDatabase(const QString &db_name);
+
+		//! \brief Returns the name of the database where the export simulations are made
+		static QString getScratchDatabase(void);
+
+		//! \brief Returns if the command creates an index concurrently, which can't be done inside a transaction block
+		static bool isConcurrentIndex(const QString &cmd);
+
+		//! \brief Returns the command without the CONCURRENTLY option of CREATE INDEX
+		static QString removeConcurrentOption(const QString &cmd);
+
 		//! \brief Exports the model to a named SQL file. The PostgreSQL version syntax must be specified.
 		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver);
 
@@ -60,9 +145,14 @@ class ModelExportHelper: public QObject {
 
 		/*! \brief Exports the model directly to the DBMS. A valid connection must be specified. The PostgreSQL
 		version is optional, since the helper identifies the version from the server. The boolean parameter
-		make the helper to ignore object duplicity errors */
+		make the helper to ignore object duplicity errors. When simulating, the objects are created inside
+		a transaction which is rolled back (see simulateDBMSExport()) unless the model has tablespaces to be
+		created, in this case the created objects are dropped at the end */
 		void exportToDBMS(DatabaseModel *db_model, DBConnection &conn, const QString &pgsql_ver, bool ignore_dup, bool simulate=false);
 
+		//! \brief Stores the statement on the current batch executing it when the batch is full (only dbms export)
+		void handleStatement(const SQLStatement &stmt);
+
 	signals:
 		//! \brief This singal is emitted whenever the export progress changes
 		void s_progressUpdated(int progress, QString object_id);
@@ -70,6 +160,8 @@ class ModelExportHelper: public QObject {
 	private slots:
 		//! \brief Updates the exporting progress with the internal progress of sql generation of objects
 		void updateProgress(int progress, QString object_id, unsigned);
+
+	friend class DBMSExportTask;
 };
 
 #endif
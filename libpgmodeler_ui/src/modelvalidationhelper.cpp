@@ -31,6 +31,7 @@ void ModelValidationHelper::validateModel(DatabaseModel *model, DBConnection *co
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->db_model=model;
+	progress=0;
 
 	try
 	{
@@ -40,17 +41,23 @@ void ModelValidationHelper::validateModel(DatabaseModel *model, DBConnection *co
 								aux_types[]={ OBJ_TABLE, OBJ_VIEW },
 							 tab_obj_types[]={ OBJ_CONSTRAINT, OBJ_INDEX };
 		unsigned i, i1, cnt, aux_cnt=sizeof(aux_types)/sizeof(ObjectType),
-						count=sizeof(types)/sizeof(ObjectType), count1=sizeof(tab_obj_types)/sizeof(ObjectType);
-		BaseObject *object=nullptr, *refer_obj=nullptr;
-		vector<BaseObject *> refs, refs_aux, *obj_list=nullptr;
+						count=sizeof(types)/sizeof(ObjectType), count1=sizeof(tab_obj_types)/sizeof(ObjectType),
+						thread_cnt=(QThread::idealThreadCount() > 0 ? QThread::idealThreadCount() : 1);
+		vector<BaseObject *> refs, objects, *obj_list=nullptr;
 		vector<BaseObject *>::iterator itr;
-		TableObject *tab_obj=nullptr;
+		vector<vector<BaseObject *> > broken_refs, dup_objects;
+		vector<vector<BaseObject *> >::iterator ditr;
+		vector<ReferencesValidationTask *> tasks;
+		vector<ValidationInfo> infos;
 		ValidationInfo info;
+		QHash<QString, unsigned> dup_names;
+		QThreadPool pool;
+		QAtomicInt next_obj(0);
+		TableObject *tab_obj=nullptr;
 		Table *table=nullptr;
 		Constraint *constr=nullptr;
-		map<QString, vector<BaseObject *> > dup_objects;
-		map<QString, vector<BaseObject *> >::iterator mitr;
 		QString name;
+		int prev_progress;
 
 		warn_count=error_count=0;
 
@@ -63,60 +70,64 @@ void ModelValidationHelper::validateModel(DatabaseModel *model, DBConnection *co
 
 			while(itr!=obj_list->end())
 			{
-				object=(*itr);
+				//Excluding the validation of system objects (created automatically)
+				if(!(*itr)->isSystemObject())
+					objects.push_back(*itr);
+
 				itr++;
+			}
+		}
 
-				//Excluding the validation of system objects (created automatically)
-				if(!object->isSystemObject())
-				{
-					model->getObjectReferences(object, refs);
-					refs_aux.clear();
-					while(!refs.empty())
-					{
-						//Checking if the referrer object is a table object. In this case its parent table is considered
-						tab_obj=dynamic_cast<TableObject *>(refs.back());
-
-						/* If the current referrer object has an id less than reference object's id
-						then it will be pushed into the list of invalid references */
-						if(object != refs.back() &&
-							 ((refs.back()->getObjectId() <= object->getObjectId()) ||
-								(tab_obj && !tab_obj->isAddedByRelationship() &&
-								 tab_obj->getParentTable()->getObjectId() <= object->getObjectId())))
-						{
-							if(tab_obj)
-								refer_obj=tab_obj->getParentTable();
-							else
-								refer_obj=refs.back();
-
-							//Push the referrer object only if not exists on the list
-							if(std::find(refs_aux.begin(), refs_aux.end(), refer_obj)==refs_aux.end())
-								refs_aux.push_back(refer_obj);
-						}
+		/* The model is not modified during the validation so, after the creation of the references index,
+			 the objects can be validated by several threads at the same time */
+		model->updateReferencesIndex();
+		broken_refs.resize(objects.size());
 
-						refs.pop_back();
-					}
+		if(thread_cnt > 1 && objects.size() > thread_cnt)
+		{
+			pool.setMaxThreadCount(thread_cnt);
 
-					//Case there is broken refereces to the object
-					if(!refs_aux.empty())
-					{
-						//Configures a validation info
-						info=ValidationInfo(ValidationInfo::BROKEN_REFERENCE, object, refs_aux);
-						error_count++;
+			for(i=0; i < thread_cnt; i++)
+			{
+				tasks.push_back(new ReferencesValidationTask(model, objects, broken_refs, next_obj));
+				pool.start(tasks.back());
+			}
 
-						//Emit the signal containing the info
-						emit s_validationInfoGenerated(info);
-					}
-				}
+			pool.waitForDone();
+
+			while(!tasks.empty())
+			{
+				delete(tasks.back());
+				tasks.pop_back();
 			}
+		}
+		else
+		{
+			for(i=0; i < objects.size(); i++)
+				ReferencesValidationTask::getBrokenReferences(model, objects[i], broken_refs[i]);
+		}
 
-			//Emit a signal containing the validation progress
-			progress=((i+1)/static_cast<float>(count))*30;
-			emit s_progressUpdated(progress, "");
+		//Configures the validation infos in the order the objects appear on the model
+		for(i=0; i < objects.size(); i++)
+		{
+			if(!broken_refs[i].empty())
+			{
+				infos.push_back(ValidationInfo(ValidationInfo::BROKEN_REFERENCE, objects[i], broken_refs[i]));
+				error_count++;
+			}
 		}
 
+		//Emit the signal containing all the infos of the step at once
+		if(!infos.empty())
+			emit s_validationInfosGenerated(infos);
+
+		progress=30;
+		emit s_progressUpdated(progress, "");
+
 
 		/* Step 2: Validating name conflitcs between primary keys, unique keys, exclude constraints
-		and indexs of all tables/views. The table and view names are checked too. */
+		and indexs of all tables/views. The table and view names are checked too. The names are grouped
+		in the order they are found so the generated infos are always the same for the same model */
 		obj_list=model->getObjectList(OBJ_TABLE);
 		itr=obj_list->begin();
 
@@ -135,10 +146,6 @@ void ModelValidationHelper::validateModel(DatabaseModel *model, DBConnection *co
 					//Get the table object (constraint or index)
 					tab_obj=dynamic_cast<TableObject *>(table->getObject(i1, tab_obj_types[i]));
 
-					//Configures the full name of the object including the parent name
-					name=tab_obj->getParentTable()->getSchema()->getName(true) + "." + tab_obj->getName(true);
-					name.remove("\"");
-
 					//Trying to convert the object to constraint
 					constr=dynamic_cast<Constraint *>(tab_obj);
 
@@ -150,7 +157,19 @@ void ModelValidationHelper::validateModel(DatabaseModel *model, DBConnection *co
 							(constr && (constr->getConstraintType()==ConstraintType::primary_key ||
 													constr->getConstraintType()==ConstraintType::unique ||
 													constr->getConstraintType()==ConstraintType::exclude))))
-						dup_objects[name].push_back(tab_obj);
+					{
+						//Configures the full name of the object including the parent name
+						name=tab_obj->getParentTable()->getSchema()->getName(true) + "." + tab_obj->getName(true);
+						name.remove("\"");
+
+						if(!dup_names.contains(name))
+						{
+							dup_names[name]=dup_objects.size();
+							dup_objects.push_back(vector<BaseObject *>());
+						}
+
+						dup_objects[dup_names[name]].push_back(tab_obj);
+					}
 				}
 			}
 		}
@@ -163,38 +182,50 @@ void ModelValidationHelper::validateModel(DatabaseModel *model, DBConnection *co
 			itr=obj_list->begin();
 			while(itr!=obj_list->end())
 			{
-				dup_objects[(*itr)->getName(true).remove("\"")].push_back(*itr);
+				name=(*itr)->getName(true).remove("\"");
+
+				if(!dup_names.contains(name))
+				{
+					dup_names[name]=dup_objects.size();
+					dup_objects.push_back(vector<BaseObject *>());
+				}
+
+				dup_objects[dup_names[name]].push_back(*itr);
 				itr++;
 			}
 		}
 
-		//Checking the map of duplicated objects
-		mitr=dup_objects.begin();
+		//Checking the list of duplicated objects
+		infos.clear();
+		ditr=dup_objects.begin();
 		i=1;
-		while(mitr!=dup_objects.end())
+		while(ditr!=dup_objects.end())
 		{
-			/* If the vector of the current map element has more the one object
+			/* If the vector of the current element has more the one object
 			indicates the duplicity thus generates a validation info */
-			if(mitr->second.size() > 1)
+			if(ditr->size() > 1)
 			{
-				refs.assign(mitr->second.begin() + 1, mitr->second.end());
+				refs.assign(ditr->begin() + 1, ditr->end());
 
 				//Configures a validation info
-				info=ValidationInfo(ValidationInfo::NO_UNIQUE_NAME, mitr->second.front(), refs);
+				infos.push_back(ValidationInfo(ValidationInfo::NO_UNIQUE_NAME, ditr->front(), refs));
 				error_count++;
 				refs.clear();
-
-				//Emit the signal containing the info
-				emit s_validationInfoGenerated(info);
 			}
 
-			//Emit a signal containing the validation progress
+			//Emit a signal containing the validation progress only when it changes
+			prev_progress=progress;
 			progress=30 + ((i/static_cast<float>(dup_objects.size()))*30);
-			emit s_progressUpdated(progress, "");
 
-			i++; mitr++;
+			if(progress!=prev_progress)
+				emit s_progressUpdated(progress, "");
+
+			i++; ditr++;
 		}
 
+		if(!infos.empty())
+			emit s_validationInfosGenerated(infos);
+
 		//Step 3 (optional): Validating the SQL code onto a local DBMS.
 		//Case the connection isn't specified indicates that the SQL validation will not be executed
 		if(!conn)
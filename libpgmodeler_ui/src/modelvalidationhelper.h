@@ -26,10 +26,12 @@
 #define MODEL_VALIDATION_HELPER_H
 
 #include <QObject>
+#include <QThreadPool>
 #include "validationinfo.h"
 #include "databasemodel.h"
 #include "dbconnection.h"
 #include "modelexporthelper.h"
+#include "referencesvalidationtask.h"
 
 class ModelValidationHelper: public QObject {
 	private:
@@ -50,7 +52,8 @@ class ModelValidationHelper: public QObject {
 		ModelValidationHelper(void);
 
 		/*! \brief Validates the specified model. If a connection is specifies executes the
-		SQL validation directly on DBMS */
+		SQL validation directly on DBMS. The broken references are searched by several threads
+		at the same time so the model must not be modified during the validation */
 		void validateModel(DatabaseModel *model, DBConnection *conn=nullptr, const QString &pgsql_ver="");
 
 		//! \brief Returns the error count (only when executing SQL validation)
@@ -69,6 +72,10 @@ class ModelValidationHelper: public QObject {
 		//! \brief This signal is emitted when a validation info is generated
 		void s_validationInfoGenerated(ValidationInfo val_info);
 
+		/*! \brief This signal is emitted when several validation infos are generated by the same validation step.
+		 This avoids the update of the output for each generated info */
+		void s_validationInfosGenerated(vector<ValidationInfo> val_infos);
+
 		//! \brief This signal is emitted when the validation progress changes
 		void s_progressUpdated(int prog, QString msg);
 };
@@ -28,6 +28,7 @@ ModelValidationWidget::ModelValidationWidget(QWidget *parent): QWidget(parent)
 
 	connect(validate_btn, SIGNAL(clicked(bool)), this, SLOT(validateModel(void)));
 	connect(&validation_helper, SIGNAL(s_validationInfoGenerated(ValidationInfo)), this, SLOT(updateValidation(ValidationInfo)));
+	connect(&validation_helper, SIGNAL(s_validationInfosGenerated(vector<ValidationInfo>)), this, SLOT(updateValidation(vector<ValidationInfo>)));
 	connect(&validation_helper, SIGNAL(s_progressUpdated(int,QString)), this, SLOT(updateProgress(int,QString)));
 	connect(hide_tb, SIGNAL(clicked(bool)), this, SLOT(hide(void)));
 	connect(fix_btn, SIGNAL(clicked(bool)), this, SLOT(applyFix(void)));
@@ -197,6 +198,22 @@ void ModelValidationWidget::updateValidation(ValidationInfo val_info)
 	output_trw->scrollToBottom();
 }
 
+void ModelValidationWidget::updateValidation(vector<ValidationInfo> val_infos)
+{
+	vector<ValidationInfo>::iterator itr=val_infos.begin();
+
+	//The output is redrawn only once for all the infos
+	output_trw->setUpdatesEnabled(false);
+
+	while(itr!=val_infos.end())
+	{
+		updateValidation(*itr);
+		itr++;
+	}
+
+	output_trw->setUpdatesEnabled(true);
+}
+
 void ModelValidationWidget::validateModel(void)
 {
 	try
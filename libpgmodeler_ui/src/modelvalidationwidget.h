@@ -59,6 +59,7 @@ class ModelValidationWidget: public QWidget, public Ui::ModelValidationWidget {
 	private slots:
 		void applyFix(void);
 		void updateValidation(ValidationInfo val_info);
+		void updateValidation(vector<ValidationInfo> val_infos);
 		void updateProgress(int prog, QString msg);
 		void validateModel(void);
 
@@ -449,6 +449,8 @@ float ModelWidget::currentZoom(void)
 
 void ModelWidget::handleObjectAddition(BaseObject *object)
 {
+	static Profiler::Entry *scene_tm=Profiler::getTimer("model-widget.scene-items");
+	Profiler::Timer scene_timer(scene_tm);
 	BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(object);
 
 	if(graph_obj)
@@ -874,6 +876,9 @@ void ModelWidget::convertRelationshipNN(void)
 
 void ModelWidget::loadModel(const QString &filename)
 {
+	static Profiler::Entry *load_tm=Profiler::getTimer("model-widget.load");
+	Profiler::Timer load_timer(load_tm);
+
 	try
 	{
 		connect(db_model, SIGNAL(s_objectLoaded(int,QString,unsigned)), task_prog_wgt, SLOT(updateProgress(int,QString,unsigned)));
@@ -1683,7 +1688,7 @@ void ModelWidget::copyObjects(void)
 	vector<unsigned> objs_id;
 	vector<BaseObject *>::iterator itr, itr_aux, itr_end;
 	vector<unsigned>::iterator itr1, itr1_end;
-	vector<BaseObject *> deps;
+	vector<BaseObject *> deps, objects;
 	BaseObject *object=nullptr;
 	TableObject *tab_obj=nullptr;
 	Table *table=nullptr;
@@ -1718,8 +1723,7 @@ void ModelWidget::copyObjects(void)
 		//Table-view relationships and FK relationship aren't copied since they are created automatically when pasting the tables/views
 		if(object->getObjectType()!=BASE_RELATIONSHIP)
 		{
-			//Get the object dependencies if the user confirmed this situation
-			db_model->getObjectDependecies(object, deps, msg_box.result()==QDialog::Accepted);
+			objects.push_back(object);
 
 			/* Copying the special objects (which references columns added by relationship) in order
 			to be correclty created when pasted */
@@ -1754,6 +1758,10 @@ void ModelWidget::copyObjects(void)
 		itr++;
 	}
 
+	/* Get the objects dependencies (if the user confirmed this situation) in a single search
+		 so the dependencies shared by the objects are visited only once */
+	db_model->getObjectDependecies(objects, deps, msg_box.result()==QDialog::Accepted);
+
 	itr=deps.begin();
 	itr_end=deps.end();
 
@@ -1803,6 +1811,7 @@ void ModelWidget::pasteObjects(void)
 	ObjectType obj_type;
 	Exception error;
 	unsigned idx=0, pos=0;
+	ProgressReporter prog_rep;
 
 	task_prog_wgt->setWindowTitle(trUtf8("Pasting objects..."));
 	task_prog_wgt->show();
@@ -1826,10 +1835,11 @@ void ModelWidget::pasteObjects(void)
 		tab_obj=dynamic_cast<TableObject *>(object);
 		itr++;
 		pos++;
-		task_prog_wgt->updateProgress((pos/static_cast<float>(copied_objects.size()))*100,
-																	trUtf8("Validating object: %1 (%2)").arg(object->getName())
-																	.arg(object->getTypeName()),
-																	object->getObjectType());
+		if(prog_rep.isReportDue((pos/static_cast<float>(copied_objects.size()))*100))
+			task_prog_wgt->updateProgress((pos/static_cast<float>(copied_objects.size()))*100,
+																		trUtf8("Validating object: %1 (%2)").arg(object->getName())
+																		.arg(object->getTypeName()),
+																		object->getObjectType());
 
 		if(!tab_obj || ((sel_table || sel_view) && tab_obj))
 		{
@@ -1931,10 +1941,11 @@ void ModelWidget::pasteObjects(void)
 		itr++;
 
 		pos++;
-		task_prog_wgt->updateProgress((pos/static_cast<float>(copied_objects.size()))*100,
-																	trUtf8("Generating XML code of object: %1 (%2)").arg(object->getName())
-																	.arg(object->getTypeName()),
-																	object->getObjectType());
+		if(prog_rep.isReportDue((pos/static_cast<float>(copied_objects.size()))*100))
+			task_prog_wgt->updateProgress((pos/static_cast<float>(copied_objects.size()))*100,
+																		trUtf8("Generating XML code of object: %1 (%2)").arg(object->getName())
+																		.arg(object->getTypeName()),
+																		object->getObjectType());
 
 		//Store the original parent table of the object
 		if(tab_obj && (sel_table || sel_view))
@@ -2004,10 +2015,11 @@ void ModelWidget::pasteObjects(void)
 				constr=dynamic_cast<Constraint *>(tab_obj);
 
 				pos++;
-				task_prog_wgt->updateProgress((pos/static_cast<float>(copied_objects.size()))*100,
-																			trUtf8("Pasting object: %1 (%2)").arg(object->getName())
-																			.arg(object->getTypeName()),
-																			object->getObjectType());
+				if(prog_rep.isReportDue((pos/static_cast<float>(copied_objects.size()))*100))
+					task_prog_wgt->updateProgress((pos/static_cast<float>(copied_objects.size()))*100,
+																				trUtf8("Pasting object: %1 (%2)").arg(object->getName())
+																				.arg(object->getTypeName()),
+																				object->getObjectType());
 
 				/* Once created, the object is added on the model, except for relationships and table objects
 			because they are inserted automatically */
@@ -0,0 +1,79 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "referencesvalidationtask.h"
+
+ReferencesValidationTask::ReferencesValidationTask(DatabaseModel *model, const vector<BaseObject *> &objects,
+																									 vector<vector<BaseObject *> > &broken_refs, QAtomicInt &next_obj)
+{
+	this->model=model;
+	this->objects=&objects;
+	this->broken_refs=&broken_refs;
+	this->next_obj=&next_obj;
+
+	//The task is destroyed by the validation helper after all tasks finish
+	setAutoDelete(false);
+}
+
+void ReferencesValidationTask::run(void)
+{
+	int idx, count=objects->size();
+
+	while(true)
+	{
+		idx=next_obj->fetchAndAddOrdered(1);
+		if(idx >= count) break;
+
+		getBrokenReferences(model, objects->at(idx), (*broken_refs)[idx]);
+	}
+}
+
+void ReferencesValidationTask::getBrokenReferences(DatabaseModel *model, BaseObject *object, vector<BaseObject *> &broken_refs)
+{
+	vector<BaseObject *> refs;
+	TableObject *tab_obj=nullptr;
+	BaseObject *refer_obj=nullptr;
+
+	broken_refs.clear();
+	model->getObjectReferences(object, refs);
+
+	while(!refs.empty())
+	{
+		//Checking if the referrer object is a table object. In this case its parent table is considered
+		tab_obj=dynamic_cast<TableObject *>(refs.back());
+
+		/* If the current referrer object has an id less than reference object's id
+		then it will be pushed into the list of invalid references */
+		if(object != refs.back() &&
+			 ((refs.back()->getObjectId() <= object->getObjectId()) ||
+				(tab_obj && !tab_obj->isAddedByRelationship() &&
+				 tab_obj->getParentTable()->getObjectId() <= object->getObjectId())))
+		{
+			if(tab_obj)
+				refer_obj=tab_obj->getParentTable();
+			else
+				refer_obj=refs.back();
+
+			//Push the referrer object only if not exists on the list
+			if(std::find(broken_refs.begin(), broken_refs.end(), refer_obj)==broken_refs.end())
+				broken_refs.push_back(refer_obj);
+		}
+
+		refs.pop_back();
+	}
+}
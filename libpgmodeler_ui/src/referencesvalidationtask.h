@@ -0,0 +1,63 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class ReferencesValidationTask
+\brief Implements a worker used by ModelValidationHelper to search broken references of several objects
+ at the same time. Each task picks the next object not yet validated from a shared list and stores the
+ broken references on the same position of the results list, so the validation infos can be generated
+ in the original order after all tasks finish. The model must not be modified while the tasks run.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef REFERENCES_VALIDATION_TASK_H
+#define REFERENCES_VALIDATION_TASK_H
+
+#include <QRunnable>
+#include <QAtomicInt>
+#include <vector>
+#include "databasemodel.h"
+
+class ReferencesValidationTask: public QRunnable {
+	private:
+		//! \brief Model that owns the objects
+		DatabaseModel *model;
+
+		//! \brief Objects to be validated
+		const vector<BaseObject *> *objects;
+
+		//! \brief Broken references found for each object (empty when the object is valid)
+		vector<vector<BaseObject *> > *broken_refs;
+
+		//! \brief Index of the next object to be validated (shared between all tasks)
+		QAtomicInt *next_obj;
+
+	public:
+		ReferencesValidationTask(DatabaseModel *model, const vector<BaseObject *> &objects,
+														 vector<vector<BaseObject *> > &broken_refs, QAtomicInt &next_obj);
+
+		//! \brief Validates the objects until the list ends
+		void run(void);
+
+		/*! \brief Stores on 'broken_refs' the objects (or parent tables of table objects) that reference the
+		 specified one but have a smaller id, which means they are created before the object they reference */
+		static void getBrokenReferences(DatabaseModel *model, BaseObject *object, vector<BaseObject *> &broken_refs);
+};
+
+#endif
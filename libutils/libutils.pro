@@ -7,6 +7,14 @@ TARGET = utils
 HEADERS += src/exception.h \
 	   src/globalattributes.h \
 	   src/parsersattributes.h \
-	   src/utf8string.h
+	   src/attributeidtable.h \
+	   src/attributesmap.h \
+	   src/utf8string.h \
+	   src/progressreporter.h \
+	   src/profiler.h
 
-SOURCES += src/exception.cpp
+SOURCES += src/exception.cpp \
+	   src/attributeidtable.cpp \
+	   src/attributesmap.cpp \
+	   src/progressreporter.cpp \
+	   src/profiler.cpp
@@ -0,0 +1,105 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "attributeidtable.h"
+
+QReadWriteLock AttributeIdTable::table_lock;
+vector<QString> AttributeIdTable::extra_names;
+QHash<QString, unsigned> AttributeIdTable::extra_ids;
+
+const vector<QString> &AttributeIdTable::getDeclaredNames(void)
+{
+	#define PARSERS_ATTRIBUTE_NAME(cnst, name) QString(name),
+	#define PARSERS_ATTRIBUTE_NO_NAME(cnst, orig)
+
+	//The list is created on the first call and only read afterwards, so it doesn't need to be locked
+	static const vector<QString> names={ PARSERS_ATTRIBUTES_LIST(PARSERS_ATTRIBUTE_NAME, PARSERS_ATTRIBUTE_NO_NAME) };
+
+	#undef PARSERS_ATTRIBUTE_NAME
+	#undef PARSERS_ATTRIBUTE_NO_NAME
+	return(names);
+}
+
+QHash<QString, unsigned> AttributeIdTable::createDeclaredIds(void)
+{
+	const vector<QString> &names=getDeclaredNames();
+	QHash<QString, unsigned> decl_ids;
+	unsigned id;
+
+	decl_ids.reserve(names.size());
+	for(id=0; id < names.size(); id++)
+		decl_ids[names[id]]=id;
+
+	return(decl_ids);
+}
+
+const QHash<QString, unsigned> &AttributeIdTable::getDeclaredIds(void)
+{
+	static const QHash<QString, unsigned> ids=createDeclaredIds();
+	return(ids);
+}
+
+unsigned AttributeIdTable::getId(const QString &name)
+{
+	const QHash<QString, unsigned> &decl_ids=getDeclaredIds();
+	QHash<QString, unsigned>::const_iterator itr=decl_ids.constFind(name);
+	unsigned id;
+
+	if(itr!=decl_ids.constEnd())
+		return(itr.value());
+
+	{
+		QReadLocker locker(&table_lock);
+		itr=extra_ids.constFind(name);
+
+		if(itr!=extra_ids.constEnd())
+			return(itr.value());
+	}
+
+	QWriteLocker locker(&table_lock);
+
+	//The name could be interned by another thread while the lock was released
+	itr=extra_ids.constFind(name);
+	if(itr!=extra_ids.constEnd())
+		return(itr.value());
+
+	id=ParsersAttributes::ATTRIBUTE_COUNT + extra_names.size();
+	extra_names.push_back(name);
+	extra_ids[name]=id;
+	return(id);
+}
+
+QString AttributeIdTable::getName(unsigned id)
+{
+	if(id < ParsersAttributes::ATTRIBUTE_COUNT)
+		return(getDeclaredNames()[id]);
+
+	QReadLocker locker(&table_lock);
+	id-=ParsersAttributes::ATTRIBUTE_COUNT;
+
+	if(id < extra_names.size())
+		return(extra_names[id]);
+	else
+		return("");
+}
+
+unsigned AttributeIdTable::getCount(void)
+{
+	QReadLocker locker(&table_lock);
+	return(ParsersAttributes::ATTRIBUTE_COUNT + extra_names.size());
+}
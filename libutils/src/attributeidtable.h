@@ -0,0 +1,71 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class AttributeIdTable
+\brief Interns the attributes names used by the parsers giving to each distinct name an unsigned id.
+ The names declared in ParsersAttributes have fixed ids (see ParsersAttributes::AttributeId) and are
+ searched on an immutable table without locking. Any other name (e.g. attributes referenced only in
+ schema files or composed at runtime) receives a new id on its first use. The ids are valid during the
+ whole execution and the methods can be called from any thread.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef ATTRIBUTE_ID_TABLE_H
+#define ATTRIBUTE_ID_TABLE_H
+
+#include "parsersattributes.h"
+#include <QHash>
+#include <QReadWriteLock>
+#include <vector>
+
+using namespace std;
+
+class AttributeIdTable {
+	private:
+		//! \brief Lock that controls the access to the names interned at runtime
+		static QReadWriteLock table_lock;
+
+		//! \brief Names interned at runtime (the id of the name is its position plus ParsersAttributes::ATTRIBUTE_COUNT)
+		static vector<QString> extra_names;
+
+		//! \brief Ids of the names interned at runtime
+		static QHash<QString, unsigned> extra_ids;
+
+		//! \brief Returns the names declared in ParsersAttributes in the order of their ids
+		static const vector<QString> &getDeclaredNames(void);
+
+		//! \brief Creates the hash of ids of the names declared in ParsersAttributes
+		static QHash<QString, unsigned> createDeclaredIds(void);
+
+		//! \brief Returns the ids of the names declared in ParsersAttributes
+		static const QHash<QString, unsigned> &getDeclaredIds(void);
+
+	public:
+		//! \brief Returns the id of the name interning it if needed
+		static unsigned getId(const QString &name);
+
+		//! \brief Returns the name of the specified id. An empty string is returned for unknown ids
+		static QString getName(unsigned id);
+
+		//! \brief Returns the amount of interned names (the ids are always lower than this value)
+		static unsigned getCount(void);
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "attributesmap.h"
+#include <algorithm>
+
+QString &AttributesMap::operator[](unsigned id)
+{
+	if(id >= values.size())
+		reserve(id + 1);
+
+	defined[id]=true;
+	return(values[id]);
+}
+
+QString &AttributesMap::operator[](const QString &name)
+{
+	return((*this)[AttributeIdTable::getId(name)]);
+}
+
+void AttributesMap::insert(unsigned id, const QString &value)
+{
+	if(!contains(id))
+		(*this)[id]=value;
+}
+
+bool AttributesMap::contains(unsigned id) const
+{
+	return(id < defined.size() && defined[id]);
+}
+
+QString *AttributesMap::find(unsigned id)
+{
+	if(contains(id))
+		return(&values[id]);
+	else
+		return(nullptr);
+}
+
+void AttributesMap::reserve(unsigned id_count)
+{
+	if(id_count > values.size())
+	{
+		/* The map is sized at once to hold all the declared attributes and, when an attribute created
+			 at runtime is stored, all the attributes interned so far avoiding successive reallocations */
+		if(id_count <= ParsersAttributes::ATTRIBUTE_COUNT)
+			id_count=ParsersAttributes::ATTRIBUTE_COUNT;
+		else
+			id_count=std::max(id_count, AttributeIdTable::getCount());
+
+		values.resize(id_count);
+		defined.resize(id_count, false);
+	}
+}
+
+void AttributesMap::clear(void)
+{
+	vector<QString>().swap(values);
+	vector<bool>().swap(defined);
+}
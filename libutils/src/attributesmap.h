@@ -0,0 +1,69 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class AttributesMap
+\brief Stores the attributes used by the SchemaParser to generate the code definition of the objects.
+ The values are kept on a flat array indexed by the attributes ids (see AttributeIdTable) so the model
+ objects write the attributes (e.g.: attributes[ParsersAttributes::ID_NAME]) and the compiled schema
+ templates read them by simply indexing the array. The maps are meant to be transient: they're filled
+ right before the code generation and released afterwards (see clear()).
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef ATTRIBUTES_MAP_H
+#define ATTRIBUTES_MAP_H
+
+#include "attributeidtable.h"
+
+class AttributesMap {
+	private:
+		//! \brief Values of the attributes indexed by their ids
+		vector<QString> values;
+
+		//! \brief Indicates the ids of the defined attributes (an attribute can be defined with an empty value)
+		vector<bool> defined;
+
+	public:
+		AttributesMap(void){}
+
+		//! \brief Returns the value of the attribute with the specified id defining it (empty) if needed
+		QString &operator[](unsigned id);
+
+		//! \brief Returns the value of the attribute with the specified name defining it (empty) if needed
+		QString &operator[](const QString &name);
+
+		//! \brief Defines the attribute with the specified value only if it's not defined yet
+		void insert(unsigned id, const QString &value);
+
+		//! \brief Returns if the attribute is defined
+		bool contains(unsigned id) const;
+
+		//! \brief Returns the address of the attribute's value or nullptr when the attribute isn't defined
+		QString *find(unsigned id);
+
+		/*! \brief Grows the map so the attributes with ids lower than 'id_count' can be defined without
+		 moving the values already stored. This way the addresses returned by find() stay valid */
+		void reserve(unsigned id_count);
+
+		//! \brief Removes all the attributes releasing the memory used by them
+		void clear(void);
+};
+
+#endif
@@ -216,7 +216,9 @@ QString Exception::messages[ERROR_COUNT][2]={
 	{"ERR_REG_EXT_NOT_HANDLING_TYPE", QT_TR_NOOP("The extension '%1' is registered as a data type and cannot have the attribute 'handles datatype' modified!")},
 	{"ERR_ALOC_INV_FK_RELATIONSHIP", QT_TR_NOOP("The fk relationship '%1' cannot be created because the foreign-key that represents it wasn't created on table '%2'!")},
 	{"ERR_ASG_INV_NAME_PATTERN", QT_TR_NOOP("Assignement of an invalid object name pattern to the relationship '%1'!")},
-	{"ERR_REF_INV_NAME_PATTERN_ID", QT_TR_NOOP("Reference to an invalid object name pattern id on the relationship '%1'!")}
+	{"ERR_REF_INV_NAME_PATTERN_ID", QT_TR_NOOP("Reference to an invalid object name pattern id on the relationship '%1'!")},
+	{"ERR_INV_XML_ROOT_ELEMENT", QT_TR_NOOP("The root element '%1' of the XML document doesn't match the root element '%2' expected by the DTD!")},
+	{"ERR_INV_SCRATCH_DATABASE", QT_TR_NOOP("The database `%1' used to simulate the export already exists on the server and wasn't created by pgModeler! Configure another scratch database in order to validate the model.")}
 };
 
 Exception::Exception(void)
@@ -35,7 +35,7 @@
 
 using namespace std;
 
-const int ERROR_COUNT=198;
+const int ERROR_COUNT=200;
 
 /*
  ErrorType enum format: ERR_[LIBRARY]_[[OPERATION_CODE][ERROR_CODE]] where:
@@ -247,7 +247,9 @@ enum ErrorType {
 	ERR_REG_EXT_NOT_HANDLING_TYPE,
 	ERR_ALOC_INV_FK_RELATIONSHIP,
 	ERR_ASG_INV_NAME_PATTERN,
-	ERR_REF_INV_NAME_PATTERN_ID
+	ERR_REF_INV_NAME_PATTERN_ID,
+	ERR_INV_XML_ROOT_ELEMENT,
+	ERR_INV_SCRATCH_DATABASE
 };
 
 class Exception {
@@ -22,6 +22,8 @@
 \brief Definition of parsers attributes namespace which stores a series of static strings constants used
  to reference the attributes of objects in SQL/XML generation methods.
  Each string stores the name of the attribute used in the schema file "sch" of the respective objects.
+ The attributes are declared once in PARSERS_ATTRIBUTES_LIST which generates the string constants and
+ the enumeration of their ids (see AttributeIdTable and AttributesMap).
 \note <strong>Creation date:</strong> 23/09/2008
 */
 
@@ -30,354 +32,381 @@
 
 #include <QString>
 
+/*! \brief List of all the attributes in the form ATTR_DECL([CONSTANT NAME], [ATTRIBUTE NAME]). Constants that
+ reuse the name of a previous one are declared as ATTR_ALIAS([CONSTANT NAME], [PREVIOUS CONSTANT NAME]) so both have the same id */
+#define PARSERS_ATTRIBUTES_LIST(ATTR_DECL, ATTR_ALIAS) \
+	ATTR_DECL(DEL_ACTION, "del-action") \
+	ATTR_DECL(UPD_ACTION, "upd-action") \
+	ATTR_DECL(ALIGNMENT, "alignment") \
+	ATTR_DECL(FIRING_TYPE, "firing-type") \
+	ATTR_DECL(ARGUMENTS, "arguments") \
+	ATTR_DECL(STORAGE, "storage") \
+	ATTR_DECL(SIGNATURE, "signature") \
+	ATTR_DECL(MODEL_AUTHOR, "author") \
+	ATTR_DECL(TEMPLATE_DB, "template") \
+	ATTR_DECL(CACHE, "cache") \
+	ATTR_DECL(CYCLE, "cycle") \
+	ATTR_DECL(DST_ENCODING, "dst-encoding") \
+	ATTR_DECL(SRC_ENCODING, "src-encoding") \
+	ATTR_DECL(ENCODING, "encoding") \
+	ATTR_DECL(COLUMNS, "columns") \
+	ATTR_DECL(COLUMN, "column") \
+	ATTR_DECL(COMMANDS, "commands") \
+	ATTR_DECL(DIF_SQL, "dif-sql") \
+	ATTR_DECL(COMMENT, "comment") \
+	ATTR_DECL(INTERNAL_LENGHT, "internal-length") \
+	ATTR_DECL(LENGTH, "length") \
+	ATTR_DECL(CONCURRENT, "concurrent") \
+	ATTR_DECL(INITIAL_COND, "initial-cond") \
+	ATTR_DECL(CONDITION, "condition") \
+	ATTR_DECL(TRUSTED, "trusted") \
+	ATTR_DECL(CONFIGURATION, "configuration") \
+	ATTR_DECL(CREATEDB, "createdb") \
+	ATTR_DECL(CREATEROLE, "createrole") \
+	ATTR_DECL(EXECUTION_COST, "execution-cost") \
+	ATTR_DECL(DECLARATION, "declaration") \
+	ATTR_DECL(DEFERRABLE, "deferrable") \
+	ATTR_DECL(DEFINITION, "definition") \
+	ATTR_DECL(DELIMITER, "delimiter") \
+	ATTR_DECL(DIMENSION, "dimension") \
+	ATTR_DECL(DIRECTORY, "directory") \
+	ATTR_DECL(OWNER, "owner") \
+	ATTR_DECL(ELEMENT, "element") \
+	ATTR_DECL(ELEMENTS, "elements") \
+	ATTR_DECL(ENCRYPTED, "encrypted") \
+	ATTR_DECL(ENUMARATIONS, "enumerations") \
+	ATTR_DECL(TABLESPACE, "tablespace") \
+	ATTR_DECL(SCHEMA, "schema") \
+	ATTR_DECL(COLLATION, "collation") \
+	ATTR_DECL(EVENTS, "events") \
+	ATTR_DECL(EXPRESSION, "expression") \
+	ATTR_DECL(EXPORT_TO_FILE, "export-to-file") \
+	ATTR_DECL(_FALSE_, "false") \
+	ATTR_DECL(FAMILY, "family") \
+	ATTR_DECL(FACTOR, "factor") \
+	ATTR_DECL(REDUCED_FORM, "reduced-form") \
+	ATTR_DECL(ANALYZE_FUNC, "analyze") \
+	ATTR_DECL(FINAL_FUNC, "final") \
+	ATTR_DECL(HANDLER_FUNC, "handler") \
+	ATTR_DECL(INLINE_FUNC, "inline") \
+	ATTR_DECL(INPUT_FUNC, "input") \
+	ATTR_DECL(JOIN_FUNC, "join") \
+	ATTR_DECL(OUTPUT_FUNC, "output") \
+	ATTR_DECL(RECV_FUNC, "receive") \
+	ATTR_DECL(RESTRICTION_FUNC, "restriction") \
+	ATTR_DECL(SEND_FUNC, "send") \
+	ATTR_DECL(TPMOD_IN_FUNC, "tpmodin") \
+	ATTR_DECL(TPMOD_OUT_FUNC, "tpmodout") \
+	ATTR_DECL(TRANSITION_FUNC, "transition") \
+	ATTR_DECL(VALIDATOR_FUNC, "validator") \
+	ATTR_DECL(OPERATOR_FUNC, "operfunc") \
+	ATTR_DECL(CANONICAL_FUNC, "canonical") \
+	ATTR_DECL(SUBTYPE_DIFF_FUNC, "subtypediff") \
+	ATTR_DECL(SUBTYPE, "subtype") \
+	ATTR_DECL(FUNCTION, "function") \
+	ATTR_DECL(TRIGGER_FUNC, "trigger-func") \
+	ATTR_DECL(TRIGGERS, "triggers") \
+	ATTR_DECL(HASHES, "hashes") \
+	ATTR_DECL(INHERIT, "inherit") \
+	ATTR_DECL(INCREMENT, "increment") \
+	ATTR_DECL(INDEXES, "indexes") \
+	ATTR_DECL(START, "start") \
+	ATTR_DECL(CONN_LIMIT, "connlimit") \
+	ATTR_DECL(LANGUAGE, "language") \
+	ATTR_DECL(LOGIN, "login") \
+	ATTR_DECL(MEMBER, "member") \
+	ATTR_DECL(MERGES, "merges") \
+	ATTR_DECL(NOT_nullptr, "not-null") \
+	ATTR_DECL(NAME, "name") \
+	ATTR_DECL(NAMES, "names") \
+	ATTR_DECL(STRATEGY_NUM, "stg-number") \
+	ATTR_DECL(OBJECT, "object") \
+	ATTR_DECL(SQL_OBJECT, "sql-object") \
+	ATTR_DECL(OBJECTS, "objects") \
+	ATTR_DECL(OIDS, "oids") \
+	ATTR_DECL(COMMUTATOR_OP, "commutator-op") \
+	ATTR_DECL(NEGATOR_OP, "negator-op") \
+	ATTR_DECL(SORT_OP, "sort-op") \
+	ATTR_DECL(OPERATOR, "operator") \
+	ATTR_DECL(DEFAULT, "default") \
+	ATTR_DECL(ADMIN_ROLES, "admin-roles") \
+	ATTR_DECL(MEMBER_ROLES, "member-roles") \
+	ATTR_DECL(REF_ROLES, "ref-roles") \
+	ATTR_DECL(ROLES, "roles") \
+	ATTR_DECL(ROLE, "role") \
+	ATTR_DECL(PARAM_IN, "in") \
+	ATTR_DECL(PARAM_OUT, "out") \
+	ATTR_DECL(PARAMETER, "parameter") \
+	ATTR_DECL(PARAMETERS, "parameters") \
+	ATTR_DECL(PER_ROW, "per-line") \
+	ATTR_DECL(BY_VALUE, "by-value") \
+	ATTR_ALIAS(OWNER_COLUMN, OWNER) \
+	ATTR_DECL(PRECISION, "precision") \
+	ATTR_DECL(ROW_AMOUNT, "row-amount") \
+	ATTR_DECL(REFER, "refer") \
+	ATTR_DECL(RULES, "rules") \
+	ATTR_DECL(CK_CONSTR, "ck-constr") \
+	ATTR_DECL(FK_CONSTR, "fk-constr") \
+	ATTR_DECL(PK_CONSTR, "pk-constr") \
+	ATTR_DECL(UQ_CONSTR, "uq-constr") \
+	ATTR_DECL(EX_CONSTR, "ex-constr") \
+	ATTR_DECL(CONSTRAINT, "constraint") \
+	ATTR_DECL(CONSTRAINTS, "constraints") \
+	ATTR_DECL(RETURNS_SETOF, "returns-setof") \
+	ATTR_DECL(PASSWORD, "password") \
+	ATTR_DECL(SUPERUSER, "superuser") \
+	ATTR_DECL(REF_TABLE, "ref-table") \
+	ATTR_DECL(TABLE, "table") \
+	ATTR_DECL(ANCESTOR_TABLE, "ancestor-table") \
+	ATTR_DECL(BASE_TYPE, "base") \
+	ATTR_DECL(BEHAVIOR_TYPE, "behavior-type") \
+	ATTR_DECL(COMPARISON_TYPE, "comparison-type") \
+	ATTR_DECL(COMPOSITE_TYPE, "composite") \
+	ATTR_DECL(CAST_TYPE, "cast-type") \
+	ATTR_DECL(DEFER_TYPE, "defer-type") \
+	ATTR_DECL(DEST_TYPE, "destiny-type") \
+	ATTR_DECL(RIGHT_TYPE, "right-type") \
+	ATTR_DECL(ENUM_TYPE, "enumeration") \
+	ATTR_DECL(LEFT_TYPE, "left-type") \
+	ATTR_DECL(STATE_TYPE, "state-type") \
+	ATTR_DECL(EVENT_TYPE, "event-type") \
+	ATTR_DECL(EXEC_TYPE, "exec-type") \
+	ATTR_DECL(FUNCTION_TYPE, "function-type") \
+	ATTR_DECL(INDEX_TYPE, "index-type") \
+	ATTR_DECL(SOURCE_TYPE, "source-type") \
+	ATTR_DECL(ROLE_TYPE, "role-type") \
+	ATTR_DECL(REF_TYPE, "ref-type") \
+	ATTR_DECL(RETURN_TYPE, "return-type") \
+	ATTR_DECL(SECURITY_TYPE, "security-type") \
+	ATTR_DECL(TYPE, "type") \
+	ATTR_DECL(TYPES, "types") \
+	ATTR_DECL(UNIQUE, "unique") \
+	ATTR_DECL(VALIDITY, "validity") \
+	ATTR_DECL(MAX_VALUE, "max-value") \
+	ATTR_DECL(MIN_VALUE, "min-value") \
+	ATTR_DECL(DEFAULT_VALUE, "default-value") \
+	ATTR_DECL(VALUES, "values") \
+	ATTR_DECL(_TRUE_, "true") \
+	ATTR_DECL(IMPLICIT, "implicit") \
+	ATTR_DECL(ASSIGNMENT, "assignment") \
+	ATTR_DECL(NONE, "none") \
+	ATTR_DECL(SRC_COLUMNS, "src-columns") \
+	ATTR_DECL(DST_COLUMNS, "dst-columns") \
+	ATTR_DECL(X_POS, "x") \
+	ATTR_DECL(Y_POS, "y") \
+	ATTR_DECL(POSITION, "position") \
+	ATTR_DECL(INS_EVENT, "ins-event") \
+	ATTR_DECL(DEL_EVENT, "del-event") \
+	ATTR_DECL(UPD_EVENT, "upd-event") \
+	ATTR_DECL(TRUNC_EVENT, "trunc-event") \
+	ATTR_DECL(REFERENCES, "references") \
+	ATTR_DECL(REFERENCE, "reference") \
+	ATTR_DECL(SELECT_EXP, "select-exp") \
+	ATTR_DECL(FROM_EXP, "from-exp") \
+	ATTR_DECL(SIMPLE_EXP, "simple-exp") \
+	ATTR_DECL(ALIAS, "alias") \
+	ATTR_DECL(COLUMN_ALIAS, "column-alias") \
+	ATTR_DECL(SRC_REQUIRED, "src-required") \
+	ATTR_DECL(DST_REQUIRED, "dst-required") \
+	ATTR_DECL(SRC_TABLE, "src-table") \
+	ATTR_DECL(DST_TABLE, "dst-table") \
+	ATTR_DECL(IDENTIFIER, "identifier") \
+	ATTR_DECL(POINTS, "points") \
+	ATTR_DECL(LINE, "line") \
+	ATTR_DECL(PROTECTED, "protected") \
+	ATTR_DECL(RELATIONSHIP, "relationship") \
+	ATTR_DECL(RELATIONSHIP_11, "rel11") \
+	ATTR_DECL(RELATIONSHIP_1N, "rel1n") \
+	ATTR_DECL(RELATIONSHIP_NN, "relnn") \
+	ATTR_DECL(RELATIONSHIP_GEN, "relgen") \
+	ATTR_DECL(RELATIONSHIP_DEP, "reldep") \
+	ATTR_DECL(RELATION_TAB_VIEW, "reltv") \
+	ATTR_DECL(RELATIONSHIP_FK, "relfk") \
+	ATTR_DECL(LABEL, "label") \
+	ATTR_DECL(LABELS_POS, "labels-pos") \
+	ATTR_DECL(DST_LABEL, "dst-label") \
+	ATTR_DECL(SRC_LABEL, "src-label") \
+	ATTR_DECL(NAME_LABEL, "name-label") \
+	ATTR_DECL(DB_MODEL, "dbmodel") \
+	ATTR_DECL(SHELL_TYPES, "shell-types") \
+	ATTR_DECL(LIKE_TYPE, "like-type") \
+	ATTR_DECL(CATEGORY, "category") \
+	ATTR_DECL(PREFERRED, "preferred") \
+	ATTR_DECL(ITALIC, "italic") \
+	ATTR_DECL(BOLD, "bold") \
+	ATTR_DECL(UNDERLINE, "underline") \
+	ATTR_DECL(OP_CLASS, "opclass") \
+	ATTR_DECL(nullptrS_FIRST, "nulls-first") \
+	ATTR_DECL(ASC_ORDER, "asc-order") \
+	ATTR_DECL(DECL_IN_TABLE, "decl-in-table") \
+	ATTR_DECL(HIGHLIGHT_ORDER, "highlight-order") \
+	ATTR_DECL(GROUP, "group") \
+	ATTR_DECL(BACKGROUND_COLOR, "background-color") \
+	ATTR_DECL(FOREGROUND_COLOR, "foreground-color") \
+	ATTR_DECL(CASE_SENSITIVE, "case-sensitive") \
+	ATTR_DECL(INITIAL_EXP, "initial-exp") \
+	ATTR_DECL(VALUE, "value") \
+	ATTR_DECL(REGULAR_EXP, "regexp") \
+	ATTR_DECL(WILDCARD, "wildcard") \
+	ATTR_DECL(WORD_SEPARATORS, "word-separators") \
+	ATTR_DECL(WORD_DELIMITERS, "word-delimiters") \
+	ATTR_DECL(IGNORED_CHARS, "ignored-chars") \
+	ATTR_DECL(LOOKAHEAD_CHAR, "lookahead-char") \
+	ATTR_DECL(PARTIAL_MATCH, "partial-match") \
+	ATTR_DECL(IO_CAST, "io-cast") \
+	ATTR_DECL(WINDOW_FUNC, "window-func") \
+	ATTR_DECL(RETURN_TABLE, "return-table") \
+	ATTR_DECL(_LC_COLLATE_, "lc-collate") \
+	ATTR_DECL(_LC_CTYPE_, "lc-ctype") \
+	ATTR_DECL(INDEX_ELEMENT, "idxelement") \
+	ATTR_DECL(EXCLUDE_ELEMENT, "excelement") \
+	ATTR_DECL(PERMISSION, "permission") \
+	ATTR_DECL(GRANT_OP, "grant-op") \
+	ATTR_DECL(SELECT_PRIV, "select") \
+	ATTR_DECL(INSERT_PRIV, "insert") \
+	ATTR_DECL(UPDATE_PRIV, "update") \
+	ATTR_DECL(DELETE_PRIV, "delete") \
+	ATTR_DECL(TRUNCATE_PRIV, "truncate") \
+	ATTR_ALIAS(REFERENCES_PRIV, REFERENCES) \
+	ATTR_DECL(TRIGGER_PRIV, "trigger") \
+	ATTR_DECL(CREATE_PRIV, "create") \
+	ATTR_DECL(CONNECT_PRIV, "connect") \
+	ATTR_DECL(TEMPORARY_PRIV, "temporary") \
+	ATTR_DECL(EXECUTE_PRIV, "execute") \
+	ATTR_DECL(USAGE_PRIV, "usage") \
+	ATTR_DECL(PARENT, "parent") \
+	ATTR_DECL(PRIVILEGES, "privileges") \
+	ATTR_DECL(PRIVILEGES_GOP, "privileges-gop") \
+	ATTR_DECL(LIBRARY, "library") \
+	ATTR_DECL(SYMBOL, "symbol") \
+	ATTR_DECL(WITH_TIMEZONE, "with-timezone") \
+	ATTR_DECL(INTERVAL_TYPE, "interval-type") \
+	ATTR_DECL(FAST_UPDATE, "fast-update") \
+	ATTR_DECL(TABLE_NAME, "table-name") \
+	ATTR_DECL(TABLE_SCHEMA_NAME, "table-schema-name") \
+	ATTR_DECL(VIEW_SCHEMA_NAME, "view-schema-name") \
+	ATTR_DECL(VIEW_NAME, "view-name") \
+	ATTR_DECL(ATTRIBUTE, "attribute") \
+	ATTR_DECL(GLOBAL, "global") \
+	ATTR_DECL(FONT, "font") \
+	ATTR_DECL(OBJECT_TYPE, "object-type") \
+	ATTR_DECL(COLOR, "color") \
+	ATTR_DECL(SIZE, "size") \
+	ATTR_DECL(ID, "id") \
+	ATTR_DECL(LOCKER_BODY, "locker-body") \
+	ATTR_DECL(LOCKER_ARC, "locker-arc") \
+	ATTR_DECL(BORDER_COLOR, "border-color") \
+	ATTR_DECL(FILL_COLOR, "fill-color") \
+	ATTR_DECL(TABLE_TITLE, "table-title") \
+	ATTR_DECL(VIEW_TITLE, "view-title") \
+	ATTR_DECL(TABLE_BODY, "table-body") \
+	ATTR_DECL(VIEW_BODY, "view-body") \
+	ATTR_DECL(VIEW_EXT_BODY, "view-ext-body") \
+	ATTR_DECL(TABLE_EXT_BODY, "table-ext-body") \
+	ATTR_DECL(NN_COLUMN, "nn-column") \
+	ATTR_DECL(FK_COLUMN, "fk-column") \
+	ATTR_DECL(PK_COLUMN, "pk-column") \
+	ATTR_DECL(UQ_COLUMN, "uq-column") \
+	ATTR_DECL(INH_COLUMN, "inh-column") \
+	ATTR_DECL(PROT_COLUMN, "prot-column") \
+	ATTR_DECL(OBJ_SELECTION, "obj-selection") \
+	ATTR_DECL(REF_COLUMN, "ref-column") \
+	ATTR_DECL(SPECIAL_PK_COLS, "special-pk-cols") \
+	ATTR_DECL(OP_LIST_SIZE, "op-list-size") \
+	ATTR_DECL(AUTOSAVE_INTERVAL, "autosave-interval") \
+	ATTR_DECL(PAPER_TYPE, "paper-type") \
+	ATTR_DECL(PAPER_ORIENTATION, "paper-orientation") \
+	ATTR_DECL(PAPER_MARGIN, "paper-margin") \
+	ATTR_DECL(SAVE_SESSION, "save-session") \
+	ATTR_DECL(PORTRAIT, "portrait") \
+	ATTR_DECL(LANDSCAPE, "landscape") \
+	ATTR_DECL(GRID_SIZE, "grid-size") \
+	ATTR_DECL(PATH, "path") \
+	ATTR_DECL(_FILE_, "file") \
+	ATTR_DECL(FILE_TOOLBAR, "fileToolbar") \
+	ATTR_DECL(EDIT_TOOLBAR, "editToolbar") \
+	ATTR_DECL(VIEW_TOOLBAR, "viewToolbar") \
+	ATTR_DECL(MODEL_TOOLBAR, "modelToolbar") \
+	ATTR_DECL(PLUGINS_TOOLBAR, "pluginsToolbar") \
+	ATTR_DECL(OPERATIONS_DOCK, "operationsDock") \
+	ATTR_DECL(OBJECTS_DOCK, "objectsDock") \
+	ATTR_DECL(LEFT, "left") \
+	ATTR_DECL(RIGHT, "right") \
+	ATTR_DECL(BOTTOM, "bottom") \
+	ATTR_DECL(TOP, "top") \
+	ATTR_DECL(VISIBLE, "visible") \
+	ATTR_DECL(POSITION_INFO, "pos-info") \
+	ATTR_DECL(CONNECTIONS, "connections") \
+	ATTR_DECL(VARIATION, "variation") \
+	ATTR_DECL(SPATIAL_TYPE, "spatial-type") \
+	ATTR_DECL(COLS_COMMENT, "cols-comment") \
+	ATTR_DECL(PRINT_GRID, "print-grid") \
+	ATTR_DECL(PRINT_PG_NUM, "print-pg-num") \
+	ATTR_DECL(SRID, "srid") \
+	ATTR_DECL(RECT_VISIBLE, "rect-visible") \
+	ATTR_DECL(USE_SORTING, "use-sorting") \
+	ATTR_DECL(STORAGE_PARAMS, "stg-params") \
+	ATTR_DECL(DDL_END_TOKEN, "-- ddl-end --") \
+	ATTR_DECL(SQL_DISABLED, "sql-disabled") \
+	ATTR_DECL(REVOKE, "revoke") \
+	ATTR_DECL(CASCADE, "cascade") \
+	ATTR_DECL(CTE_EXPRESSION, "cte-exp") \
+	ATTR_DECL(LOCALE, "locale") \
+	ATTR_DECL(FOR_ORDER_BY, "for-order-by") \
+	ATTR_DECL(OP_FAMILY, "opfamily") \
+	ATTR_DECL(REPLICATION, "replication") \
+	ATTR_DECL(NO_INHERIT, "no-inherit") \
+	ATTR_DECL(COPY_TABLE, "copy-table") \
+	ATTR_DECL(COPY_MODE, "copy-mode") \
+	ATTR_DECL(COPY_OPTIONS, "copy-options") \
+	ATTR_DECL(TYPE_ATTRIBUTE, "typeattrib") \
+	ATTR_DECL(COLLATABLE, "collatable") \
+	ATTR_DECL(RANGE_TYPE, "range") \
+	ATTR_DECL(HANDLES_TYPE, "handles-type") \
+	ATTR_DECL(CUR_VERSION, "cur-version") \
+	ATTR_DECL(OLD_VERSION, "old-version") \
+	ATTR_DECL(RECENT_MODELS, "recent-models") \
+	ATTR_DECL(RECENT, "recent") \
+	ATTR_DECL(HIDE_REL_NAME, "hide-rel-name") \
+	ATTR_DECL(HIDE_EXT_ATTRIBS, "hide-ext-attribs") \
+	ATTR_DECL(SRC_COL_PATTERN, "src-col-pattern") \
+	ATTR_DECL(DST_COL_PATTERN, "dst-col-pattern") \
+	ATTR_DECL(PK_PATTERN, "pk-pattern") \
+	ATTR_DECL(UQ_PATTERN, "uq-pattern") \
+	ATTR_DECL(SRC_FK_PATTERN, "src-fk-pattern") \
+	ATTR_DECL(DST_FK_PATTERN, "dst-fk-pattern") \
+	ATTR_DECL(COL_INDEXES, "col-indexes") \
+	ATTR_DECL(ATTRIB_INDEXES, "attrib-indexes") \
+	ATTR_DECL(CONSTR_INDEXES, "constr-indexes") \
+	ATTR_DECL(ICON, "icon") \
+	ATTR_DECL(ROOT_DIR, "root-dir") \
+	ATTR_DECL(FILE_ASSOCIATED, "file-associated")
+
 namespace ParsersAttributes {
-	static const QString
-	DEL_ACTION="del-action",
-	UPD_ACTION="upd-action",
-	ALIGNMENT="alignment",
-	FIRING_TYPE="firing-type",
-	ARGUMENTS="arguments",
-	STORAGE="storage",
-	SIGNATURE="signature",
-	MODEL_AUTHOR="author",
-	TEMPLATE_DB="template",
-	CACHE="cache",
-	CYCLE="cycle",
-	DST_ENCODING="dst-encoding",
-	SRC_ENCODING="src-encoding",
-	ENCODING="encoding",
-	COLUMNS="columns",
-	COLUMN="column",
-	COMMANDS="commands",
-	DIF_SQL="dif-sql",
-	COMMENT="comment",
-	INTERNAL_LENGHT="internal-length",
-	LENGTH="length",
-	CONCURRENT="concurrent",
-	INITIAL_COND="initial-cond",
-	CONDITION="condition",
-	TRUSTED="trusted",
-	CONFIGURATION="configuration",
-	CREATEDB="createdb",
-	CREATEROLE="createrole",
-	EXECUTION_COST="execution-cost",
-	DECLARATION="declaration",
-	DEFERRABLE="deferrable",
-	DEFINITION="definition",
-	DELIMITER="delimiter",
-	DIMENSION="dimension",
-	DIRECTORY="directory",
-	OWNER="owner",
-	ELEMENT="element",
-	ELEMENTS="elements",
-	ENCRYPTED="encrypted",
-	ENUMARATIONS="enumerations",
-	TABLESPACE="tablespace",
-	SCHEMA="schema",
-	COLLATION="collation",
-	EVENTS="events",
-	EXPRESSION="expression",
-	EXPORT_TO_FILE="export-to-file",
-	_FALSE_="false",
-	FAMILY="family",
-	FACTOR="factor",
-	REDUCED_FORM="reduced-form",
-	ANALYZE_FUNC="analyze",
-	FINAL_FUNC="final",
-	HANDLER_FUNC="handler",
-	INLINE_FUNC="inline",
-	INPUT_FUNC="input",
-	JOIN_FUNC="join",
-	OUTPUT_FUNC="output",
-	RECV_FUNC="receive",
-	RESTRICTION_FUNC="restriction",
-	SEND_FUNC="send",
-	TPMOD_IN_FUNC="tpmodin",
-	TPMOD_OUT_FUNC="tpmodout",
-	TRANSITION_FUNC="transition",
-	VALIDATOR_FUNC="validator",
-	OPERATOR_FUNC="operfunc",
-	CANONICAL_FUNC="canonical",
-	SUBTYPE_DIFF_FUNC="subtypediff",
-	SUBTYPE="subtype",
-	FUNCTION="function",
-	TRIGGER_FUNC="trigger-func",
-	TRIGGERS="triggers",
-	HASHES="hashes",
-	INHERIT="inherit",
-	INCREMENT="increment",
-	INDEXES="indexes",
-	START="start",
-	CONN_LIMIT="connlimit",
-	LANGUAGE="language",
-	LOGIN="login",
-	MEMBER="member",
-	MERGES="merges",
-	NOT_nullptr="not-null",
-	NAME="name",
-	NAMES="names",
-	STRATEGY_NUM="stg-number",
-	OBJECT="object",
-	SQL_OBJECT="sql-object",
-	OBJECTS="objects",
-	OIDS="oids",
-	COMMUTATOR_OP="commutator-op",
-	NEGATOR_OP="negator-op",
-	SORT_OP="sort-op",
-	OPERATOR="operator",
-	DEFAULT="default",
-	ADMIN_ROLES="admin-roles",
-	MEMBER_ROLES="member-roles",
-	REF_ROLES="ref-roles",
-	ROLES="roles",
-	ROLE="role",
-	PARAM_IN="in",
-	PARAM_OUT="out",
-	PARAMETER="parameter",
-	PARAMETERS="parameters",
-	PER_ROW="per-line",
-	BY_VALUE="by-value",
-	OWNER_COLUMN="owner",
-	PRECISION="precision",
-	ROW_AMOUNT="row-amount",
-	REFER="refer",
-	RULES="rules",
-	CK_CONSTR="ck-constr",
-	FK_CONSTR="fk-constr",
-	PK_CONSTR="pk-constr",
-	UQ_CONSTR="uq-constr",
-	EX_CONSTR="ex-constr",
-	CONSTRAINT="constraint",
-	CONSTRAINTS="constraints",
-	RETURNS_SETOF="returns-setof",
-	PASSWORD="password",
-	SUPERUSER="superuser",
-	REF_TABLE="ref-table",
-	TABLE="table",
-	ANCESTOR_TABLE="ancestor-table",
-	BASE_TYPE="base",
-	BEHAVIOR_TYPE="behavior-type",
-	COMPARISON_TYPE="comparison-type",
-	COMPOSITE_TYPE="composite",
-	CAST_TYPE="cast-type",
-	DEFER_TYPE="defer-type",
-	DEST_TYPE="destiny-type",
-	RIGHT_TYPE="right-type",
-	ENUM_TYPE="enumeration",
-	LEFT_TYPE="left-type",
-	STATE_TYPE="state-type",
-	EVENT_TYPE="event-type",
-	EXEC_TYPE="exec-type",
-	FUNCTION_TYPE="function-type",
-	INDEX_TYPE="index-type",
-	SOURCE_TYPE="source-type",
-	ROLE_TYPE="role-type",
-	REF_TYPE="ref-type",
-	RETURN_TYPE="return-type",
-	SECURITY_TYPE="security-type",
-	TYPE="type",
-	TYPES="types",
-	UNIQUE="unique",
-	VALIDITY="validity",
-	MAX_VALUE="max-value",
-	MIN_VALUE="min-value",
-	DEFAULT_VALUE="default-value",
-	VALUES="values",
-	_TRUE_="true",
-	IMPLICIT="implicit",
-	ASSIGNMENT="assignment",
-	NONE="none",
-	SRC_COLUMNS="src-columns",
-	DST_COLUMNS="dst-columns",
-	X_POS="x",
-	Y_POS="y",
-	POSITION="position",
-	INS_EVENT="ins-event",
-	DEL_EVENT="del-event",
-	UPD_EVENT="upd-event",
-	TRUNC_EVENT="trunc-event",
-	REFERENCES="references",
-	REFERENCE="reference",
-	SELECT_EXP="select-exp",
-	FROM_EXP="from-exp",
-	SIMPLE_EXP="simple-exp",
-	ALIAS="alias",
-	COLUMN_ALIAS="column-alias",
-	SRC_REQUIRED="src-required",
-	DST_REQUIRED="dst-required",
-	SRC_TABLE="src-table",
-	DST_TABLE="dst-table",
-	IDENTIFIER="identifier",
-	POINTS="points",
-	LINE="line",
-	PROTECTED="protected",
-	RELATIONSHIP="relationship",
-	RELATIONSHIP_11="rel11",
-	RELATIONSHIP_1N="rel1n",
-	RELATIONSHIP_NN="relnn",
-	RELATIONSHIP_GEN="relgen",
-	RELATIONSHIP_DEP="reldep",
-	RELATION_TAB_VIEW="reltv",
-	RELATIONSHIP_FK="relfk",
-	LABEL="label",
-	LABELS_POS="labels-pos",
-	DST_LABEL="dst-label",
-	SRC_LABEL="src-label",
-	NAME_LABEL="name-label",
-	DB_MODEL="dbmodel",
-	SHELL_TYPES="shell-types",
-	LIKE_TYPE="like-type",
-	CATEGORY="category",
-	PREFERRED="preferred",
-	ITALIC="italic",
-	BOLD="bold",
-	UNDERLINE="underline",
-	OP_CLASS="opclass",
-	nullptrS_FIRST="nulls-first",
-	ASC_ORDER="asc-order",
-	DECL_IN_TABLE="decl-in-table",
-	HIGHLIGHT_ORDER="highlight-order",
-	GROUP="group",
-	BACKGROUND_COLOR="background-color",
-	FOREGROUND_COLOR="foreground-color",
-	CASE_SENSITIVE="case-sensitive",
-	INITIAL_EXP="initial-exp",
-	VALUE="value",
-	REGULAR_EXP="regexp",
-	WILDCARD="wildcard",
-	WORD_SEPARATORS="word-separators",
-	WORD_DELIMITERS="word-delimiters",
-	IGNORED_CHARS="ignored-chars",
-	LOOKAHEAD_CHAR="lookahead-char",
-	PARTIAL_MATCH="partial-match",
-	IO_CAST="io-cast",
-	WINDOW_FUNC="window-func",
-	RETURN_TABLE="return-table",
-	_LC_COLLATE_="lc-collate",
-	_LC_CTYPE_="lc-ctype",
-	INDEX_ELEMENT="idxelement",
-	EXCLUDE_ELEMENT="excelement",
-	PERMISSION="permission",
-	GRANT_OP="grant-op",
-	SELECT_PRIV="select",
-	INSERT_PRIV="insert",
-	UPDATE_PRIV="update",
-	DELETE_PRIV="delete",
-	TRUNCATE_PRIV="truncate",
-	REFERENCES_PRIV="references",
-	TRIGGER_PRIV="trigger",
-	CREATE_PRIV="create",
-	CONNECT_PRIV="connect",
-	TEMPORARY_PRIV="temporary",
-	EXECUTE_PRIV="execute",
-	USAGE_PRIV="usage",
-	PARENT="parent",
-	PRIVILEGES="privileges",
-	PRIVILEGES_GOP="privileges-gop",
-	LIBRARY="library",
-	SYMBOL="symbol",
-	WITH_TIMEZONE="with-timezone",
-	INTERVAL_TYPE="interval-type",
-	FAST_UPDATE="fast-update",
-	TABLE_NAME="table-name",
-	TABLE_SCHEMA_NAME="table-schema-name",
-	VIEW_SCHEMA_NAME="view-schema-name",
-	VIEW_NAME="view-name",
-	ATTRIBUTE="attribute",
-	GLOBAL="global",
-	FONT="font",
-	OBJECT_TYPE="object-type",
-	COLOR="color",
-	SIZE="size",
-	ID="id",
-	LOCKER_BODY="locker-body",
-	LOCKER_ARC="locker-arc",
-	BORDER_COLOR="border-color",
-	FILL_COLOR="fill-color",
-	TABLE_TITLE="table-title",
-	VIEW_TITLE="view-title",
-	TABLE_BODY="table-body",
-	VIEW_BODY="view-body",
-	VIEW_EXT_BODY="view-ext-body",
-	TABLE_EXT_BODY="table-ext-body",
-	NN_COLUMN="nn-column",
-	FK_COLUMN="fk-column",
-	PK_COLUMN="pk-column",
-	UQ_COLUMN="uq-column",
-	INH_COLUMN="inh-column",
-	PROT_COLUMN="prot-column",
-	OBJ_SELECTION="obj-selection",
-	REF_COLUMN="ref-column",
-	SPECIAL_PK_COLS="special-pk-cols",
-	OP_LIST_SIZE="op-list-size",
-	AUTOSAVE_INTERVAL="autosave-interval",
-	PAPER_TYPE="paper-type",
-	PAPER_ORIENTATION="paper-orientation",
-	PAPER_MARGIN="paper-margin",
-	SAVE_SESSION="save-session",
-	PORTRAIT="portrait",
-	LANDSCAPE="landscape",
-	GRID_SIZE="grid-size",
-	PATH="path",
-	_FILE_="file",
-	FILE_TOOLBAR="fileToolbar",
-	EDIT_TOOLBAR="editToolbar",
-	VIEW_TOOLBAR="viewToolbar",
-	MODEL_TOOLBAR="modelToolbar",
-	PLUGINS_TOOLBAR="pluginsToolbar",
-	OPERATIONS_DOCK="operationsDock",
-	OBJECTS_DOCK="objectsDock",
-	LEFT="left",
-	RIGHT="right",
-	BOTTOM="bottom",
-	TOP="top",
-	VISIBLE="visible",
-	POSITION_INFO="pos-info",
-	CONNECTIONS="connections",
-	VARIATION="variation",
-	SPATIAL_TYPE="spatial-type",
-	COLS_COMMENT="cols-comment",
-	PRINT_GRID="print-grid",
-	PRINT_PG_NUM="print-pg-num",
-	SRID="srid",
-	RECT_VISIBLE="rect-visible",
-	USE_SORTING="use-sorting",
-	STORAGE_PARAMS="stg-params",
-	DDL_END_TOKEN="-- ddl-end --",
-	SQL_DISABLED="sql-disabled",
-	REVOKE="revoke",
-	CASCADE="cascade",
-	CTE_EXPRESSION="cte-exp",
-	LOCALE="locale",
-	FOR_ORDER_BY="for-order-by",
-	OP_FAMILY="opfamily",
-	REPLICATION="replication",
-	NO_INHERIT="no-inherit",
-	COPY_TABLE="copy-table",
-	COPY_MODE="copy-mode",
-	COPY_OPTIONS="copy-options",
-	TYPE_ATTRIBUTE="typeattrib",
-	COLLATABLE="collatable",
-	RANGE_TYPE="range",
-	HANDLES_TYPE="handles-type",
-	CUR_VERSION="cur-version",
-	OLD_VERSION="old-version",
-	RECENT_MODELS="recent-models",
-	RECENT="recent",
-	HIDE_REL_NAME="hide-rel-name",
-	HIDE_EXT_ATTRIBS="hide-ext-attribs",
-	SRC_COL_PATTERN="src-col-pattern",
-	DST_COL_PATTERN="dst-col-pattern",
-	PK_PATTERN="pk-pattern",
-	UQ_PATTERN="uq-pattern",
-	SRC_FK_PATTERN="src-fk-pattern",
-	DST_FK_PATTERN="dst-fk-pattern",
-	COL_INDEXES="col-indexes",
-	ATTRIB_INDEXES="attrib-indexes",
-	CONSTR_INDEXES="constr-indexes",
-	ICON="icon",
-	ROOT_DIR="root-dir",
-	FILE_ASSOCIATED="file-associated";
+	#define PARSERS_ATTRIBUTE_STRING(cnst, name) static const QString cnst=name;
+	#define PARSERS_ATTRIBUTE_ALIAS(cnst, orig) static const QString cnst=orig;
+	PARSERS_ATTRIBUTES_LIST(PARSERS_ATTRIBUTE_STRING, PARSERS_ATTRIBUTE_ALIAS)
+	#undef PARSERS_ATTRIBUTE_STRING
+	#undef PARSERS_ATTRIBUTE_ALIAS
+
+	/*! \brief Compile-time identifiers of the attributes (ID_[CONSTANT NAME]). These are the same
+	 ids returned by AttributeIdTable::getId() for the names above, so they can be used to index
+	 the attributes maps directly, e.g.: attributes[ParsersAttributes::ID_NAME] */
+	#define PARSERS_ATTRIBUTE_ID(cnst, name) ID_##cnst,
+	#define PARSERS_ATTRIBUTE_NO_ID(cnst, orig)
+	enum AttributeId : unsigned {
+		PARSERS_ATTRIBUTES_LIST(PARSERS_ATTRIBUTE_ID, PARSERS_ATTRIBUTE_NO_ID)
+		ATTRIBUTE_COUNT
+	};
+	#undef PARSERS_ATTRIBUTE_ID
+	#undef PARSERS_ATTRIBUTE_NO_ID
+
+	//! \brief The aliases share the id of the constant that first declared the name
+	#define PARSERS_ATTRIBUTE_NO_ID(cnst, name)
+	#define PARSERS_ATTRIBUTE_ALIAS_ID(cnst, orig) static constexpr AttributeId ID_##cnst=ID_##orig;
+	PARSERS_ATTRIBUTES_LIST(PARSERS_ATTRIBUTE_NO_ID, PARSERS_ATTRIBUTE_ALIAS_ID)
+	#undef PARSERS_ATTRIBUTE_NO_ID
+	#undef PARSERS_ATTRIBUTE_ALIAS_ID
 }
 
 #endif
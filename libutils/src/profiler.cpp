@@ -0,0 +1,148 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "profiler.h"
+
+QMutex Profiler::entries_mutex;
+map<QString, Profiler::Entry *> Profiler::entries;
+
+Profiler::Entry::Entry(bool timer) : count(0), elapsed(0)
+{
+	this->timer=timer;
+}
+
+bool Profiler::Entry::isTimer(void)
+{
+	return(timer);
+}
+
+void Profiler::Entry::increment(qint64 amount)
+{
+	count.fetch_add(amount, memory_order_relaxed);
+}
+
+void Profiler::Entry::addMeasurement(qint64 nsecs)
+{
+	count.fetch_add(1, memory_order_relaxed);
+	elapsed.fetch_add(nsecs, memory_order_relaxed);
+}
+
+qint64 Profiler::Entry::getCount(void)
+{
+	return(count.load(memory_order_relaxed));
+}
+
+qint64 Profiler::Entry::getElapsed(void)
+{
+	return(elapsed.load(memory_order_relaxed));
+}
+
+void Profiler::Entry::reset(void)
+{
+	count.store(0, memory_order_relaxed);
+	elapsed.store(0, memory_order_relaxed);
+}
+
+Profiler::Timer::Timer(Entry *entry, bool start)
+{
+	this->entry=entry;
+	running=false;
+
+	if(start)
+		this->start();
+}
+
+Profiler::Timer::~Timer(void)
+{
+	stop();
+}
+
+void Profiler::Timer::start(void)
+{
+	timer.start();
+	running=true;
+}
+
+void Profiler::Timer::stop(void)
+{
+	if(running && entry)
+		entry->addMeasurement(timer.nsecsElapsed());
+
+	running=false;
+}
+
+Profiler::Entry *Profiler::getEntry(const QString &name, bool timer)
+{
+	QMutexLocker locker(&entries_mutex);
+	map<QString, Entry *>::iterator itr=entries.find(name);
+
+	if(itr!=entries.end())
+		return(itr->second);
+
+	return(entries[name]=new Entry(timer));
+}
+
+Profiler::Entry *Profiler::getTimer(const QString &name)
+{
+	return(getEntry(name, true));
+}
+
+Profiler::Entry *Profiler::getCounter(const QString &name)
+{
+	return(getEntry(name, false));
+}
+
+void Profiler::reset(void)
+{
+	QMutexLocker locker(&entries_mutex);
+	map<QString, Entry *>::iterator itr;
+
+	for(itr=entries.begin(); itr!=entries.end(); itr++)
+		itr->second->reset();
+}
+
+QString Profiler::getReport(void)
+{
+	QMutexLocker locker(&entries_mutex);
+	map<QString, Entry *>::iterator itr;
+	QString report, timers, counters;
+	qint64 count, elapsed;
+
+	for(itr=entries.begin(); itr!=entries.end(); itr++)
+	{
+		count=itr->second->getCount();
+
+		if(itr->second->isTimer())
+		{
+			elapsed=itr->second->getElapsed();
+			timers+=QString("%1 %2 %3 %4\n").arg(itr->first, -48)
+							.arg(count, 10)
+							.arg(elapsed / 1000000.0, 12, 'f', 3)
+							.arg(count > 0 ? elapsed / (count * 1000000.0) : 0, 12, 'f', 3);
+		}
+		else
+			counters+=QString("%1 %2\n").arg(itr->first, -48).arg(count, 10);
+	}
+
+	report=QString("%1 %2 %3 %4\n").arg("Phase", -48).arg("Calls", 10).arg("Total (ms)", 12).arg("Avg. (ms)", 12);
+	report+=timers;
+	report+=QString("\n%1 %2\n").arg("Counter", -48).arg("Value", 10);
+	report+=counters;
+
+	return(report);
+}
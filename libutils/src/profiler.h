@@ -0,0 +1,112 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class Profiler
+\brief Collects the timing and counting data of the main phases of the application (model loading, relationships
+ validation, code generation, export, etc). Each phase is identified by a name in the form [module].[phase] and
+ is registered on its first use. The places that are executed very often keep the returned entry on a static
+ variable so only an atomic operation is made on each measurement. The times of phases executed by several threads
+ at once are summed, so they can exceed the elapsed time. The data can be dumped at any moment (see getReport()).
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <QString>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <atomic>
+#include <map>
+
+using namespace std;
+
+class Profiler {
+	public:
+		//! \brief Stores the data of a phase (timer) or a counter
+		class Entry {
+			private:
+				bool timer;
+
+				//! \brief Amount of measurements (timers) or the counter value
+				atomic<qint64> count;
+
+				//! \brief Elapsed time of all measurements in nanoseconds (only for timers)
+				atomic<qint64> elapsed;
+
+			public:
+				Entry(bool timer);
+
+				bool isTimer(void);
+
+				//! \brief Increments the counter by the specified amount
+				void increment(qint64 amount=1);
+
+				//! \brief Stores a measurement of a timer
+				void addMeasurement(qint64 nsecs);
+
+				qint64 getCount(void);
+				qint64 getElapsed(void);
+				void reset(void);
+		};
+
+		/*! \brief Measures the time between its creation (or the call to start()) and its destruction
+		 (or the call to stop()) storing it on the timer entry */
+		class Timer {
+			private:
+				Entry *entry;
+				QElapsedTimer timer;
+				bool running;
+
+			public:
+				Timer(Entry *entry, bool start=true);
+				~Timer(void);
+
+				void start(void);
+				void stop(void);
+		};
+
+	private:
+		//! \brief Mutex that controls the registration of the entries
+		static QMutex entries_mutex;
+
+		/*! \brief Registered entries. The entries are never destroyed so the references kept by
+		 the instrumented code remain valid during the whole execution */
+		static map<QString, Entry *> entries;
+
+		//! \brief Returns the entry with the specified name registering it if needed
+		static Entry *getEntry(const QString &name, bool timer);
+
+	public:
+		//! \brief Returns the timer entry with the specified name
+		static Entry *getTimer(const QString &name);
+
+		//! \brief Returns the counter entry with the specified name
+		static Entry *getCounter(const QString &name);
+
+		//! \brief Zeroes all the timers and counters
+		static void reset(void);
+
+		/*! \brief Returns the collected data as a plain text table (one line per entry with the amount
+		 of measurements, total and average time in milliseconds for timers and the value for counters) */
+		static QString getReport(void);
+};
+
+#endif
@@ -0,0 +1,58 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "progressreporter.h"
+
+ProgressReporter::ProgressReporter(int interval)
+{
+	setInterval(interval);
+}
+
+void ProgressReporter::setInterval(int interval)
+{
+	this->interval=(interval < 0 ? 0 : interval);
+}
+
+int ProgressReporter::getInterval(void)
+{
+	return(interval);
+}
+
+void ProgressReporter::reset(void)
+{
+	timer.invalidate();
+}
+
+bool ProgressReporter::isReportDue(int progress, bool force)
+{
+	if(force || progress >= 100 || !timer.isValid() || timer.elapsed() >= interval)
+	{
+		timer.start();
+		return(true);
+	}
+
+	return(false);
+}
+
+int ProgressReporter::getProgress(unsigned done, unsigned total)
+{
+	if(total==0 || done >= total)
+		return(100);
+
+	return((static_cast<qint64>(done) * 100)/total);
+}
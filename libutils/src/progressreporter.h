@@ -0,0 +1,66 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2013 - Raphael Araújo e Silva <rkhaotix@gmail.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class ProgressReporter
+\brief Limits the frequency of the progress reports of long tasks (e.g. model loading and code generation).
+ The tasks keep their own counters and ask the reporter if a report is due before building the report text,
+ so the messages are formatted (and the progress widgets repainted) only a few times per second regardless
+ the amount of processed objects. No memory is allocated by the reporter.
+\note <strong>Creation date:</strong> 17/10/2026
+*/
+
+#ifndef PROGRESS_REPORTER_H
+#define PROGRESS_REPORTER_H
+
+#include <QElapsedTimer>
+
+class ProgressReporter {
+	private:
+		//! \brief Measures the time elapsed since the last delivered report
+		QElapsedTimer timer;
+
+		//! \brief Minimum time (in milliseconds) between two reports
+		int interval;
+
+	public:
+		//! \brief Default interval between reports (in milliseconds)
+		static constexpr int DEFAULT_INTERVAL=100;
+
+		ProgressReporter(int interval=DEFAULT_INTERVAL);
+
+		//! \brief Changes the minimum interval between reports. Zero makes all the reports be delivered
+		void setInterval(int interval);
+
+		//! \brief Returns the minimum interval between reports
+		int getInterval(void);
+
+		//! \brief Restarts the reporter so the next report is delivered immediately
+		void reset(void);
+
+		/*! \brief Returns true if a report with the specified progress must be delivered now. The first report
+		 after a reset, the final one (progress of 100%) and the forced ones are always delivered, the others
+		 only when the interval since the last delivered report has elapsed */
+		bool isReportDue(int progress, bool force=false);
+
+		//! \brief Returns the percentage of the processed items (from 0 to 100)
+		static int getProgress(unsigned done, unsigned total);
+};
+
+#endif
@@ -37,6 +37,10 @@ QString PgModelerCLI::PASSWD="--passwd";
 QString PgModelerCLI::INITIAL_DB="--initial-db";
 QString PgModelerCLI::SILENT="--silent";
 QString PgModelerCLI::LIST_CONNS="--list-conns";
+QString PgModelerCLI::THREADS="--threads";
+QString PgModelerCLI::PARALLEL_CONNS="--parallel-conns";
+QString PgModelerCLI::VALIDATE_INPUT="--validate-input";
+QString PgModelerCLI::PROFILE="--profile";
 
 PgModelerCLI::PgModelerCLI(int argc, char **argv) :  QApplication(argc, argv)
 {
@@ -99,6 +103,16 @@ PgModelerCLI::PgModelerCLI(int argc, char **argv) :  QApplication(argc, argv)
 			model=new DatabaseModel;
 			silent_mode=(parsed_opts.count(SILENT));
 
+			if(parsed_opts.count(THREADS))
+			{
+				model->setCodeGenerationThreads(parsed_opts[THREADS].toUInt());
+				model->setLoadingThreads(parsed_opts[THREADS].toUInt());
+			}
+
+			//Disables the fast loading of files that has a valid checksum
+			if(parsed_opts.count(VALIDATE_INPUT))
+				XMLParser::setTrustedFilesEnabled(false);
+
 			//If the export is to png image loads additional configurations
 			if(parsed_opts.count(EXPORT_TO_PNG))
 			{
@@ -173,6 +187,10 @@ void PgModelerCLI::initializeOptions(void)
 	long_opts[PASSWD]=true;
 	long_opts[INITIAL_DB]=true;
 	long_opts[LIST_CONNS]=false;
+	long_opts[THREADS]=true;
+	long_opts[PARALLEL_CONNS]=true;
+	long_opts[VALIDATE_INPUT]=false;
+	long_opts[PROFILE]=false;
 
 	short_opts[INPUT]="-i";
 	short_opts[OUTPUT]="-o";
@@ -192,6 +210,10 @@ void PgModelerCLI::initializeOptions(void)
 	short_opts[INITIAL_DB]="-D";
 	short_opts[SILENT]="-s";
 	short_opts[LIST_CONNS]="-L";
+	short_opts[THREADS]="-t";
+	short_opts[PARALLEL_CONNS]="-C";
+	short_opts[VALIDATE_INPUT]="-V";
+	short_opts[PROFILE]="-T";
 }
 
 bool PgModelerCLI::isOptionRecognized(QString &op, bool &accepts_val)
@@ -230,6 +252,9 @@ modes are described below.") << endl;
 	out << trUtf8("   %1, %2\t\t Export directly to a PostgreSQL server.").arg(short_opts[EXPORT_TO_DBMS]).arg(EXPORT_TO_DBMS) << endl;
 	out << trUtf8("   %1, %2\t\t List available connections on %3 file.").arg(short_opts[LIST_CONNS]).arg(LIST_CONNS).arg(GlobalAttributes::CONNECTIONS_CONF + GlobalAttributes::CONFIGURATION_EXT) << endl;
 	out << trUtf8("   %1, %2\t\t Version of generated SQL code. Only for file or dbms export.").arg(short_opts[PGSQL_VER]).arg(PGSQL_VER) << endl;
+	out << trUtf8("   %1, %2=[NUMBER]\t Number of threads used to load the input file and generate the code (0 uses all available processors). Code generation only on file export.").arg(short_opts[THREADS]).arg(THREADS) << endl;
+	out << trUtf8("   %1, %2\t\t Always validates the input file against the DTD, even when it was written by pgModeler.").arg(short_opts[VALIDATE_INPUT]).arg(VALIDATE_INPUT) << endl;
+	out << trUtf8("   %1, %2\t\t Prints the time spent on each phase of the process (loading, validation, code generation, export) at the end.").arg(short_opts[PROFILE]).arg(PROFILE) << endl;
 	out << trUtf8("   %1, %2\t\t\t Silent execution. Only critical errors are shown during process.").arg(short_opts[SILENT]).arg(SILENT) << endl;
 	out << trUtf8("   %1, %2\t\t\t Show this help menu.").arg(short_opts[HELP]).arg(HELP) << endl;
 	out << endl;
@@ -240,6 +265,7 @@ modes are described below.") << endl;
 	out << trUtf8("DBMS export options: ") << endl;
 	out << trUtf8("   %1, %2\t Ignores errors related to duplicated objects that eventually exists on server side.").arg(short_opts[IGNORE_DUPLICATES]).arg(IGNORE_DUPLICATES) << endl;
 	out << trUtf8("   %1, %2=[ALIAS]\t Connection configuration alias to be used.").arg(short_opts[CONN_ALIAS]).arg(CONN_ALIAS) << endl;
+	out << trUtf8("   %1, %2=[NUMBER]\t Number of connections used to create the objects with no dependencies between them at the same time.").arg(short_opts[PARALLEL_CONNS]).arg(PARALLEL_CONNS) << endl;
 	out << trUtf8("   %1, %2=[HOST]\t\t PostgreSQL host which export will operate.").arg(short_opts[HOST]).arg(HOST) << endl;
 	out << trUtf8("   %1, %2=[PORT]\t\t PostgreSQL host listening port.").arg(short_opts[PORT]).arg(PORT) << endl;
 	out << trUtf8("   %1, %2=[USER]\t\t PosrgreSQL username.").arg(short_opts[USER]).arg(USER) << endl;
@@ -299,6 +325,23 @@ void PgModelerCLI::parserOptions(map<QString, QString> &opts)
 		else if(opts.count(EXPORT_TO_DBMS) && !opts.count(CONN_ALIAS) &&
 						 (!opts.count(HOST) || !opts.count(USER) || !opts.count(PASSWD) || !opts.count(INITIAL_DB)) )
 			throw Exception(trUtf8("Incomplete connection information!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		else if(opts.count(THREADS))
+		{
+			bool conv_ok=false;
+
+			opts[THREADS].toUInt(&conv_ok);
+			if(!conv_ok)
+				throw Exception(trUtf8("Invalid number of threads specified!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+
+		if(opts.count(PARALLEL_CONNS))
+		{
+			bool conv_ok=false;
+
+			opts[PARALLEL_CONNS].toUInt(&conv_ok);
+			if(!conv_ok)
+				throw Exception(trUtf8("Invalid number of connections specified!"), ERR_CUSTOM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
 
 		parsed_opts=opts;
 	}
@@ -347,11 +390,18 @@ int PgModelerCLI::exec(void)
 				if(!silent_mode)
 					out << trUtf8("Export to DBMS: ") <<  connection.getConnectionString() << endl;
 
+				if(parsed_opts.count(PARALLEL_CONNS))
+					export_hlp.setExportConnections(parsed_opts[PARALLEL_CONNS].toUInt());
+
 				export_hlp.exportToDBMS(model, connection, parsed_opts[PGSQL_VER], !parsed_opts[IGNORE_DUPLICATES].isEmpty());
 			}
 
 			if(!silent_mode)
 				out << trUtf8("Export successfully ended!") << endl << endl;
+
+			//The profiling data is printed even in silent mode since it was explicitly requested
+			if(parsed_opts.count(PROFILE))
+				out << trUtf8("Profiling data:") << endl << Profiler::getReport() << endl;
 		}
 
 		return(0);
@@ -364,6 +414,12 @@ int PgModelerCLI::exec(void)
 
 void PgModelerCLI::updateProgress(int progress, QString msg)
 {
+	//New messages are always printed while the repeated ones are printed at most a few times per second
+	if(!prog_rep.isReportDue(progress, msg!=last_msg))
+		return;
+
+	last_msg=msg;
+
 	if(progress > 0)
 		out << msg <<  "(" << progress << "%)" << endl;
 	else
@@ -29,6 +29,7 @@
 #include <QTextStream>
 #include <QCoreApplication>
 #include "exception.h"
+#include "progressreporter.h"
 #include "globalattributes.h"
 #include "modelwidget.h"
 #include "modelexporthelper.h"
@@ -72,6 +73,12 @@ class PgModelerCLI: public QApplication {
 		//Indicates if the cli must run in silent mode
 		bool silent_mode;
 
+		//Limits the frequency in which repeated progress messages are printed
+		ProgressReporter prog_rep;
+
+		//Last progress message printed
+		QString last_msg;
+
 		//Option names constants
 		static QString INPUT,
 		OUTPUT,
@@ -90,7 +97,11 @@ class PgModelerCLI: public QApplication {
 		PASSWD,
 		INITIAL_DB,
 		SILENT,
-		LIST_CONNS;
+		LIST_CONNS,
+		THREADS,
+		PARALLEL_CONNS,
+		VALIDATE_INPUT,
+		PROFILE;
 
 		//Parsers the options and executes the action specified by them
 		void parserOptions(map<QString, QString> &parsed_opts);
@@ -98,6 +98,9 @@ SUBDIRS = libutils \
 	  plugins/dummy \
 	  plugins/xml2object
 
+#The benchmarks (pgmodeler-bench) are built only when requested: qmake CONFIG+=benchmarks
+benchmarks:SUBDIRS += benchmarks
+
 QT += core widgets printsupport
 TEMPLATE = subdirs
 MOC_DIR = moc